@@ -0,0 +1,51 @@
+#ifndef BT_CONFIG_H
+#define BT_CONFIG_H
+
+#include <stdint.h>
+
+// Configuration definitions
+// The last flash sector holds a log of records, newest last. The linker
+// script keeps it out of the FLASH region, and programming the firmware
+// erases only the sectors the image uses, so the record survives updates.
+#ifndef BTCFG_FLASH_ADDR
+#define BTCFG_FLASH_ADDR    0x08060000UL    // Sector 7, last 128 KB of the STM32F401RE
+#endif
+#define BTCFG_FLASH_SIZE    0x20000UL
+#define BTCFG_FLASH_SECTOR  FLASH_SECTOR_7
+#define BTCFG_MAGIC         0x48433035UL    // "HC05"
+#define BTCFG_NAME_SIZE     32              // Device name, terminator included
+#define BTCFG_PIN_SIZE      17              // Pairing PIN, terminator included
+
+// Settings field masks, as returned by BTCFG_Compare()
+#define BTCFG_NAME          0x01U
+#define BTCFG_PIN           0x02U
+#define BTCFG_BAUDRATE      0x04U
+#define BTCFG_ALL           (BTCFG_NAME | BTCFG_PIN | BTCFG_BAUDRATE)
+
+// HC-05 settings applied by AT commands
+typedef struct {
+    char name[BTCFG_NAME_SIZE];     // AT+NAME
+    char pin[BTCFG_PIN_SIZE];       // AT+PSWD
+    uint32_t baudrate;              // AT+UART, data mode
+} BTCFG_SettingsTypeDef;
+
+// Flash record, programmed word by word; the last valid one in the log wins
+typedef struct {
+    uint32_t magic;                 // BTCFG_MAGIC; erased flash reads 0xFFFFFFFF
+    BTCFG_SettingsTypeDef settings;
+    uint32_t crc;                   // CRC-32 of everything above
+} BTCFG_RecordTypeDef;
+
+// Configuration store states
+typedef enum {
+    BTCFG_OK = 0,       // Operation successful
+    BTCFG_ERROR = 1,    // Flash erase or program failed, or bad argument
+    BTCFG_EMPTY = 2     // No valid record
+} BTCFG_StatusTypeDef;
+
+// Function prototypes
+BTCFG_StatusTypeDef BTCFG_Load(BTCFG_SettingsTypeDef *settings);
+BTCFG_StatusTypeDef BTCFG_Save(const BTCFG_SettingsTypeDef *settings);
+uint8_t BTCFG_Compare(const BTCFG_SettingsTypeDef *a, const BTCFG_SettingsTypeDef *b);
+
+#endif /* BT_CONFIG_H */
@@ -0,0 +1,34 @@
+#ifndef MEM_USAGE_H
+#define MEM_USAGE_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define MEM_PAINT_PATTERN   0xA5A5A5A5UL    // Fill of never-used stack words
+
+// Memory usage snapshot, sizes in bytes
+typedef struct {
+    uint32_t flash;             // Code, constants and the .data load image
+    uint32_t data;              // .data, RAM_FUNC code included
+    uint32_t ramfunc;           // RAM_FUNC code (part of data)
+    uint32_t bss;               // .bss
+    uint32_t heap_reserved;     // _Min_Heap_Size
+    uint32_t heap_arena;        // Taken from _sbrk so far; never shrinks (high-water mark)
+    uint32_t heap_used;         // Held by malloc blocks now
+    uint32_t stack_reserved;    // _Min_Stack_Size
+    uint32_t stack_peak;        // Deepest main stack use since MEM_PaintStack()
+    uint32_t untouched;         // RAM between the heap and the deepest stack use
+} MEM_UsageTypeDef;
+
+// Memory usage states
+typedef enum {
+    MEM_OK = 0,         // Operation successful
+    MEM_ERROR = 1       // Bad argument, or the stack went past its reserve
+} MEM_StatusTypeDef;
+
+// Function prototypes
+void MEM_PaintStack(void);
+uint32_t MEM_StackPeak(void);
+MEM_StatusTypeDef MEM_GetUsage(MEM_UsageTypeDef *usage);
+
+#endif /* MEM_USAGE_H */
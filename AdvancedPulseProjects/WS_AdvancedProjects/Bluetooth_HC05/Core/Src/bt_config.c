@@ -0,0 +1,205 @@
+#include "bt_config.h"
+#include "stm32f4xx_hal.h"
+#include <stddef.h>
+#include <string.h>
+
+#define BTCFG_ERASED        0xFFFFFFFFUL
+#define BTCFG_RECORD_COUNT  (BTCFG_FLASH_SIZE / sizeof(BTCFG_RecordTypeDef))
+
+_Static_assert(sizeof(BTCFG_RecordTypeDef) % 4U == 0U, "records are programmed in words");
+
+/**
+ * @brief Get a record slot of the flash log
+ * @param i: Slot index, 0 to BTCFG_RECORD_COUNT - 1
+ * @retval const BTCFG_RecordTypeDef*: Slot address
+ */
+static inline const BTCFG_RecordTypeDef *BTCFG_Slot(uint32_t i)
+{
+    return (const BTCFG_RecordTypeDef *)BTCFG_FLASH_ADDR + i;
+}
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected), bitwise
+ * @note  About 60 bytes per record, run once at boot and once per save
+ * @param data: Bytes to check
+ * @param len: Number of bytes
+ * @retval uint32_t: CRC
+ */
+static uint32_t BTCFG_Crc32(const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    while (len--) {
+        crc ^= *p++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0U - (crc & 1U)));
+        }
+    }
+
+    return ~crc;
+}
+
+/**
+ * @brief Check a record
+ * @param r: Record
+ * @retval uint8_t: 1 if complete and intact
+ */
+static uint8_t BTCFG_Valid(const BTCFG_RecordTypeDef *r)
+{
+    return r->magic == BTCFG_MAGIC &&
+           r->crc == BTCFG_Crc32(r, offsetof(BTCFG_RecordTypeDef, crc));
+}
+
+/**
+ * @brief Find the newest valid record and the first free slot
+ * @note  Used slots form a prefix of the sector (the magic word is
+ *        programmed first), so the free slot is found by reading one word
+ *        per slot; only the newest records are checked by CRC. A record
+ *        torn by a reset has its magic but not its CRC and is skipped
+ * @param free_slot: Output, first erased slot, BTCFG_RECORD_COUNT if full
+ * @retval const BTCFG_RecordTypeDef*: Newest valid record, NULL if none
+ */
+static const BTCFG_RecordTypeDef *BTCFG_Scan(uint32_t *free_slot)
+{
+    uint32_t i = 0;
+
+    while (i < BTCFG_RECORD_COUNT && BTCFG_Slot(i)->magic != BTCFG_ERASED) {
+        i++;
+    }
+    *free_slot = i;
+
+    while (i > 0) {
+        i--;
+        if (BTCFG_Valid(BTCFG_Slot(i))) {
+            return BTCFG_Slot(i);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Read the last saved settings
+ * @param settings: Pointer to BTCFG_SettingsTypeDef structure, filled on success
+ * @retval BTCFG_StatusTypeDef: BTCFG_OK, BTCFG_EMPTY if no valid record
+ *         exists, BTCFG_ERROR on a bad argument
+ */
+BTCFG_StatusTypeDef BTCFG_Load(BTCFG_SettingsTypeDef *settings)
+{
+    const BTCFG_RecordTypeDef *newest;
+    uint32_t free_slot;
+
+    if (settings == NULL) {
+        return BTCFG_ERROR;
+    }
+
+    newest = BTCFG_Scan(&free_slot);
+    if (newest == NULL) {
+        return BTCFG_EMPTY;
+    }
+
+    *settings = newest->settings;
+    return BTCFG_OK;
+}
+
+/**
+ * @brief Append the settings to the flash log
+ * @note  Nothing is written if they equal the newest record. A save
+ *        programs 16 words (about 0.3 ms); once the sector is full it is
+ *        erased first, which stalls the CPU for 1 to 2 s (code runs from
+ *        the same flash bank) and happens every BTCFG_RECORD_COUNT saves.
+ *        A reset during that erase loses the record: the settings are then
+ *        applied again at the next boot
+ * @param settings: Settings to store; strings are cut to their field size
+ * @retval BTCFG_StatusTypeDef: BTCFG_OK, or BTCFG_ERROR on a bad argument
+ *         or a flash failure
+ */
+BTCFG_StatusTypeDef BTCFG_Save(const BTCFG_SettingsTypeDef *settings)
+{
+    BTCFG_RecordTypeDef record;
+    const BTCFG_RecordTypeDef *newest;
+    uint32_t slot;
+    HAL_StatusTypeDef status = HAL_OK;
+
+    if (settings == NULL) {
+        return BTCFG_ERROR;
+    }
+
+    newest = BTCFG_Scan(&slot);
+    if (newest != NULL && BTCFG_Compare(&newest->settings, settings) == 0U) {
+        return BTCFG_OK;
+    }
+
+    // Zero fill: string tails and padding are covered by the CRC, and
+    // the strings stay terminated however long the input is
+    memset(&record, 0, sizeof(record));
+    record.magic = BTCFG_MAGIC;
+    memcpy(record.settings.name, settings->name, strnlen(settings->name, BTCFG_NAME_SIZE - 1U));
+    memcpy(record.settings.pin, settings->pin, strnlen(settings->pin, BTCFG_PIN_SIZE - 1U));
+    record.settings.baudrate = settings->baudrate;
+    record.crc = BTCFG_Crc32(&record, offsetof(BTCFG_RecordTypeDef, crc));
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR |
+                           FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+
+    if (slot >= BTCFG_RECORD_COUNT) {
+        FLASH_EraseInitTypeDef erase = {
+            .TypeErase = FLASH_TYPEERASE_SECTORS,
+            .Sector = BTCFG_FLASH_SECTOR,
+            .NbSectors = 1,
+            .VoltageRange = FLASH_VOLTAGE_RANGE_3
+        };
+        uint32_t sector_error;
+
+        status = HAL_FLASHEx_Erase(&erase, &sector_error);
+        slot = 0;
+    }
+
+    // Word by word, magic first
+    for (uint32_t offset = 0; offset < sizeof(record) && status == HAL_OK; offset += 4U) {
+        uint32_t word;
+
+        memcpy(&word, (const uint8_t *)&record + offset, sizeof(word));
+        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD,
+                                   (uint32_t)(uintptr_t)BTCFG_Slot(slot) + offset, word);
+    }
+
+    HAL_FLASH_Lock();
+
+    // The ART data cache may still hold the erased words of this slot
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_RESET();
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+
+    if (status != HAL_OK || !BTCFG_Valid(BTCFG_Slot(slot))) {
+        return BTCFG_ERROR;
+    }
+
+    return BTCFG_OK;
+}
+
+/**
+ * @brief Compare two sets of settings
+ * @param a: Settings
+ * @param b: Settings
+ * @retval uint8_t: BTCFG_NAME, BTCFG_PIN and BTCFG_BAUDRATE bits of the
+ *         fields that differ, 0 if equal
+ */
+uint8_t BTCFG_Compare(const BTCFG_SettingsTypeDef *a, const BTCFG_SettingsTypeDef *b)
+{
+    uint8_t diff = 0;
+
+    if (strncmp(a->name, b->name, BTCFG_NAME_SIZE - 1U) != 0) {
+        diff |= BTCFG_NAME;
+    }
+    if (strncmp(a->pin, b->pin, BTCFG_PIN_SIZE - 1U) != 0) {
+        diff |= BTCFG_PIN;
+    }
+    if (a->baudrate != b->baudrate) {
+        diff |= BTCFG_BAUDRATE;
+    }
+
+    return diff;
+}
@@ -21,7 +21,11 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "bt_config.h"
+#include "cmd.h"
 #include "hc05_driver.h"
+#include "mem_usage.h"
+#include "ram_func.h"
 #include <stdio.h>
 #include <string.h>
 /* USER CODE END Includes */
@@ -33,10 +37,8 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-// Command definitions
-#define CMD_LED_ON    "ledon"
-#define CMD_LED_OFF   "ledoff"
-#define CMD_HELP      "help"
+#define RESPONSE_PREFIX "[STM32]: "
+#define BT_CONFIG_IDLE_MS 3000 // No command for this long before AT configuration runs
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -50,6 +52,14 @@ UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
 HC05_HandleTypeDef hc05; // HC-05 Bluetooth module driver structure
+
+// HC-05 settings: wanted, and applied according to the flash record
+static const BTCFG_SettingsTypeDef bt_settings = { "STM32_HC05", "1234", 9600 };
+static BTCFG_SettingsTypeDef bt_applied;
+static uint8_t bt_pending;              // BTCFG_* fields still to apply
+static uint32_t bt_idle_since;          // Tick of the last command
+static uint32_t boot_ready_ms;          // Tick at "System ready"
+static uint32_t boot_first_cmd_ms;      // Tick of the first command, 0 before
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -59,9 +69,17 @@ static void MX_USART2_UART_Init(void);
 static void MX_USART1_UART_Init(void);
 /* USER CODE BEGIN PFP */
 // Command dispatcher function prototypes
-void ProcessBluetoothCommand(const char* command);
-void SendCommandResponse(const char* response);
-void ShowAvailableCommands(void);
+void ProcessBluetoothCommand(char* command);
+static void BluetoothWrite(void *io, const char *data, size_t len);
+static char *BluetoothReserve(void *io, size_t *size);
+static void BluetoothCommit(void *io, size_t len);
+static void SetUserLed(const CMD_OutputTypeDef *out, uint8_t on);
+static CMD_StatusTypeDef CmdLedOn(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdLedOff(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdLed(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdMem(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdBoot(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static void ApplyPendingConfig(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -78,77 +96,200 @@ int __io_putchar(int ch)
   return ch;
 }
 
+// Command table, kept in flash; "help" is built in
+static const CMD_CommandTypeDef commands[] = {
+  { "ledon",  "",       "Turn ON user LED",  CmdLedOn,  0, 0 },
+  { "ledoff", "",       "Turn OFF user LED", CmdLedOff, 0, 0 },
+  { "led",    "on|off", "Set user LED",      CmdLed,    1, 1 },
+  { "mem",    "",       "Memory usage",      CmdMem,    0, 0 },
+  { "boot",   "",       "Boot timing",       CmdBoot,   0, 0 },
+};
+static const CMD_TableTypeDef command_table = CMD_TABLE(commands);
+static const CMD_OutputTypeDef bluetooth_out = { BluetoothWrite, &hc05, BluetoothReserve, BluetoothCommit };
+
 /**
   * @brief  Process received Bluetooth commands
-  * @param  command: received command string
+  * @note   Matching is case-insensitive and needs no copy of the command:
+  *         the line is split in place, in the driver's receive buffer, and
+  *         looked up in the command table
+  * @param  command: received command string, modified
   * @retval None
   */
-void ProcessBluetoothCommand(const char* command)
+void ProcessBluetoothCommand(char* command)
 {
-  // Convert command to lowercase for case-insensitive comparison
-  char cmd_lower[HC05_BUFFER_SIZE];
-  strncpy(cmd_lower, command, sizeof(cmd_lower) - 1);
-  cmd_lower[sizeof(cmd_lower) - 1] = '\0';
-
-  // Convert to lowercase
-  for(int i = 0; cmd_lower[i]; i++){
-    if(cmd_lower[i] >= 'A' && cmd_lower[i] <= 'Z'){
-      cmd_lower[i] = cmd_lower[i] + 32;
-    }
+  if (CMD_Execute(&command_table, command, &bluetooth_out) == CMD_ERROR) {
+    CMD_Print(&bluetooth_out, RESPONSE_PREFIX "Invalid argument. Type 'help' for available commands.\r\n");
   }
+}
 
-  printf("Processing command: '%s'\r\n", cmd_lower);
+/**
+  * @brief  Command output: queue for sending back via Bluetooth
+  * @param  io: HC-05 driver structure
+  * @param  data: bytes to send
+  * @param  len: number of bytes
+  * @retval None
+  */
+static void BluetoothWrite(void *io, const char *data, size_t len)
+{
+  HC05_Write((HC05_HandleTypeDef*)io, data, len);
+}
 
-  // Command dispatcher
-  if (strcmp(cmd_lower, CMD_LED_ON) == 0) {
-    // Turn ON LED2 (User LED on Nucleo board)
-    HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, GPIO_PIN_SET);
-    SendCommandResponse("LED ON - User LED activated");
-    printf("Command executed: LED turned ON\r\n");
-  }
-  else if (strcmp(cmd_lower, CMD_LED_OFF) == 0) {
-    // Turn OFF LED2 (User LED on Nucleo board)
-    HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, GPIO_PIN_RESET);
-    SendCommandResponse("LED OFF - User LED deactivated");
-    printf("Command executed: LED turned OFF\r\n");
-  }
-  else if (strcmp(cmd_lower, CMD_HELP) == 0) {
-    // Show available commands
-    ShowAvailableCommands();
-  }
-  else {
-    // Unknown command
-    char error_msg[128];
-    snprintf(error_msg, sizeof(error_msg), "Unknown command: '%s'. Type 'help' for available commands.", command);
-    SendCommandResponse(error_msg);
-    printf("Unknown command received: '%s'\r\n", command);
-  }
+/**
+  * @brief  Command output: formatted replies are written into a TX queue slot
+  * @param  io: HC-05 driver structure
+  * @param  size: slot capacity
+  * @retval char*: slot, NULL if the queue stayed full
+  */
+static char *BluetoothReserve(void *io, size_t *size)
+{
+  return HC05_TxReserve((HC05_HandleTypeDef*)io, size);
+}
+
+/**
+  * @brief  Command output: send the reserved slot
+  * @param  io: HC-05 driver structure
+  * @param  len: bytes written into the slot
+  * @retval None
+  */
+static void BluetoothCommit(void *io, size_t len)
+{
+  HC05_TxCommit((HC05_HandleTypeDef*)io, len);
 }
 
 /**
-  * @brief  Send response back via Bluetooth
-  * @param  response: response string to send
+  * @brief  Switch LED2 (User LED on Nucleo board) and confirm via Bluetooth
+  * @param  out: command output
+  * @param  on: 1 to turn the LED on
   * @retval None
   */
-void SendCommandResponse(const char* response)
+static void SetUserLed(const CMD_OutputTypeDef *out, uint8_t on)
+{
+  HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, on ? GPIO_PIN_SET : GPIO_PIN_RESET);
+  CMD_Print(out, on ? RESPONSE_PREFIX "LED ON - User LED activated\r\n"
+                    : RESPONSE_PREFIX "LED OFF - User LED deactivated\r\n");
+  printf("Command executed: LED turned %s\r\n", on ? "ON" : "OFF");
+}
+
+/**
+  * @brief  "ledon" command
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdLedOn(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  SetUserLed(out, 1);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "ledoff" command
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdLedOff(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  SetUserLed(out, 0);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "led on|off" command
+  * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR on an unknown state
+  */
+static CMD_StatusTypeDef CmdLed(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  static const char *const states[] = { "off", "on" };
+  uint8_t state;
+
+  if (CMD_ParseEnum(argv[1], states, 2, &state) != CMD_OK) {
+    return CMD_ERROR;
+  }
+
+  SetUserLed(out, state);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "mem" command: flash, static RAM, heap and stack usage in bytes
+  * @note   The stack peak counts from the top of RAM and includes interrupt
+  *         frames; "untouched" is the RAM neither heap nor stack ever reached
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdMem(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  MEM_UsageTypeDef mem;
+  MEM_StatusTypeDef status = MEM_GetUsage(&mem);
+
+  CMD_Printf(out, RESPONSE_PREFIX "flash %lu, data %lu (ramfunc %lu), bss %lu\r\n",
+             (unsigned long)mem.flash, (unsigned long)mem.data,
+             (unsigned long)mem.ramfunc, (unsigned long)mem.bss);
+  CMD_Printf(out, RESPONSE_PREFIX "heap %lu used, %lu peak, %lu reserved\r\n",
+             (unsigned long)mem.heap_used, (unsigned long)mem.heap_arena,
+             (unsigned long)mem.heap_reserved);
+  CMD_Printf(out, RESPONSE_PREFIX "stack %lu peak, %lu reserved%s\r\n",
+             (unsigned long)mem.stack_peak, (unsigned long)mem.stack_reserved,
+             (status == MEM_OK) ? "" : " - OVERFLOW");
+  CMD_Printf(out, RESPONSE_PREFIX "untouched %lu\r\n", (unsigned long)mem.untouched);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "boot" command: milliseconds from reset to ready and to the
+  *         first command, and the state of the HC-05 configuration
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdBoot(const CMD_OutputTypeDef *out, int argc, char *argv[])
 {
-  char full_response[HC05_BUFFER_SIZE + 50];
-  snprintf(full_response, sizeof(full_response), "[STM32]: %s\r\n", response);
-  HC05_SendData(&hc05, full_response);
+  CMD_Printf(out, RESPONSE_PREFIX "ready %lu ms, first command %lu ms\r\n",
+             (unsigned long)boot_ready_ms, (unsigned long)boot_first_cmd_ms);
+  CMD_Printf(out, RESPONSE_PREFIX "HC-05 config %s\r\n", bt_pending ? "pending" : "applied");
+  return CMD_OK;
 }
 
 /**
-  * @brief  Show available commands via Bluetooth
+  * @brief  Apply one pending HC-05 setting once the link is quiet
+  * @note   Deferred from boot: each setting is a blocking AT round trip
+  *         with two mode switches (several hundred ms, more on a timeout),
+  *         so it runs only after BT_CONFIG_IDLE_MS without a command. The
+  *         flash record is updated after every applied setting; a failed
+  *         one is retried after the next quiet period
   * @retval None
   */
-void ShowAvailableCommands(void)
+static void ApplyPendingConfig(void)
 {
-  HC05_SendData(&hc05, "\r\n=== STM32 Nucleo Commands ===\r\n");
-  HC05_SendData(&hc05, "ledon  - Turn ON user LED\r\n");
-  HC05_SendData(&hc05, "ledoff - Turn OFF user LED\r\n");
-  HC05_SendData(&hc05, "help   - Show this help\r\n");
-  HC05_SendData(&hc05, "=============================\r\n");
-  printf("Help commands sent via Bluetooth\r\n");
+  HC05_StatusTypeDef status;
+  uint8_t field;
+
+  if (bt_pending == 0 || HAL_GetTick() - bt_idle_since < BT_CONFIG_IDLE_MS) {
+    return;
+  }
+
+  if (bt_pending & BTCFG_NAME) {
+    field = BTCFG_NAME;
+    status = HC05_SetName(&hc05, bt_settings.name);
+  } else if (bt_pending & BTCFG_PIN) {
+    field = BTCFG_PIN;
+    status = HC05_SetPIN(&hc05, bt_settings.pin);
+  } else {
+    field = BTCFG_BAUDRATE;
+    status = HC05_SetBaudRate(&hc05, bt_settings.baudrate);
+  }
+  bt_idle_since = HAL_GetTick();
+
+  if (status != HC05_OK) {
+    printf("HC-05 setting 0x%02x not applied (status %d), retrying later\r\n", field, status);
+    return;
+  }
+
+  if (field == BTCFG_NAME) {
+    memcpy(bt_applied.name, bt_settings.name, sizeof(bt_applied.name));
+  } else if (field == BTCFG_PIN) {
+    memcpy(bt_applied.pin, bt_settings.pin, sizeof(bt_applied.pin));
+  } else {
+    bt_applied.baudrate = bt_settings.baudrate;
+  }
+  bt_pending &= (uint8_t)~field;
+
+  printf("HC-05 setting 0x%02x applied%s\r\n", field,
+         (BTCFG_Save(&bt_applied) == BTCFG_OK) ? "" : " (flash record not saved)");
 }
 /* USER CODE END 0 */
 
@@ -160,7 +301,8 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-
+  // Before anything else runs, so the high-water mark covers the whole program
+  MEM_PaintStack();
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -185,9 +327,6 @@ int main(void)
   MX_USART1_UART_Init();
   /* USER CODE BEGIN 2 */
 
-  /* Wait for system stabilization */
-    HAL_Delay(1000);
-
     /* Initialize HC-05 module on UART1 */
     if (HC05_Init(&hc05, &huart1, GPIOA, GPIO_PIN_8) == HC05_OK) {
       printf("HC-05 initialized successfully\r\n");
@@ -195,26 +334,27 @@ int main(void)
       printf("HC-05 initialization error\r\n");
     }
 
-    /* Optional HC-05 module configuration */
-    HAL_Delay(1000);
-
-    // Example: set device name
-    if (HC05_SetName(&hc05, "STM32_HC05") == HC05_OK) {
-      printf("Name set: STM32_HC05\r\n");
+    /* Fast boot: AT configuration only for settings the flash record lacks,
+       and not now but once the link is quiet (ApplyPendingConfig) */
+    if (BTCFG_Load(&bt_applied) == BTCFG_OK) {
+      bt_pending = BTCFG_Compare(&bt_applied, &bt_settings);
+    } else {
+      bt_pending = BTCFG_ALL;
     }
-
-    // Example: set pairing PIN
-    if (HC05_SetPIN(&hc05, "1234") == HC05_OK) {
-      printf("PIN set: 1234\r\n");
+    if (bt_pending == 0) {
+      printf("HC-05 configuration unchanged: %s, PIN %s\r\n", bt_settings.name, bt_settings.pin);
+    } else {
+      printf("HC-05 configuration pending (0x%02x), applied when idle\r\n", bt_pending);
     }
 
-    printf("System ready - Waiting for Bluetooth commands...\r\n");
-    printf("Available commands: ledon, ledoff, help\r\n");
+    boot_ready_ms = HAL_GetTick();
+    printf("System ready in %lu ms - Waiting for Bluetooth commands...\r\n", (unsigned long)boot_ready_ms);
+    printf("Available commands: ledon, ledoff, led on|off, mem, boot, help\r\n");
 
-    /* Send welcome message via Bluetooth */
-    HAL_Delay(500);
+    /* Queue welcome message via Bluetooth */
     HC05_SendData(&hc05, "\r\n*** STM32 Nucleo HC-05 Controller ***\r\n");
     HC05_SendData(&hc05, "System ready! Type 'help' for commands.\r\n");
+    bt_idle_since = HAL_GetTick();
 
     /* Test UART - send test character every 30 seconds */
     uint32_t last_test = 0;
@@ -232,20 +372,29 @@ int main(void)
 	      last_test = HAL_GetTick();
 	    }
 
-	    // Check if data is available from Bluetooth
-	    if (HC05_DataAvailable(&hc05)) {
-	      char received_data[HC05_BUFFER_SIZE];
-
-	      // Read received data
-	      if (HC05_ReceiveData(&hc05, received_data, sizeof(received_data)) == HC05_OK) {
-	        // Print received command via Virtual COM Port
-	        printf("BT RX: '%s'\r\n", received_data);
+	    // Check if a line is available from Bluetooth, used in place
+	    char *received_line = HC05_GetLine(&hc05);
 
-	        // Process the received command through dispatcher
-	        ProcessBluetoothCommand(received_data);
+	    if (received_line != NULL) {
+	      if (boot_first_cmd_ms == 0) {
+	        boot_first_cmd_ms = HAL_GetTick();
+	        printf("First command at %lu ms after reset\r\n", (unsigned long)boot_first_cmd_ms);
 	      }
+	      bt_idle_since = HAL_GetTick();
+
+	      // Print received command via Virtual COM Port
+	      printf("BT RX: '%s'\r\n", received_line);
+
+	      // Process the received command through dispatcher
+	      ProcessBluetoothCommand(received_line);
+
+	      // Hand the buffer back for the next line
+	      HC05_ReleaseLine(&hc05);
 	    }
 
+	    // Deferred HC-05 configuration, one setting at a time
+	    ApplyPendingConfig();
+
 	    HAL_Delay(10); // Small pause to avoid overloading the loop
     /* USER CODE END WHILE */
 
@@ -410,10 +559,13 @@ static void MX_GPIO_Init(void)
 /* USER CODE BEGIN 4 */
 /**
   * @brief  UART interrupt callback function
+  * @note   RAM_FUNC, as the USART1 handler and HC05_IRQHandler: the
+  *         per-byte path skips flash wait states. The HAL dispatch in
+  *         between (HAL_UART_IRQHandler) stays in flash
   * @param  huart: UART handle
   * @retval None
   */
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+RAM_FUNC void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
   if (huart->Instance == USART1) {
     // Call HC-05 driver interrupt handler
@@ -421,12 +573,39 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
   }
 }
 
+/**
+  * @brief  UART error callback: restart the Bluetooth reception
+  * @note   An overrun (a byte arriving while the previous one is still
+  *         unread) makes the HAL end the reception; without this the
+  *         module would go deaf until the next reset
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1) {
+    HC05_ErrorHandler(&hc05);
+  }
+}
+
+/**
+  * @brief  UART transmit complete callback: next Bluetooth TX queue slot
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1) {
+    HC05_TxCpltHandler(&hc05);
+  }
+}
+
 /**
   * @brief  This function handles USART1 global interrupt.
   * @param  None
   * @retval None
   */
-void USART1_IRQHandler(void)
+RAM_FUNC void USART1_IRQHandler(void)
 {
   HAL_UART_IRQHandler(&huart1);
 }
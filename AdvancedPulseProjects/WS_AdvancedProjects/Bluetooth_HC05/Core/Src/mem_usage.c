@@ -0,0 +1,99 @@
+#include "mem_usage.h"
+#include "stm32f4xx.h"
+#include <malloc.h>
+#include <stddef.h>
+
+// Linker script symbols: only their addresses are meaningful
+extern uint32_t g_pfnVectors[];     // Start of flash image (startup file)
+extern uint8_t _sidata[];           // .data load address
+extern uint8_t _sdata[], _edata[];
+extern uint8_t _sbss[], _ebss[];
+extern uint8_t _sramfunc[], _eramfunc[];
+extern uint8_t _end[];              // Heap start
+extern uint8_t _estack[];           // Stack top
+extern uint8_t _Min_Heap_Size[];    // Absolute symbols: the address is the value
+extern uint8_t _Min_Stack_Size[];
+
+void *_sbrk(ptrdiff_t incr);
+
+static uint32_t *mem_paint_top;     // First word above the painted area, NULL before painting
+
+/**
+ * @brief Get the current heap end
+ * @retval uint32_t*: First word above the heap, word aligned
+ */
+static inline uint32_t *MEM_HeapEnd(void)
+{
+    uintptr_t brk = (uintptr_t)_sbrk(0);
+
+    return (uint32_t *)((brk + 3U) & ~(uintptr_t)3U);
+}
+
+/**
+ * @brief Fill the unused main stack with MEM_PAINT_PATTERN
+ * @note  Call first thing in main. Paints from the heap end up to the
+ *        stack pointer of this call; words below the pointer are free, an
+ *        interrupt arriving meanwhile only uses and releases them
+ */
+void MEM_PaintStack(void)
+{
+    uint32_t *top = (uint32_t *)(__get_MSP() & ~3UL);
+
+    for (uint32_t *p = MEM_HeapEnd(); p < top; p++) {
+        *p = MEM_PAINT_PATTERN;
+    }
+
+    mem_paint_top = top;
+}
+
+/**
+ * @brief Get the deepest main stack use since painting
+ * @note  Scans up from the heap end to the first overwritten word: time
+ *        grows with the untouched RAM, so call it from the main loop or a
+ *        command, not from an interrupt. Interrupt frames are included
+ * @retval uint32_t: Bytes below _estack ever used, 0 if MEM_PaintStack()
+ *         was not called
+ */
+uint32_t MEM_StackPeak(void)
+{
+    const uint32_t *p = MEM_HeapEnd();
+
+    if (mem_paint_top == NULL) {
+        return 0;
+    }
+
+    while (p < mem_paint_top && *p == MEM_PAINT_PATTERN) {
+        p++;
+    }
+
+    return (uint32_t)((uintptr_t)_estack - (uintptr_t)p);
+}
+
+/**
+ * @brief Take a memory usage snapshot
+ * @param usage: Pointer to MEM_UsageTypeDef structure, filled
+ * @retval MEM_StatusTypeDef: MEM_OK, or MEM_ERROR on a NULL argument or a
+ *         stack peak beyond _Min_Stack_Size (the usage is still filled)
+ */
+MEM_StatusTypeDef MEM_GetUsage(MEM_UsageTypeDef *usage)
+{
+    if (usage == NULL) {
+        return MEM_ERROR;
+    }
+
+    struct mallinfo heap = mallinfo();
+    uint32_t *heap_end = MEM_HeapEnd();
+
+    usage->data = (uint32_t)(_edata - _sdata);
+    usage->ramfunc = (uint32_t)(_eramfunc - _sramfunc);
+    usage->bss = (uint32_t)(_ebss - _sbss);
+    usage->flash = (uint32_t)((uintptr_t)_sidata - (uintptr_t)g_pfnVectors) + usage->data;
+    usage->heap_reserved = (uint32_t)(uintptr_t)_Min_Heap_Size;
+    usage->heap_arena = (uint32_t)((uintptr_t)heap_end - (uintptr_t)_end);
+    usage->heap_used = (uint32_t)heap.uordblks;
+    usage->stack_reserved = (uint32_t)(uintptr_t)_Min_Stack_Size;
+    usage->stack_peak = MEM_StackPeak();
+    usage->untouched = (uint32_t)((uintptr_t)_estack - (uintptr_t)heap_end) - usage->stack_peak;
+
+    return (usage->stack_peak > usage->stack_reserved) ? MEM_ERROR : MEM_OK;
+}
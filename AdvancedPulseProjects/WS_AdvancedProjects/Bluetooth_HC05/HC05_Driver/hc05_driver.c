@@ -1,4 +1,25 @@
 #include "hc05_driver.h"
+#include "ram_func.h"
+
+/**
+ * @brief Start sending the oldest queued slot if the UART is idle
+ * @note  Thread code: while tx_busy is clear no transmit interrupt is pending
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ */
+static void HC05_TxStart(HC05_HandleTypeDef *hc05)
+{
+    if (hc05->tx_busy || hc05->tx_head == hc05->tx_tail) {
+        return;
+    }
+
+    uint8_t slot = hc05->tx_tail % HC05_TX_SLOTS;
+
+    hc05->tx_busy = 1;
+    if (HAL_UART_Transmit_IT(hc05->huart, (const uint8_t*)hc05->tx_slots[slot],
+                             hc05->tx_len[slot]) != HAL_OK) {
+        hc05->tx_busy = 0; // Retried by the next commit or flush
+    }
+}
 
 /**
  * @brief Initialize the HC-05 module
@@ -19,19 +40,23 @@ HC05_StatusTypeDef HC05_Init(HC05_HandleTypeDef *hc05, UART_HandleTypeDef *huart
     hc05->huart = huart;
     hc05->en_port = en_port;
     hc05->en_pin = en_pin;
+    hc05->rx_fill = 0;
     hc05->data_received = 0;
+    hc05->rx_paused = 0;
     hc05->rx_index = 0;
+    hc05->tx_head = 0;
+    hc05->tx_tail = 0;
+    hc05->tx_busy = 0;
 
     // Clear buffers
-    memset(hc05->rx_buffer, 0, HC05_BUFFER_SIZE);
-    memset(hc05->tx_buffer, 0, HC05_BUFFER_SIZE);
+    memset(hc05->rx_buffer, 0, sizeof(hc05->rx_buffer));
 
     // Set module to data mode (EN = LOW)
     HAL_GPIO_WritePin(hc05->en_port, hc05->en_pin, GPIO_PIN_RESET);
     HAL_Delay(100);
 
     // Start interrupt reception
-    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_index], 1);
+    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_fill][hc05->rx_index], 1);
 
     return HC05_OK;
 }
@@ -48,6 +73,9 @@ HC05_StatusTypeDef HC05_SetMode(HC05_HandleTypeDef *hc05, HC05_ModeTypeDef mode)
         return HC05_ERROR;
     }
 
+    // Let queued data go out before the UART is reconfigured
+    HC05_TxFlush(hc05, HC05_UART_TIMEOUT);
+
     if (mode == HC05_MODE_AT) {
         // AT mode: EN = HIGH and 38400 baud rate
         HAL_GPIO_WritePin(hc05->en_port, hc05->en_pin, GPIO_PIN_SET);
@@ -73,18 +101,23 @@ HC05_StatusTypeDef HC05_SetMode(HC05_HandleTypeDef *hc05, HC05_ModeTypeDef mode)
     HAL_Delay(100); // Wait for mode change
 
     // Restart interrupt reception
-    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_index], 1);
+    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_fill][hc05->rx_index], 1);
 
     return HC05_OK;
 }
 
 /**
  * @brief Send an AT command to the HC-05 module
+ * @note  The response is read through the interrupt line reception: every
+ *        line up to the final "OK" or "ERROR:(..)" is consumed, so none is
+ *        left over as a command once back in data mode
  * @param hc05: Pointer to HC05_HandleTypeDef structure
  * @param command: AT command to send
- * @param response: Buffer for response
+ * @param response: Buffer of HC05_AT_RESPONSE_SIZE for the first response
+ *        line, or NULL not to wait for a response
  * @param timeout: Timeout in milliseconds
- * @retval HC05_StatusTypeDef: Operation status
+ * @retval HC05_StatusTypeDef: HC05_OK, HC05_ERROR if the module answered
+ *         ERROR, HC05_TIMEOUT without a final line in time
  */
 HC05_StatusTypeDef HC05_SendATCommand(HC05_HandleTypeDef *hc05, const char *command,
                                      char *response, uint32_t timeout)
@@ -93,26 +126,52 @@ HC05_StatusTypeDef HC05_SendATCommand(HC05_HandleTypeDef *hc05, const char *comm
         return HC05_ERROR;
     }
 
-    // Prepare command with terminator
-    snprintf(hc05->tx_buffer, HC05_BUFFER_SIZE, "%s\r\n", command);
+    // The blocking transmit needs the queue drained
+    if (HC05_TxFlush(hc05, HC05_UART_TIMEOUT) != HC05_OK) {
+        return HC05_BUSY;
+    }
+
+    // The response is the next line: drop anything received before
+    HC05_ClearBuffer(hc05);
 
-    // Send the command
-    if (HAL_UART_Transmit(hc05->huart, (uint8_t*)hc05->tx_buffer,
-                         strlen(hc05->tx_buffer), HC05_UART_TIMEOUT) != HAL_OK) {
+    // Send the command and its terminator
+    if (HAL_UART_Transmit(hc05->huart, (const uint8_t*)command, strlen(command),
+                         HC05_UART_TIMEOUT) != HAL_OK ||
+        HAL_UART_Transmit(hc05->huart, (const uint8_t*)"\r\n", 2,
+                         HC05_UART_TIMEOUT) != HAL_OK) {
         return HC05_ERROR;
     }
 
     // Wait for response if requested
     if (response != NULL) {
-        uint8_t temp_buffer[HC05_AT_RESPONSE_SIZE];
-        memset(temp_buffer, 0, HC05_AT_RESPONSE_SIZE);
-
-        if (HAL_UART_Receive(hc05->huart, temp_buffer, HC05_AT_RESPONSE_SIZE-1,
-                            timeout) == HAL_OK) {
-            strcpy(response, (char*)temp_buffer);
-            return HC05_OK;
-        } else {
-            return HC05_TIMEOUT;
+        uint32_t start = HAL_GetTick();
+
+        response[0] = '\0';
+        while (1) {
+            char *line = HC05_GetLine(hc05);
+
+            if (line == NULL) {
+                if (HAL_GetTick() - start > timeout) {
+                    return HC05_TIMEOUT;
+                }
+                continue;
+            }
+
+            if (response[0] == '\0') {
+                strncpy(response, line, HC05_AT_RESPONSE_SIZE - 1);
+                response[HC05_AT_RESPONSE_SIZE - 1] = '\0';
+            }
+
+            uint8_t ok = (strcmp(line, "OK") == 0);
+            uint8_t error = (strncmp(line, "ERROR", 5) == 0);
+
+            HC05_ReleaseLine(hc05);
+            if (ok) {
+                return HC05_OK;
+            }
+            if (error) {
+                return HC05_ERROR;
+            }
         }
     }
 
@@ -121,6 +180,7 @@ HC05_StatusTypeDef HC05_SendATCommand(HC05_HandleTypeDef *hc05, const char *comm
 
 /**
  * @brief Send data through HC-05
+ * @note  Queued, see HC05_Write()
  * @param hc05: Pointer to HC05_HandleTypeDef structure
  * @param data: Data to send
  * @retval HC05_StatusTypeDef: Operation status
@@ -131,16 +191,121 @@ HC05_StatusTypeDef HC05_SendData(HC05_HandleTypeDef *hc05, const char *data)
         return HC05_ERROR;
     }
 
-    if (HAL_UART_Transmit(hc05->huart, (uint8_t*)data, strlen(data),
-                         HC05_UART_TIMEOUT) != HAL_OK) {
+    return HC05_Write(hc05, data, strlen(data));
+}
+
+/**
+ * @brief Queue data for transmission through HC-05
+ * @note  Copies the data into transmit slots and returns; the UART
+ *        interrupt sends them. Waits only while the queue is full
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ * @param data: Data to send
+ * @param len: Number of bytes
+ * @retval HC05_StatusTypeDef: HC05_OK, HC05_TIMEOUT if the queue stayed
+ *         full (data partly queued), HC05_ERROR on a bad argument
+ */
+HC05_StatusTypeDef HC05_Write(HC05_HandleTypeDef *hc05, const char *data, size_t len)
+{
+    if (hc05 == NULL || (data == NULL && len > 0)) {
         return HC05_ERROR;
     }
 
+    while (len > 0) {
+        size_t size;
+        char *slot = HC05_TxReserve(hc05, &size);
+
+        if (slot == NULL) {
+            return HC05_TIMEOUT;
+        }
+        if (size > len) {
+            size = len;
+        }
+
+        memcpy(slot, data, size);
+        HC05_TxCommit(hc05, size);
+        data += size;
+        len -= size;
+    }
+
+    return HC05_OK;
+}
+
+/**
+ * @brief Get the next free transmit slot
+ * @note  Zero copy: write the reply straight into the slot, then queue it
+ *        with HC05_TxCommit(). Waits up to HC05_UART_TIMEOUT while every
+ *        slot is queued. Thread code only, one writer at a time
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ * @param size: Output, slot capacity in bytes
+ * @retval char*: Slot, NULL on a bad argument or timeout
+ */
+char *HC05_TxReserve(HC05_HandleTypeDef *hc05, size_t *size)
+{
+    if (hc05 == NULL || size == NULL) {
+        return NULL;
+    }
+
+    uint32_t start = HAL_GetTick();
+
+    while ((uint8_t)(hc05->tx_head - hc05->tx_tail) >= HC05_TX_SLOTS) {
+        HC05_TxStart(hc05);
+        if (HAL_GetTick() - start > HC05_UART_TIMEOUT) {
+            return NULL;
+        }
+    }
+
+    *size = HC05_TX_SLOT_SIZE;
+    return hc05->tx_slots[hc05->tx_head % HC05_TX_SLOTS];
+}
+
+/**
+ * @brief Queue the slot from HC05_TxReserve() for transmission
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ * @param len: Bytes written into the slot; 0 leaves the slot free
+ */
+void HC05_TxCommit(HC05_HandleTypeDef *hc05, size_t len)
+{
+    if (hc05 == NULL || len == 0) {
+        return;
+    }
+
+    hc05->tx_len[hc05->tx_head % HC05_TX_SLOTS] =
+        (uint16_t)((len < HC05_TX_SLOT_SIZE) ? len : HC05_TX_SLOT_SIZE);
+
+    // Slot contents are complete before the head publishes them
+    __DMB();
+    hc05->tx_head++;
+
+    HC05_TxStart(hc05);
+}
+
+/**
+ * @brief Wait until every queued slot has been sent
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ * @param timeout: Timeout in milliseconds
+ * @retval HC05_StatusTypeDef: Operation status
+ */
+HC05_StatusTypeDef HC05_TxFlush(HC05_HandleTypeDef *hc05, uint32_t timeout)
+{
+    if (hc05 == NULL) {
+        return HC05_ERROR;
+    }
+
+    uint32_t start = HAL_GetTick();
+
+    while (hc05->tx_head != hc05->tx_tail) {
+        HC05_TxStart(hc05);
+        if (HAL_GetTick() - start > timeout) {
+            return HC05_TIMEOUT;
+        }
+    }
+
     return HC05_OK;
 }
 
 /**
  * @brief Receive data from HC-05
+ * @note  Copies the line; HC05_GetLine() avoids the copy
  * @param hc05: Pointer to HC05_HandleTypeDef structure
  * @param data: Buffer for received data
  * @param size: Buffer size
@@ -152,13 +317,18 @@ HC05_StatusTypeDef HC05_ReceiveData(HC05_HandleTypeDef *hc05, char *data, uint16
         return HC05_ERROR;
     }
 
-    if (hc05->data_received) {
-        uint16_t copy_size = (hc05->rx_index < size-1) ? hc05->rx_index : size-1;
-        memcpy(data, hc05->rx_buffer, copy_size);
+    char *line = HC05_GetLine(hc05);
+
+    if (line != NULL) {
+        size_t copy_size = strlen(line);
+
+        if (copy_size > (size_t)(size - 1)) {
+            copy_size = size - 1;
+        }
+        memcpy(data, line, copy_size);
         data[copy_size] = '\0';
 
-        // Reset buffer
-        HC05_ClearBuffer(hc05);
+        HC05_ReleaseLine(hc05);
 
         return HC05_OK;
     }
@@ -166,6 +336,54 @@ HC05_StatusTypeDef HC05_ReceiveData(HC05_HandleTypeDef *hc05, char *data, uint16
     return HC05_BUSY;
 }
 
+/**
+ * @brief Get the received line in place
+ * @note  Zero copy: the line stays in the driver's reception buffer, where
+ *        it may be modified (e.g. tokenized) until HC05_ReleaseLine().
+ *        Reception continues into the other buffer meanwhile
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ * @retval char*: Null-terminated line without its terminator, NULL if none is ready
+ */
+char *HC05_GetLine(HC05_HandleTypeDef *hc05)
+{
+    if (hc05 == NULL || !hc05->data_received) {
+        return NULL;
+    }
+
+    return hc05->rx_buffer[hc05->rx_fill ^ 1U];
+}
+
+/**
+ * @brief Hand the line from HC05_GetLine() back to the driver
+ * @note  A line completed meanwhile becomes the ready line and reception
+ *        restarts into the released buffer. Bytes that arrived during the
+ *        pause are lost; the overrun they latched is cleared first, or the
+ *        HAL would abort the restarted reception on it
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ */
+void HC05_ReleaseLine(HC05_HandleTypeDef *hc05)
+{
+    if (hc05 == NULL || !hc05->data_received) {
+        return;
+    }
+
+    // Interrupts masked: the receive handler must see one consistent state
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (hc05->rx_paused) {
+        hc05->rx_paused = 0;
+        hc05->rx_fill ^= 1U;
+        hc05->rx_index = 0;
+        __HAL_UART_CLEAR_OREFLAG(hc05->huart);
+        HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_fill][0], 1);
+    } else {
+        hc05->data_received = 0;
+    }
+
+    __set_PRIMASK(primask);
+}
+
 /**
  * @brief Set the device name of HC-05
  * @param hc05: Pointer to HC05_HandleTypeDef structure
@@ -321,6 +539,8 @@ uint8_t HC05_DataAvailable(HC05_HandleTypeDef *hc05)
 
 /**
  * @brief Clear the reception buffer
+ * @note  Drops the ready and the partial line. No memset: lines are null
+ *        terminated, bytes past the terminator are never read
  * @param hc05: Pointer to HC05_HandleTypeDef structure
  */
 void HC05_ClearBuffer(HC05_HandleTypeDef *hc05)
@@ -332,30 +552,35 @@ void HC05_ClearBuffer(HC05_HandleTypeDef *hc05)
     // Stop current reception
     HAL_UART_AbortReceive_IT(hc05->huart);
 
-    memset(hc05->rx_buffer, 0, HC05_BUFFER_SIZE);
     hc05->rx_index = 0;
+    hc05->rx_paused = 0;
     hc05->data_received = 0;
 
     // Restart interrupt reception
-    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_index], 1);
+    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_fill][0], 1);
 }
 
 /**
  * @brief UART interrupt handler for reception
+ * @note  Runs from SRAM (RAM_FUNC), once per received byte. A completed
+ *        line is handed over by switching buffers; if the application still
+ *        holds the other one, reception pauses until HC05_ReleaseLine()
  * @param hc05: Pointer to HC05_HandleTypeDef structure
  */
-void HC05_IRQHandler(HC05_HandleTypeDef *hc05)
+RAM_FUNC void HC05_IRQHandler(HC05_HandleTypeDef *hc05)
 {
     if (hc05 == NULL) {
         return;
     }
 
-    char received_char = hc05->rx_buffer[hc05->rx_index];
+    char *line = hc05->rx_buffer[hc05->rx_fill];
+    char received_char = line[hc05->rx_index];
+    uint8_t complete = 0;
 
     // Ignore unwanted control characters
     if (received_char == 0x01 || received_char == 0x00) {
         // Restart reception without incrementing index
-        HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_index], 1);
+        HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&line[hc05->rx_index], 1);
         return;
     }
 
@@ -366,27 +591,74 @@ void HC05_IRQHandler(HC05_HandleTypeDef *hc05)
     if (received_char == '\n' || received_char == '\r') {
         // Remove any termination characters from buffer
         while (hc05->rx_index > 0 &&
-               (hc05->rx_buffer[hc05->rx_index-1] == '\n' ||
-                hc05->rx_buffer[hc05->rx_index-1] == '\r')) {
+               (line[hc05->rx_index-1] == '\n' || line[hc05->rx_index-1] == '\r')) {
             hc05->rx_index--;
         }
 
-        // If we received at least one valid character
-        if (hc05->rx_index > 0) {
-            hc05->data_received = 1;
-            hc05->rx_buffer[hc05->rx_index] = '\0';
-        } else {
-            // Empty message, restart reception
-            HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_index], 1);
-        }
+        // Empty messages are dropped, reception just restarts
+        complete = (hc05->rx_index > 0);
     }
     // Check if buffer is full
     else if (hc05->rx_index >= HC05_BUFFER_SIZE-1) {
+        complete = 1;
+    }
+
+    if (complete) {
+        line[hc05->rx_index] = '\0';
+
+        if (hc05->data_received) {
+            hc05->rx_paused = 1;
+            return;
+        }
+
+        hc05->rx_fill ^= 1U;
+        hc05->rx_index = 0;
         hc05->data_received = 1;
-        hc05->rx_buffer[hc05->rx_index] = '\0';
     }
-    else {
-        // Continue receiving next character
-        HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_index], 1);
+
+    // Continue receiving next character
+    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_fill][hc05->rx_index], 1);
+}
+
+/**
+ * @brief UART interrupt handler for reception errors
+ * @note  Call from HAL_UART_ErrorCallback(). On an overrun the HAL has
+ *        already ended the reception; it restarts here, into the line
+ *        being filled. While paused for HC05_ReleaseLine() nothing is
+ *        restarted, the release does it
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ */
+void HC05_ErrorHandler(HC05_HandleTypeDef *hc05)
+{
+    if (hc05 == NULL || hc05->rx_paused || hc05->huart->RxState != HAL_UART_STATE_READY) {
+        return;
     }
+
+    __HAL_UART_CLEAR_OREFLAG(hc05->huart);
+    HAL_UART_Receive_IT(hc05->huart, (uint8_t*)&hc05->rx_buffer[hc05->rx_fill][hc05->rx_index], 1);
+}
+
+/**
+ * @brief UART interrupt handler for transmission complete
+ * @note  Call from HAL_UART_TxCpltCallback(); starts the next queued slot
+ * @param hc05: Pointer to HC05_HandleTypeDef structure
+ */
+void HC05_TxCpltHandler(HC05_HandleTypeDef *hc05)
+{
+    if (hc05 == NULL) {
+        return;
+    }
+
+    hc05->tx_tail++;
+
+    if (hc05->tx_head != hc05->tx_tail) {
+        uint8_t slot = hc05->tx_tail % HC05_TX_SLOTS;
+
+        if (HAL_UART_Transmit_IT(hc05->huart, (const uint8_t*)hc05->tx_slots[slot],
+                                 hc05->tx_len[slot]) == HAL_OK) {
+            return;
+        }
+    }
+
+    hc05->tx_busy = 0;
 }
@@ -9,16 +9,24 @@
 #define HC05_UART_TIMEOUT 1000
 #define HC05_BUFFER_SIZE 256
 #define HC05_AT_RESPONSE_SIZE 64
+#define HC05_TX_SLOTS 4                     // Transmit queue depth, a power of two
+#define HC05_TX_SLOT_SIZE 96                // Bytes per transmit slot (one reply line)
 
 // HC-05 driver structure
 typedef struct {
     UART_HandleTypeDef *huart;      // UART handle pointer
     GPIO_TypeDef *en_port;          // GPIO port for EN pin
     uint16_t en_pin;                // GPIO pin for EN control
-    char rx_buffer[HC05_BUFFER_SIZE]; // Reception buffer
-    char tx_buffer[HC05_BUFFER_SIZE]; // Transmission buffer
-    uint8_t data_received;          // Data received flag
+    char rx_buffer[2][HC05_BUFFER_SIZE]; // Reception lines: one ready, one filling
+    uint8_t rx_fill;                // Line being received; the ready line is the other one
+    volatile uint8_t data_received; // Data received flag: a line is ready
+    volatile uint8_t rx_paused;     // Line rx_fill is also complete, reception stopped
     uint16_t rx_index;              // Reception buffer index
+    char tx_slots[HC05_TX_SLOTS][HC05_TX_SLOT_SIZE]; // Transmit queue
+    uint16_t tx_len[HC05_TX_SLOTS]; // Bytes queued per slot
+    volatile uint8_t tx_head;       // Slots committed (free running)
+    volatile uint8_t tx_tail;       // Slots sent (free running)
+    volatile uint8_t tx_busy;       // Interrupt transmission in progress
 } HC05_HandleTypeDef;
 
 // HC-05 module states
@@ -42,7 +50,13 @@ HC05_StatusTypeDef HC05_SetMode(HC05_HandleTypeDef *hc05, HC05_ModeTypeDef mode)
 HC05_StatusTypeDef HC05_SendATCommand(HC05_HandleTypeDef *hc05, const char *command,
                                      char *response, uint32_t timeout);
 HC05_StatusTypeDef HC05_SendData(HC05_HandleTypeDef *hc05, const char *data);
+HC05_StatusTypeDef HC05_Write(HC05_HandleTypeDef *hc05, const char *data, size_t len);
+char *HC05_TxReserve(HC05_HandleTypeDef *hc05, size_t *size);
+void HC05_TxCommit(HC05_HandleTypeDef *hc05, size_t len);
+HC05_StatusTypeDef HC05_TxFlush(HC05_HandleTypeDef *hc05, uint32_t timeout);
 HC05_StatusTypeDef HC05_ReceiveData(HC05_HandleTypeDef *hc05, char *data, uint16_t size);
+char *HC05_GetLine(HC05_HandleTypeDef *hc05);
+void HC05_ReleaseLine(HC05_HandleTypeDef *hc05);
 HC05_StatusTypeDef HC05_SetName(HC05_HandleTypeDef *hc05, const char *name);
 HC05_StatusTypeDef HC05_SetPIN(HC05_HandleTypeDef *hc05, const char *pin);
 HC05_StatusTypeDef HC05_SetBaudRate(HC05_HandleTypeDef *hc05, uint32_t baudrate);
@@ -51,5 +65,7 @@ HC05_StatusTypeDef HC05_Reset(HC05_HandleTypeDef *hc05);
 uint8_t HC05_DataAvailable(HC05_HandleTypeDef *hc05);
 void HC05_ClearBuffer(HC05_HandleTypeDef *hc05);
 void HC05_IRQHandler(HC05_HandleTypeDef *hc05);
+void HC05_ErrorHandler(HC05_HandleTypeDef *hc05);
+void HC05_TxCpltHandler(HC05_HandleTypeDef *hc05);
 
 #endif /* HC05_DRIVER_H */
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""Static stack usage report for an STM32CubeIDE build directory.
+
+Reads the .su files that -fstack-usage (on in the generated makefiles)
+writes next to every object and lists the largest frames. When the build
+also used -fcallgraph-info=su (Debug configuration), the .ci call graphs
+are joined and the deepest call chain from main and from every interrupt
+handler is computed, then compared with _Min_Stack_Size from the linker
+script.
+
+    python3 tools/stack_usage.py Debug
+    python3 tools/stack_usage.py Debug --ld STM32F401RETX_FLASH.ld --top 20
+
+Limits of a static bound: recursion, indirect calls (function pointers,
+e.g. HAL callbacks) and library functions without stack information are
+reported but not counted, and dynamic (alloca/VLA) frames are counted at
+their fixed part only.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Cortex-M4F exception entry with lazy FPU stacking: 8 core + 18 FPU words
+EXCEPTION_FRAME = 104
+
+SU_LINE = re.compile(r"^(?P<file>.*?):(?P<line>\d+):(?P<col>\d+):(?P<func>[^\t]+)\t(?P<size>\d+)\t(?P<kind>\S+)")
+CI_NODE = re.compile(r'node: \{ title: "(?P<title>[^"]+)" label: "(?P<label>[^"]*)"')
+CI_EDGE = re.compile(r'edge: \{ sourcename: "(?P<src>[^"]+)" targetname: "(?P<dst>[^"]+)"')
+CI_SIZE = re.compile(r"\\n(?P<size>\d+) bytes \((?P<kind>[^)]+)\)")
+
+
+def find_files(build_dir, ext):
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            if name.endswith(ext):
+                yield os.path.join(root, name)
+
+
+def read_su(build_dir):
+    """Return [(size, kind, function, location)] from every .su file."""
+    frames = []
+    for path in find_files(build_dir, ".su"):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            for line in f:
+                m = SU_LINE.match(line)
+                if m:
+                    location = "%s:%s" % (os.path.basename(m.group("file")), m.group("line"))
+                    frames.append((int(m.group("size")), m.group("kind"), m.group("func"), location))
+    return frames
+
+
+def read_ci(build_dir):
+    """Return (frames, edges) keyed by call graph node title.
+
+    Static functions are titled "file:name", so equal names in two files
+    stay apart; external functions are titled by their plain name and get
+    their frame from the file that defines them.
+    """
+    frames = {}
+    edges = {}
+    for path in find_files(build_dir, ".ci"):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            for line in f:
+                m = CI_NODE.match(line)
+                if m:
+                    s = CI_SIZE.search(m.group("label"))
+                    if s:
+                        frames[m.group("title")] = (int(s.group("size")), s.group("kind"))
+                    continue
+                m = CI_EDGE.match(line)
+                if m:
+                    edges.setdefault(m.group("src"), set()).add(m.group("dst"))
+    return frames, edges
+
+
+def deepest(node, frames, edges, memo, active, notes):
+    """Deepest stack use starting at node: (bytes, chain)."""
+    if node in memo:
+        return memo[node]
+    if node in active:
+        notes.add("recursion through %s (not counted)" % node)
+        return 0, []
+    if node not in frames:
+        if node == "__indirect_call":
+            notes.add("indirect calls (not counted)")
+        else:
+            notes.add("no stack data: %s" % node)
+        return 0, []
+
+    active.add(node)
+    best = (0, [])
+    for callee in sorted(edges.get(node, ())):
+        depth = deepest(callee, frames, edges, memo, active, notes)
+        if depth[0] > best[0]:
+            best = depth
+    active.discard(node)
+
+    size, kind = frames[node]
+    if kind != "static":
+        notes.add("%s frame is %s" % (node, kind))
+    memo[node] = (size + best[0], [node] + best[1])
+    return memo[node]
+
+
+def linker_stack_size(path):
+    with open(path, encoding="utf-8", errors="replace") as f:
+        m = re.search(r"_Min_Stack_Size\s*=\s*(0x[0-9A-Fa-f]+|\d+)", f.read())
+    return int(m.group(1), 0) if m else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("build_dir", help="configuration output directory, e.g. Debug")
+    parser.add_argument("--ld", default="STM32F401RETX_FLASH.ld", help="linker script with _Min_Stack_Size")
+    parser.add_argument("--top", type=int, default=15, help="number of largest frames to list")
+    args = parser.parse_args()
+
+    su = read_su(args.build_dir)
+    if not su:
+        sys.exit("no .su files under %s: build the project first" % args.build_dir)
+
+    print("Largest frames (bytes, kind, function, location):")
+    for size, kind, func, location in sorted(su, reverse=True)[:args.top]:
+        print("  %6d  %-15s %-32s %s" % (size, kind, func, location))
+
+    frames, edges = read_ci(args.build_dir)
+    if not frames:
+        print("\nNo .ci files: add -fcallgraph-info=su for call chain depths")
+        return 0
+
+    # Entry points: main and the vector table handlers (handlers nothing calls)
+    called = set().union(*edges.values()) if edges else set()
+    roots = ["main"] + sorted(n for n in frames if n.endswith("Handler") and n not in called)
+    memo = {}
+    notes = set()
+    depths = {}
+    print("\nDeepest call chains (bytes):")
+    for root in roots:
+        if root in frames:
+            depths[root] = deepest(root, frames, edges, memo, set(), notes)
+            print("  %6d  %s" % (depths[root][0], " -> ".join(depths[root][1])))
+
+    thread = depths.get("main", (0, []))[0]
+    handler = max((d[0] for r, d in depths.items() if r != "main"), default=0)
+    worst = thread + handler + (EXCEPTION_FRAME if handler else 0)
+    print("\nWorst case: main %d + deepest handler %d + exception frame %d = %d bytes"
+          % (thread, handler, EXCEPTION_FRAME if handler else 0, worst))
+    print("  (interrupts of different priorities can nest and add up further)")
+
+    reserve = linker_stack_size(args.ld) if os.path.exists(args.ld) else None
+    if reserve is not None:
+        print("  _Min_Stack_Size %d bytes: %s" % (reserve, "OK" if worst <= reserve else "EXCEEDED"))
+
+    for note in sorted(notes):
+        print("  note: %s" % note)
+
+    return 1 if reserve is not None and worst > reserve else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,38 @@
+#ifndef ADC_CONTROL_H
+#define ADC_CONTROL_H
+
+#include "stm32f4xx_hal.h"
+#include "adc_profile.h"
+
+// Configuration definitions
+#define ADCCTL_CONV_TIMEOUT      10          // Conversion timeout in ms
+#define ADCCTL_VREFINT_SAMPLE    ADC_SAMPLETIME_480CYCLES  // >= 10 us at any profile clock
+
+// ADC control structure
+typedef struct {
+    ADC_HandleTypeDef *hadc;        // ADC handle pointer
+    uint32_t channel;               // Signal channel converted in rank 1
+    ADCPROF_IdTypeDef profile;      // Active acquisition profile
+    uint32_t vdda_mv;               // Last measured analog supply (mV)
+    uint32_t vref_period_ms;        // VREFINT measurement period (0 = manual only)
+    uint32_t vref_last_tick;        // Tick of the last VREFINT measurement
+} ADCCTL_HandleTypeDef;
+
+// ADC control states
+typedef enum {
+    ADCCTL_OK = 0,      // Operation successful
+    ADCCTL_ERROR = 1,   // Operation failed
+    ADCCTL_TIMEOUT = 2  // Conversion timeout
+} ADCCTL_StatusTypeDef;
+
+// Function prototypes
+ADCCTL_StatusTypeDef ADCCTL_Init(ADCCTL_HandleTypeDef *ctl, ADC_HandleTypeDef *hadc,
+                                 uint32_t channel, ADCPROF_IdTypeDef profile,
+                                 uint32_t vref_period_ms);
+ADCCTL_StatusTypeDef ADCCTL_SetProfile(ADCCTL_HandleTypeDef *ctl, ADCPROF_IdTypeDef profile);
+ADCCTL_StatusTypeDef ADCCTL_MeasureVdda(ADCCTL_HandleTypeDef *ctl);
+void ADCCTL_Poll(ADCCTL_HandleTypeDef *ctl);
+uint8_t ADCCTL_GetBits(const ADCCTL_HandleTypeDef *ctl);
+uint32_t ADCCTL_ToMillivolts(const ADCCTL_HandleTypeDef *ctl, uint16_t raw);
+
+#endif /* ADC_CONTROL_H */
@@ -0,0 +1,43 @@
+#ifndef ADC_PROFILE_H
+#define ADC_PROFILE_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define ADCPROF_ADC_CLOCK_MAX_HZ   36000000UL  // fADC limit for VDDA >= 2.4 V
+#define ADCPROF_NOMINAL_PCLK2_HZ   84000000UL  // PCLK2 the profile prescalers are chosen for
+#define ADCPROF_VREFINT_CAL_VREF   3300UL      // VDDA (mV) used for the factory VREFINT_CAL
+#define ADCPROF_VREFINT_TYP_MV     1210UL      // Typical VREFINT when no calibration is available
+
+// Acquisition profile identifiers
+typedef enum {
+    ADCPROF_FAST_6B = 0,    // 6-bit, shortest sample time
+    ADCPROF_FAST_8B,        // 8-bit, shortest sample time
+    ADCPROF_BALANCED,       // 12-bit, moderate sample time
+    ADCPROF_ACCURATE,       // 12-bit, longest sample time, slow ADC clock
+    ADCPROF_COUNT
+} ADCPROF_IdTypeDef;
+
+// Acquisition profile description (numeric values, no register encodings)
+typedef struct {
+    const char *name;           // Human readable name
+    uint8_t resolution_bits;    // 6, 8, 10 or 12
+    uint8_t sample_code;        // SMPx code 0..7 (3..480 ADC cycles)
+    uint8_t prescaler;          // PCLK2 divider at ADCPROF_NOMINAL_PCLK2_HZ: 2, 4, 6 or 8
+} ADCPROF_ProfileTypeDef;
+
+extern const ADCPROF_ProfileTypeDef ADCPROF_Profiles[ADCPROF_COUNT];
+
+// Function prototypes
+const ADCPROF_ProfileTypeDef *ADCPROF_Get(ADCPROF_IdTypeDef id);
+uint16_t ADCPROF_SampleCycles(const ADCPROF_ProfileTypeDef *profile);
+uint16_t ADCPROF_ConversionCycles(const ADCPROF_ProfileTypeDef *profile);
+uint8_t ADCPROF_Prescaler(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz);
+uint32_t ADCPROF_AdcClockHz(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz);
+uint32_t ADCPROF_ConversionTimeNs(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz);
+uint32_t ADCPROF_MaxSampleRate(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz);
+uint8_t ADCPROF_IsValid(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz);
+uint32_t ADCPROF_VddaMillivolts(uint16_t vrefint_raw, uint8_t bits, uint16_t vrefint_cal);
+uint32_t ADCPROF_ToMillivolts(uint16_t raw, uint8_t bits, uint32_t vdda_mv);
+
+#endif /* ADC_PROFILE_H */
@@ -0,0 +1,41 @@
+#ifndef CLOCK_CONTROL_H
+#define CLOCK_CONTROL_H
+
+#include "stm32f4xx_hal.h"
+#include "clock_profile.h"
+
+// Configuration definitions
+#define CLKCTL_MAX_UARTS        3           // UARTs kept at their baud rate
+#define CLKCTL_MAX_TIMERS       4           // Timers kept at their tick rate
+#define CLKCTL_TX_TIMEOUT       20          // ms to let a UART finish its last byte
+#define CLKCTL_VOS_TIMEOUT      2           // ms for the regulator to settle
+
+// Timer kept at a fixed counter rate across profile changes
+typedef struct {
+    TIM_TypeDef *instance;          // Timer registers
+    uint32_t tick_hz;               // Counter rate to keep
+} CLKCTL_TimerTypeDef;
+
+// Clock control structure
+typedef struct {
+    CLKPROF_IdTypeDef profile;                      // Active performance profile
+    UART_HandleTypeDef *uarts[CLKCTL_MAX_UARTS];    // BRR recomputed from Init.BaudRate
+    uint8_t uart_count;
+    CLKCTL_TimerTypeDef timers[CLKCTL_MAX_TIMERS];  // PSC recomputed from tick_hz
+    uint8_t timer_count;
+    uint32_t switches;                              // Successful profile changes
+} CLKCTL_HandleTypeDef;
+
+// Clock control states
+typedef enum {
+    CLKCTL_OK = 0,      // Operation successful
+    CLKCTL_ERROR = 1    // Operation failed
+} CLKCTL_StatusTypeDef;
+
+// Function prototypes
+CLKCTL_StatusTypeDef CLKCTL_Init(CLKCTL_HandleTypeDef *ctl);
+CLKCTL_StatusTypeDef CLKCTL_AddUart(CLKCTL_HandleTypeDef *ctl, UART_HandleTypeDef *huart);
+CLKCTL_StatusTypeDef CLKCTL_AddTimer(CLKCTL_HandleTypeDef *ctl, TIM_TypeDef *instance, uint32_t tick_hz);
+CLKCTL_StatusTypeDef CLKCTL_SetProfile(CLKCTL_HandleTypeDef *ctl, CLKPROF_IdTypeDef profile);
+
+#endif /* CLOCK_CONTROL_H */
@@ -0,0 +1,52 @@
+#ifndef CLOCK_PROFILE_H
+#define CLOCK_PROFILE_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define CLKPROF_HSI_HZ          16000000UL  // PLL input and direct SYSCLK source
+#define CLKPROF_PLL_M           16U         // HSI / 16 = 1 MHz VCO input
+#define CLKPROF_VCO_MIN_HZ      192000000UL // STM32F401 VCO output range
+#define CLKPROF_VCO_MAX_HZ      432000000UL
+#define CLKPROF_SYSCLK_MAX_HZ   84000000UL
+#define CLKPROF_PCLK1_MAX_HZ    42000000UL
+#define CLKPROF_PCLK2_MAX_HZ    84000000UL
+#define CLKPROF_HZ_PER_WS       30000000UL  // Flash wait state step, VDD 2.7-3.6 V
+#define CLKPROF_SCALE3_MAX_HZ   60000000UL  // HCLK limit of voltage scale 3
+
+// Performance profile identifiers
+typedef enum {
+    CLKPROF_LOW_POWER = 0,  // 16 MHz, HSI direct, PLL off
+    CLKPROF_BALANCED,       // 42 MHz, PLL
+    CLKPROF_MAX,            // 84 MHz, PLL (CubeMX SystemClock_Config)
+    CLKPROF_COUNT
+} CLKPROF_IdTypeDef;
+
+// Profile description (numeric values, no register encodings)
+typedef struct {
+    const char *name;           // Human readable name
+    uint16_t pll_n;             // VCO multiplier, 0 = HSI direct (PLL off)
+    uint8_t pll_p;              // SYSCLK divider 2, 4, 6 or 8
+    uint8_t ahb_div;            // HCLK = SYSCLK / ahb_div
+    uint8_t apb1_div;           // PCLK1 = HCLK / apb1_div
+    uint8_t apb2_div;           // PCLK2 = HCLK / apb2_div
+} CLKPROF_ProfileTypeDef;
+
+extern const CLKPROF_ProfileTypeDef CLKPROF_Profiles[CLKPROF_COUNT];
+
+// Function prototypes
+const CLKPROF_ProfileTypeDef *CLKPROF_Get(CLKPROF_IdTypeDef id);
+uint32_t CLKPROF_SysclkHz(const CLKPROF_ProfileTypeDef *profile);
+uint32_t CLKPROF_HclkHz(const CLKPROF_ProfileTypeDef *profile);
+uint32_t CLKPROF_Pclk1Hz(const CLKPROF_ProfileTypeDef *profile);
+uint32_t CLKPROF_Pclk2Hz(const CLKPROF_ProfileTypeDef *profile);
+uint32_t CLKPROF_TimerClockHz(const CLKPROF_ProfileTypeDef *profile, uint8_t apb2);
+uint8_t CLKPROF_FlashLatency(uint32_t hclk_hz);
+uint8_t CLKPROF_VoltageScale(uint32_t hclk_hz);
+uint8_t CLKPROF_IsValid(const CLKPROF_ProfileTypeDef *profile);
+uint16_t CLKPROF_UartBrr(uint32_t pclk_hz, uint32_t baud);
+int32_t CLKPROF_UartErrorPpm(uint32_t pclk_hz, uint32_t baud);
+uint16_t CLKPROF_TimerPrescaler(uint32_t timer_clock_hz, uint32_t tick_hz);
+uint32_t CLKPROF_SysTickReload(uint32_t hclk_hz, uint32_t tick_hz);
+
+#endif /* CLOCK_PROFILE_H */
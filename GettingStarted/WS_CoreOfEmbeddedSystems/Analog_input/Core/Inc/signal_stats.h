@@ -0,0 +1,60 @@
+#ifndef SIGNAL_STATS_H
+#define SIGNAL_STATS_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define STATS_MAX_WINDOW 4096U  // Largest supported window (ring positions are 16-bit)
+
+// Number of uint16_t words a channel needs for a given window length:
+// sample ring + monotonic min deque + monotonic max deque
+#define STATS_WORKSPACE_SIZE(window) (3U * (window))
+
+// Summary of the samples currently inside a channel window
+typedef struct {
+    uint16_t min;       // Smallest sample in the window
+    uint16_t max;       // Largest sample in the window
+    float mean;         // Arithmetic mean
+    float rms;          // Root mean square
+    float stddev;       // Population standard deviation
+    uint16_t count;     // Number of samples in the window
+} STATS_SummaryTypeDef;
+
+// Monotonic deque of ring positions (values are read from the sample ring)
+typedef struct {
+    uint16_t *pos;      // Ring positions, oldest at head
+    uint16_t head;      // Index of the oldest entry
+    uint16_t count;     // Number of entries
+} STATS_DequeTypeDef;
+
+// Statistics channel structure
+typedef struct {
+    uint16_t *samples;          // Sample ring (window entries)
+    STATS_DequeTypeDef min_q;   // Increasing values: head is the window minimum
+    STATS_DequeTypeDef max_q;   // Decreasing values: head is the window maximum
+    uint16_t window;            // Window length in samples
+    uint16_t count;             // Samples currently in the window
+    uint16_t write_pos;         // Next ring slot to be written
+    uint32_t sum;               // Exact running sum
+    uint64_t sum_sq;            // Exact running sum of squares
+    float mean;                 // Welford running mean
+    float m2;                   // Welford sum of squared deviations
+    float inv_window;           // 1/window, avoids a division per sample
+    uint16_t decimation;        // Report every N samples (0 = never)
+    uint16_t decim_count;       // Samples since the last report
+} STATS_ChannelTypeDef;
+
+// Statistics status
+typedef enum {
+    STATS_OK = 0,       // Operation successful
+    STATS_ERROR = 1     // Invalid parameter
+} STATS_StatusTypeDef;
+
+// Function prototypes
+STATS_StatusTypeDef STATS_Init(STATS_ChannelTypeDef *ch, uint16_t *workspace,
+                               uint16_t window, uint16_t decimation);
+void STATS_Reset(STATS_ChannelTypeDef *ch);
+uint8_t STATS_Update(STATS_ChannelTypeDef *ch, uint16_t sample);
+void STATS_GetSummary(const STATS_ChannelTypeDef *ch, STATS_SummaryTypeDef *summary);
+
+#endif /* SIGNAL_STATS_H */
@@ -0,0 +1,212 @@
+#include "adc_control.h"
+
+/**
+ * @brief Wait for the ADC analog part to stabilize after ADON is set
+ * @note  Same busy loop the HAL uses in HAL_ADC_Start()
+ */
+static void ADCCTL_StabilizationDelay(void)
+{
+    __IO uint32_t counter = ADC_STAB_DELAY_US * (SystemCoreClock / 1000000U);
+
+    while (counter != 0U) {
+        counter--;
+    }
+}
+
+/**
+ * @brief Reprogram resolution and ADC clock prescaler in place
+ * @note  The ADC is briefly powered down (ADON = 0) while CR1/CCR change,
+ *        which is much cheaper than HAL_ADC_DeInit()/HAL_ADC_Init()
+ * @param hadc: Pointer to ADC handle
+ * @param bits: Resolution (6, 8, 10 or 12)
+ * @param prescaler: PCLK2 divider (2, 4, 6 or 8)
+ */
+static void ADCCTL_ApplyClockAndResolution(ADC_HandleTypeDef *hadc, uint8_t bits, uint8_t prescaler)
+{
+    uint32_t res = ((uint32_t)(12U - bits) / 2U) << ADC_CR1_RES_Pos;
+    uint32_t pre = ((uint32_t)prescaler / 2U - 1U) << ADC_CCR_ADCPRE_Pos;
+
+    __HAL_ADC_DISABLE(hadc);
+
+    MODIFY_REG(hadc->Instance->CR1, ADC_CR1_RES, res);
+    MODIFY_REG(ADC_COMMON_REGISTER(hadc)->CCR, ADC_CCR_ADCPRE, pre);
+
+    __HAL_ADC_ENABLE(hadc);
+    ADCCTL_StabilizationDelay();
+
+    // Keep the HAL view of the configuration consistent
+    hadc->Init.Resolution = res;
+    hadc->Init.ClockPrescaler = pre;
+}
+
+/**
+ * @brief Select the channel converted in regular rank 1
+ * @param hadc: Pointer to ADC handle
+ * @param channel: ADC channel
+ * @param sample_time: ADC_SAMPLETIME_xCYCLES value
+ * @retval ADCCTL_StatusTypeDef: Operation status
+ */
+static ADCCTL_StatusTypeDef ADCCTL_SelectChannel(ADC_HandleTypeDef *hadc, uint32_t channel,
+                                                 uint32_t sample_time)
+{
+    ADC_ChannelConfTypeDef sConfig = {0};
+
+    sConfig.Channel = channel;
+    sConfig.Rank = 1;
+    sConfig.SamplingTime = sample_time;
+
+    return (HAL_ADC_ConfigChannel(hadc, &sConfig) == HAL_OK) ? ADCCTL_OK : ADCCTL_ERROR;
+}
+
+/**
+ * @brief Initialize the ADC controller on an already initialized ADC
+ * @param ctl: Pointer to ADCCTL_HandleTypeDef structure
+ * @param hadc: Pointer to ADC handle (initialized by MX_ADCx_Init)
+ * @param channel: Signal channel converted in rank 1
+ * @param profile: Initial acquisition profile
+ * @param vref_period_ms: VREFINT measurement period in ms (0 = manual only)
+ * @retval ADCCTL_StatusTypeDef: Operation status
+ */
+ADCCTL_StatusTypeDef ADCCTL_Init(ADCCTL_HandleTypeDef *ctl, ADC_HandleTypeDef *hadc,
+                                 uint32_t channel, ADCPROF_IdTypeDef profile,
+                                 uint32_t vref_period_ms)
+{
+    if (ctl == NULL || hadc == NULL) {
+        return ADCCTL_ERROR;
+    }
+
+    ctl->hadc = hadc;
+    ctl->channel = channel;
+    ctl->vdda_mv = ADCPROF_VREFINT_CAL_VREF;
+    ctl->vref_period_ms = vref_period_ms;
+
+    if (ADCCTL_SetProfile(ctl, profile) != ADCCTL_OK) {
+        return ADCCTL_ERROR;
+    }
+
+    ADCCTL_StatusTypeDef status = ADCCTL_MeasureVdda(ctl);
+    ctl->vref_last_tick = HAL_GetTick();
+
+    return status;
+}
+
+/**
+ * @brief Switch the acquisition profile at runtime
+ * @note  Must not be called while a conversion is in progress. Call it
+ *        again with the active profile after a system clock change: the
+ *        ADC prescaler is derived from the current PCLK2
+ * @param ctl: Pointer to ADCCTL_HandleTypeDef structure
+ * @param profile: Profile to activate
+ * @retval ADCCTL_StatusTypeDef: Operation status
+ */
+ADCCTL_StatusTypeDef ADCCTL_SetProfile(ADCCTL_HandleTypeDef *ctl, ADCPROF_IdTypeDef profile)
+{
+    if (ctl == NULL) {
+        return ADCCTL_ERROR;
+    }
+
+    const ADCPROF_ProfileTypeDef *p = ADCPROF_Get(profile);
+    if (p == NULL || !ADCPROF_IsValid(p, HAL_RCC_GetPCLK2Freq())) {
+        return ADCCTL_ERROR;
+    }
+
+    ADCCTL_ApplyClockAndResolution(ctl->hadc, p->resolution_bits, ADCPROF_Prescaler(p, HAL_RCC_GetPCLK2Freq()));
+
+    if (ADCCTL_SelectChannel(ctl->hadc, ctl->channel, p->sample_code) != ADCCTL_OK) {
+        return ADCCTL_ERROR;
+    }
+
+    ctl->profile = profile;
+
+    return ADCCTL_OK;
+}
+
+/**
+ * @brief Measure VREFINT and update the analog supply estimate
+ * @note  The measurement always runs at 12 bits; the active profile is
+ *        restored before returning
+ * @param ctl: Pointer to ADCCTL_HandleTypeDef structure
+ * @retval ADCCTL_StatusTypeDef: Operation status
+ */
+ADCCTL_StatusTypeDef ADCCTL_MeasureVdda(ADCCTL_HandleTypeDef *ctl)
+{
+    if (ctl == NULL) {
+        return ADCCTL_ERROR;
+    }
+
+    const ADCPROF_ProfileTypeDef *p = ADCPROF_Get(ctl->profile);
+    uint8_t prescaler = ADCPROF_Prescaler(p, HAL_RCC_GetPCLK2Freq());
+    ADCCTL_StatusTypeDef status = ADCCTL_OK;
+    uint16_t raw = 0;
+
+    if (p->resolution_bits != 12U) {
+        ADCCTL_ApplyClockAndResolution(ctl->hadc, 12, prescaler);
+    }
+
+    // Route VREFINT to rank 1 (HAL also sets TSVREFE for this channel)
+    if (ADCCTL_SelectChannel(ctl->hadc, ADC_CHANNEL_VREFINT, ADCCTL_VREFINT_SAMPLE) != ADCCTL_OK) {
+        status = ADCCTL_ERROR;
+    } else {
+        HAL_ADC_Start(ctl->hadc);
+        if (HAL_ADC_PollForConversion(ctl->hadc, ADCCTL_CONV_TIMEOUT) == HAL_OK) {
+            raw = (uint16_t)HAL_ADC_GetValue(ctl->hadc);
+        } else {
+            status = ADCCTL_TIMEOUT;
+        }
+    }
+
+    // Restore the signal channel and the profile resolution
+    if (p->resolution_bits != 12U) {
+        ADCCTL_ApplyClockAndResolution(ctl->hadc, p->resolution_bits, prescaler);
+    }
+    if (ADCCTL_SelectChannel(ctl->hadc, ctl->channel, p->sample_code) != ADCCTL_OK) {
+        status = ADCCTL_ERROR;
+    }
+
+    if (status == ADCCTL_OK) {
+        uint32_t vdda = ADCPROF_VddaMillivolts(raw, 12, *VREFINT_CAL_ADDR);
+        if (vdda != 0U) {
+            ctl->vdda_mv = vdda;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Periodic housekeeping: refresh VDDA when the period has elapsed
+ * @note  Call from the main loop between conversions
+ * @param ctl: Pointer to ADCCTL_HandleTypeDef structure
+ */
+void ADCCTL_Poll(ADCCTL_HandleTypeDef *ctl)
+{
+    if (ctl == NULL || ctl->vref_period_ms == 0U) {
+        return;
+    }
+
+    if (HAL_GetTick() - ctl->vref_last_tick >= ctl->vref_period_ms) {
+        ctl->vref_last_tick = HAL_GetTick();
+        ADCCTL_MeasureVdda(ctl);
+    }
+}
+
+/**
+ * @brief Get the resolution of the active profile
+ * @param ctl: Pointer to ADCCTL_HandleTypeDef structure
+ * @retval uint8_t: Resolution in bits
+ */
+uint8_t ADCCTL_GetBits(const ADCCTL_HandleTypeDef *ctl)
+{
+    return ADCPROF_Get(ctl->profile)->resolution_bits;
+}
+
+/**
+ * @brief Convert a signal conversion result to millivolts
+ * @param ctl: Pointer to ADCCTL_HandleTypeDef structure
+ * @param raw: Conversion result at the active profile resolution
+ * @retval uint32_t: Input voltage in millivolts
+ */
+uint32_t ADCCTL_ToMillivolts(const ADCCTL_HandleTypeDef *ctl, uint16_t raw)
+{
+    return ADCPROF_ToMillivolts(raw, ADCCTL_GetBits(ctl), ctl->vdda_mv);
+}
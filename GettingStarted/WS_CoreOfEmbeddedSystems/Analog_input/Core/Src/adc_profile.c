@@ -0,0 +1,167 @@
+#include "adc_profile.h"
+#include <stddef.h>
+
+// ADC sampling time in cycles for each SMPx code (RM0368, ADC_SMPRx)
+static const uint16_t adcprof_sample_cycles[8] = { 3, 15, 28, 56, 84, 112, 144, 480 };
+
+// Profile table: timings are derived from these values by the helpers below
+const ADCPROF_ProfileTypeDef ADCPROF_Profiles[ADCPROF_COUNT] = {
+    [ADCPROF_FAST_6B]  = { "fast6",    6,  0, 4 },  //   3 cycles, fADC = PCLK2/4
+    [ADCPROF_FAST_8B]  = { "fast8",    8,  0, 4 },  //   3 cycles, fADC = PCLK2/4
+    [ADCPROF_BALANCED] = { "balanced", 12, 2, 4 },  //  28 cycles, fADC = PCLK2/4
+    [ADCPROF_ACCURATE] = { "accurate", 12, 7, 8 },  // 480 cycles, fADC = PCLK2/8
+};
+
+/**
+ * @brief Get a profile description by identifier
+ * @param id: Profile identifier
+ * @retval const ADCPROF_ProfileTypeDef*: Profile, NULL if id is out of range
+ */
+const ADCPROF_ProfileTypeDef *ADCPROF_Get(ADCPROF_IdTypeDef id)
+{
+    if ((uint32_t)id >= ADCPROF_COUNT) {
+        return NULL;
+    }
+
+    return &ADCPROF_Profiles[id];
+}
+
+/**
+ * @brief Get the sampling phase length of a profile
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @retval uint16_t: Sampling time in ADC clock cycles
+ */
+uint16_t ADCPROF_SampleCycles(const ADCPROF_ProfileTypeDef *profile)
+{
+    return adcprof_sample_cycles[profile->sample_code & 0x7U];
+}
+
+/**
+ * @brief Get the total conversion length of a profile
+ * @note  tCONV = sampling time + one ADC cycle per bit of resolution
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @retval uint16_t: Conversion time in ADC clock cycles
+ */
+uint16_t ADCPROF_ConversionCycles(const ADCPROF_ProfileTypeDef *profile)
+{
+    return ADCPROF_SampleCycles(profile) + profile->resolution_bits;
+}
+
+/**
+ * @brief Get the PCLK2 divider that keeps the profile ADC clock at this PCLK2
+ * @note  Smallest divider whose ADC clock does not exceed the one the
+ *        profile has at ADCPROF_NOMINAL_PCLK2_HZ, so sample times never
+ *        get shorter than designed. With a slower PCLK2 the divider drops
+ *        (down to 2) and the ADC keeps its rate as far as possible
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @param pclk2_hz: APB2 clock frequency in Hz
+ * @retval uint8_t: Divider 2, 4, 6 or 8
+ */
+uint8_t ADCPROF_Prescaler(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz)
+{
+    uint32_t target_hz = ADCPROF_NOMINAL_PCLK2_HZ / profile->prescaler;
+
+    for (uint8_t div = 2; div < 8U; div += 2U) {
+        if (pclk2_hz / div <= target_hz) {
+            return div;
+        }
+    }
+
+    return 8;
+}
+
+/**
+ * @brief Get the ADC clock produced by a profile
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @param pclk2_hz: APB2 clock frequency in Hz
+ * @retval uint32_t: ADC clock frequency in Hz
+ */
+uint32_t ADCPROF_AdcClockHz(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz)
+{
+    return pclk2_hz / ADCPROF_Prescaler(profile, pclk2_hz);
+}
+
+/**
+ * @brief Get the duration of one conversion, rounded to the nearest ns
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @param pclk2_hz: APB2 clock frequency in Hz
+ * @retval uint32_t: Conversion time in nanoseconds (0 if pclk2_hz is 0)
+ */
+uint32_t ADCPROF_ConversionTimeNs(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz)
+{
+    if (pclk2_hz == 0U) {
+        return 0;
+    }
+
+    uint64_t pclk_cycles = (uint64_t)ADCPROF_ConversionCycles(profile) * ADCPROF_Prescaler(profile, pclk2_hz);
+    return (uint32_t)((pclk_cycles * 1000000000ULL + pclk2_hz / 2U) / pclk2_hz);
+}
+
+/**
+ * @brief Get the back-to-back conversion rate of a profile
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @param pclk2_hz: APB2 clock frequency in Hz
+ * @retval uint32_t: Samples per second (rounded down)
+ */
+uint32_t ADCPROF_MaxSampleRate(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz)
+{
+    uint32_t pclk_cycles = (uint32_t)ADCPROF_ConversionCycles(profile) * ADCPROF_Prescaler(profile, pclk2_hz);
+    return pclk2_hz / pclk_cycles;
+}
+
+/**
+ * @brief Check that a profile respects the ADC clock limit
+ * @param profile: Pointer to ADCPROF_ProfileTypeDef structure
+ * @param pclk2_hz: APB2 clock frequency in Hz
+ * @retval uint8_t: 1 if usable at this PCLK2, 0 otherwise
+ */
+uint8_t ADCPROF_IsValid(const ADCPROF_ProfileTypeDef *profile, uint32_t pclk2_hz)
+{
+    if (profile == NULL || profile->prescaler == 0U) {
+        return 0;
+    }
+
+    return (ADCPROF_AdcClockHz(profile, pclk2_hz) <= ADCPROF_ADC_CLOCK_MAX_HZ) ? 1U : 0U;
+}
+
+/**
+ * @brief Compute VDDA from a VREFINT conversion (integer math only)
+ * @note  VDDA = 3300 mV * VREFINT_CAL / VREFINT_DATA, with the conversion
+ *        first scaled to the 12-bit range used by the factory calibration
+ * @param vrefint_raw: VREFINT conversion result
+ * @param bits: Resolution of vrefint_raw (6, 8, 10 or 12)
+ * @param vrefint_cal: Factory calibration word (0 selects the typical value)
+ * @retval uint32_t: VDDA in millivolts, 0 if vrefint_raw is 0
+ */
+uint32_t ADCPROF_VddaMillivolts(uint16_t vrefint_raw, uint8_t bits, uint16_t vrefint_cal)
+{
+    if (vrefint_raw == 0U || bits == 0U || bits > 12U) {
+        return 0;
+    }
+
+    uint32_t raw12 = (uint32_t)vrefint_raw << (12U - bits);
+
+    if (vrefint_cal == 0U || vrefint_cal == 0xFFFFU) {
+        // No factory word: fall back to the typical VREFINT voltage
+        return (ADCPROF_VREFINT_TYP_MV * 4095UL + raw12 / 2U) / raw12;
+    }
+
+    return (ADCPROF_VREFINT_CAL_VREF * vrefint_cal + raw12 / 2U) / raw12;
+}
+
+/**
+ * @brief Convert a conversion result to millivolts (integer math only)
+ * @param raw: Conversion result
+ * @param bits: Resolution of raw (6, 8, 10 or 12)
+ * @param vdda_mv: Measured analog supply in millivolts
+ * @retval uint32_t: Input voltage in millivolts, rounded to nearest
+ */
+uint32_t ADCPROF_ToMillivolts(uint16_t raw, uint8_t bits, uint32_t vdda_mv)
+{
+    if (bits == 0U || bits > 12U) {
+        return 0;
+    }
+
+    uint32_t full_scale = (1UL << bits) - 1U;
+    return ((uint32_t)raw * vdda_mv + full_scale / 2U) / full_scale;
+}
@@ -0,0 +1,283 @@
+#include "clock_control.h"
+#include <string.h>
+
+/**
+ * @brief Map a numeric AHB divider to its RCC_SYSCLK_DIVx value
+ * @param div: 1, 2, 4, 8 or 16
+ * @retval uint32_t: RCC_SYSCLK_DIVx value
+ */
+static uint32_t CLKCTL_AhbDivider(uint8_t div)
+{
+    switch (div) {
+    case 2:  return RCC_SYSCLK_DIV2;
+    case 4:  return RCC_SYSCLK_DIV4;
+    case 8:  return RCC_SYSCLK_DIV8;
+    case 16: return RCC_SYSCLK_DIV16;
+    default: return RCC_SYSCLK_DIV1;
+    }
+}
+
+/**
+ * @brief Map a numeric APB divider to its RCC_HCLK_DIVx value
+ * @param div: 1, 2, 4, 8 or 16
+ * @retval uint32_t: RCC_HCLK_DIVx value
+ */
+static uint32_t CLKCTL_ApbDivider(uint8_t div)
+{
+    switch (div) {
+    case 2:  return RCC_HCLK_DIV2;
+    case 4:  return RCC_HCLK_DIV4;
+    case 8:  return RCC_HCLK_DIV8;
+    case 16: return RCC_HCLK_DIV16;
+    default: return RCC_HCLK_DIV1;
+    }
+}
+
+/**
+ * @brief Check whether a peripheral sits on APB2
+ * @param instance: USART or TIM register base
+ * @retval uint8_t: 1 for APB2, 0 for APB1
+ */
+static uint8_t CLKCTL_OnApb2(const void *instance)
+{
+    return ((uint32_t)instance >= APB2PERIPH_BASE && (uint32_t)instance < AHB1PERIPH_BASE) ? 1U : 0U;
+}
+
+/**
+ * @brief Get the running kernel clock of a timer
+ * @note  Read back from RCC, so it is right even after a failed switch
+ * @param instance: Timer registers
+ * @retval uint32_t: Timer clock in Hz
+ */
+static uint32_t CLKCTL_TimerClockHz(const TIM_TypeDef *instance)
+{
+    if (CLKCTL_OnApb2(instance)) {
+        uint32_t pclk2 = HAL_RCC_GetPCLK2Freq();
+        return ((RCC->CFGR & RCC_CFGR_PPRE2) == RCC_CFGR_PPRE2_DIV1) ? pclk2 : 2U * pclk2;
+    }
+
+    uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+    return ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1) ? pclk1 : 2U * pclk1;
+}
+
+/**
+ * @brief Wait until the registered UARTs have sent their last byte
+ * @note  A byte on the wire while the clock changes would be garbled
+ * @param ctl: Pointer to CLKCTL_HandleTypeDef structure
+ */
+static void CLKCTL_DrainUarts(const CLKCTL_HandleTypeDef *ctl)
+{
+    for (uint8_t i = 0; i < ctl->uart_count; i++) {
+        uint32_t start = HAL_GetTick();
+
+        while (__HAL_UART_GET_FLAG(ctl->uarts[i], UART_FLAG_TC) == RESET &&
+               HAL_GetTick() - start < CLKCTL_TX_TIMEOUT) {
+        }
+    }
+}
+
+/**
+ * @brief Bring the registered UARTs and timers back to their rates
+ * @note  Timer prescalers are preloaded: the new rate starts at the next
+ *        update event, so the running period is not cut short
+ * @param ctl: Pointer to CLKCTL_HandleTypeDef structure
+ */
+static void CLKCTL_RetunePeripherals(const CLKCTL_HandleTypeDef *ctl)
+{
+    for (uint8_t i = 0; i < ctl->uart_count; i++) {
+        UART_HandleTypeDef *huart = ctl->uarts[i];
+        uint32_t pclk = CLKCTL_OnApb2(huart->Instance) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+
+        __HAL_UART_DISABLE(huart);
+        huart->Instance->BRR = CLKPROF_UartBrr(pclk, huart->Init.BaudRate);
+        __HAL_UART_ENABLE(huart);
+    }
+
+    for (uint8_t i = 0; i < ctl->timer_count; i++) {
+        const CLKCTL_TimerTypeDef *t = &ctl->timers[i];
+
+        t->instance->PSC = CLKPROF_TimerPrescaler(CLKCTL_TimerClockHz(t->instance), t->tick_hz);
+    }
+}
+
+/**
+ * @brief Initialize clock control and identify the running profile
+ * @note  Call after SystemClock_Config(); fails if the clock tree does not
+ *        match one of the CLKPROF_Profiles
+ * @param ctl: Pointer to CLKCTL_HandleTypeDef structure
+ * @retval CLKCTL_StatusTypeDef: Operation status
+ */
+CLKCTL_StatusTypeDef CLKCTL_Init(CLKCTL_HandleTypeDef *ctl)
+{
+    if (ctl == NULL) {
+        return CLKCTL_ERROR;
+    }
+
+    memset(ctl, 0, sizeof(*ctl));
+
+    for (uint32_t id = 0; id < CLKPROF_COUNT; id++) {
+        const CLKPROF_ProfileTypeDef *p = CLKPROF_Get((CLKPROF_IdTypeDef)id);
+
+        if (HAL_RCC_GetHCLKFreq() == CLKPROF_HclkHz(p) &&
+            HAL_RCC_GetPCLK1Freq() == CLKPROF_Pclk1Hz(p) &&
+            HAL_RCC_GetPCLK2Freq() == CLKPROF_Pclk2Hz(p)) {
+            ctl->profile = (CLKPROF_IdTypeDef)id;
+            return CLKCTL_OK;
+        }
+    }
+
+    return CLKCTL_ERROR;
+}
+
+/**
+ * @brief Keep a UART at its baud rate across profile changes
+ * @param ctl: Pointer to CLKCTL_HandleTypeDef structure
+ * @param huart: Initialized UART with 16x oversampling
+ * @retval CLKCTL_StatusTypeDef: Operation status
+ */
+CLKCTL_StatusTypeDef CLKCTL_AddUart(CLKCTL_HandleTypeDef *ctl, UART_HandleTypeDef *huart)
+{
+    if (ctl == NULL || huart == NULL || ctl->uart_count >= CLKCTL_MAX_UARTS ||
+        huart->Init.OverSampling != UART_OVERSAMPLING_16) {
+        return CLKCTL_ERROR;
+    }
+
+    ctl->uarts[ctl->uart_count++] = huart;
+
+    return CLKCTL_OK;
+}
+
+/**
+ * @brief Keep a timer counting at a fixed rate across profile changes
+ * @note  The rate must be reachable exactly by the prescaler in every
+ *        profile, so a switch never changes it (1 MHz, 100 kHz, 10 kHz)
+ * @param ctl: Pointer to CLKCTL_HandleTypeDef structure
+ * @param instance: Timer registers (the timer is not otherwise touched)
+ * @param tick_hz: Counter rate to keep
+ * @retval CLKCTL_StatusTypeDef: Operation status
+ */
+CLKCTL_StatusTypeDef CLKCTL_AddTimer(CLKCTL_HandleTypeDef *ctl, TIM_TypeDef *instance, uint32_t tick_hz)
+{
+    if (ctl == NULL || instance == NULL || tick_hz == 0U || ctl->timer_count >= CLKCTL_MAX_TIMERS) {
+        return CLKCTL_ERROR;
+    }
+
+    for (uint32_t id = 0; id < CLKPROF_COUNT; id++) {
+        uint32_t clock = CLKPROF_TimerClockHz(CLKPROF_Get((CLKPROF_IdTypeDef)id), CLKCTL_OnApb2(instance));
+
+        if (clock % tick_hz != 0U || clock / tick_hz > 65536U) {
+            return CLKCTL_ERROR;
+        }
+    }
+
+    ctl->timers[ctl->timer_count].instance = instance;
+    ctl->timers[ctl->timer_count].tick_hz = tick_hz;
+    ctl->timer_count++;
+
+    return CLKCTL_OK;
+}
+
+/**
+ * @brief Switch the system clock to another performance profile
+ * @note  Sequence: drain the UARTs, run from HSI, stop the PLL, set the
+ *        regulator scale (only writable with the PLL off), restart the PLL
+ *        with the new dividers, then switch SYSCLK with the flash latency
+ *        of the new HCLK. HAL_RCC_ClockConfig() updates SystemCoreClock
+ *        and reloads SysTick, so HAL_GetTick() keeps counting
+ *        milliseconds. The registered UARTs and timers are retuned even
+ *        if a step fails, from the clock actually running. The ADC
+ *        prescaler belongs to adc_control: call ADCCTL_SetProfile() after
+ *        this. Call from thread context with no transfer in progress
+ * @param ctl: Pointer to CLKCTL_HandleTypeDef structure
+ * @param profile: Profile to activate
+ * @retval CLKCTL_StatusTypeDef: Operation status
+ */
+CLKCTL_StatusTypeDef CLKCTL_SetProfile(CLKCTL_HandleTypeDef *ctl, CLKPROF_IdTypeDef profile)
+{
+    if (ctl == NULL) {
+        return CLKCTL_ERROR;
+    }
+
+    const CLKPROF_ProfileTypeDef *p = CLKPROF_Get(profile);
+    if (p == NULL || !CLKPROF_IsValid(p)) {
+        return CLKCTL_ERROR;
+    }
+
+    uint32_t hclk = CLKPROF_HclkHz(p);
+    RCC_ClkInitTypeDef clk = {0};
+    CLKCTL_StatusTypeDef status = CLKCTL_OK;
+    uint32_t start;
+
+    CLKCTL_DrainUarts(ctl);
+
+    // Run from HSI, all buses undivided, current latency kept
+    clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+    clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+    clk.APB1CLKDivider = RCC_HCLK_DIV1;
+    clk.APB2CLKDivider = RCC_HCLK_DIV1;
+    if (HAL_RCC_ClockConfig(&clk, __HAL_FLASH_GET_LATENCY()) != HAL_OK) {
+        CLKCTL_RetunePeripherals(ctl);
+        return CLKCTL_ERROR;
+    }
+
+    __HAL_RCC_PLL_DISABLE();
+    start = HAL_GetTick();
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) != RESET) {
+        if (HAL_GetTick() - start > PLL_TIMEOUT_VALUE) {
+            CLKCTL_RetunePeripherals(ctl);
+            return CLKCTL_ERROR;
+        }
+    }
+
+    __HAL_PWR_VOLTAGESCALING_CONFIG(CLKPROF_VoltageScale(hclk) == 2U ? PWR_REGULATOR_VOLTAGE_SCALE2
+                                                                      : PWR_REGULATOR_VOLTAGE_SCALE3);
+
+    if (p->pll_n != 0U) {
+        RCC_OscInitTypeDef osc = {0};
+
+        osc.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+        osc.PLL.PLLState = RCC_PLL_ON;
+        osc.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+        osc.PLL.PLLM = CLKPROF_PLL_M;
+        osc.PLL.PLLN = p->pll_n;
+        osc.PLL.PLLP = p->pll_p;            // RCC_PLLP_DIVx values are the divider itself
+        osc.PLL.PLLQ = 7;
+        if (HAL_RCC_OscConfig(&osc) != HAL_OK) {
+            CLKCTL_RetunePeripherals(ctl);
+            return CLKCTL_ERROR;
+        }
+
+        // The new scale takes effect once the PLL runs
+        start = HAL_GetTick();
+        while ((PWR->CSR & PWR_CSR_VOSRDY) == 0U) {
+            if (HAL_GetTick() - start > CLKCTL_VOS_TIMEOUT) {
+                status = CLKCTL_ERROR;
+                break;
+            }
+        }
+
+        clk.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+    }
+
+    if (status == CLKCTL_OK) {
+        clk.AHBCLKDivider = CLKCTL_AhbDivider(p->ahb_div);
+        clk.APB1CLKDivider = CLKCTL_ApbDivider(p->apb1_div);
+        clk.APB2CLKDivider = CLKCTL_ApbDivider(p->apb2_div);
+        if (HAL_RCC_ClockConfig(&clk, CLKPROF_FlashLatency(hclk)) != HAL_OK) {
+            status = CLKCTL_ERROR;
+        }
+    }
+
+    CLKCTL_RetunePeripherals(ctl);
+
+    if (status == CLKCTL_OK) {
+        ctl->profile = profile;
+        ctl->switches++;
+    } else {
+        // Still on HSI: report what is actually running
+        ctl->profile = CLKPROF_LOW_POWER;
+    }
+
+    return status;
+}
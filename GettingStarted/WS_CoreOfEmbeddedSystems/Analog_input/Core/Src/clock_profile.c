@@ -0,0 +1,193 @@
+#include "clock_profile.h"
+#include <stddef.h>
+
+// Profile table: bus and peripheral clocks are derived from these values
+const CLKPROF_ProfileTypeDef CLKPROF_Profiles[CLKPROF_COUNT] = {
+    [CLKPROF_LOW_POWER] = { "low",      0,   2, 1, 1, 1 },  // HSI, 16/16/16 MHz
+    [CLKPROF_BALANCED]  = { "balanced", 336, 8, 1, 1, 1 },  // VCO 336 MHz / 8, 42/42/42 MHz
+    [CLKPROF_MAX]       = { "max",      336, 4, 1, 2, 1 },  // VCO 336 MHz / 4, 84/42/84 MHz
+};
+
+/**
+ * @brief Get a profile description by identifier
+ * @param id: Profile identifier
+ * @retval const CLKPROF_ProfileTypeDef*: Profile, NULL if id is out of range
+ */
+const CLKPROF_ProfileTypeDef *CLKPROF_Get(CLKPROF_IdTypeDef id)
+{
+    if ((uint32_t)id >= CLKPROF_COUNT) {
+        return NULL;
+    }
+
+    return &CLKPROF_Profiles[id];
+}
+
+/**
+ * @brief Get the system clock of a profile
+ * @param profile: Pointer to CLKPROF_ProfileTypeDef structure
+ * @retval uint32_t: SYSCLK in Hz
+ */
+uint32_t CLKPROF_SysclkHz(const CLKPROF_ProfileTypeDef *profile)
+{
+    if (profile->pll_n == 0U) {
+        return CLKPROF_HSI_HZ;
+    }
+
+    return CLKPROF_HSI_HZ / CLKPROF_PLL_M * profile->pll_n / profile->pll_p;
+}
+
+/**
+ * @brief Get the AHB (core, SysTick, flash) clock of a profile
+ * @param profile: Pointer to CLKPROF_ProfileTypeDef structure
+ * @retval uint32_t: HCLK in Hz
+ */
+uint32_t CLKPROF_HclkHz(const CLKPROF_ProfileTypeDef *profile)
+{
+    return CLKPROF_SysclkHz(profile) / profile->ahb_div;
+}
+
+/**
+ * @brief Get the APB1 clock of a profile (USART2, TIM2..5)
+ * @param profile: Pointer to CLKPROF_ProfileTypeDef structure
+ * @retval uint32_t: PCLK1 in Hz
+ */
+uint32_t CLKPROF_Pclk1Hz(const CLKPROF_ProfileTypeDef *profile)
+{
+    return CLKPROF_HclkHz(profile) / profile->apb1_div;
+}
+
+/**
+ * @brief Get the APB2 clock of a profile (ADC1, USART1/6, TIM1/9/10/11)
+ * @param profile: Pointer to CLKPROF_ProfileTypeDef structure
+ * @retval uint32_t: PCLK2 in Hz
+ */
+uint32_t CLKPROF_Pclk2Hz(const CLKPROF_ProfileTypeDef *profile)
+{
+    return CLKPROF_HclkHz(profile) / profile->apb2_div;
+}
+
+/**
+ * @brief Get the timer kernel clock of a profile
+ * @note  Timers run at twice PCLK when their APB divider is not 1
+ * @param profile: Pointer to CLKPROF_ProfileTypeDef structure
+ * @param apb2: 1 for a timer on APB2, 0 for APB1
+ * @retval uint32_t: Timer clock in Hz
+ */
+uint32_t CLKPROF_TimerClockHz(const CLKPROF_ProfileTypeDef *profile, uint8_t apb2)
+{
+    uint8_t div = apb2 ? profile->apb2_div : profile->apb1_div;
+    uint32_t pclk = apb2 ? CLKPROF_Pclk2Hz(profile) : CLKPROF_Pclk1Hz(profile);
+
+    return (div == 1U) ? pclk : 2U * pclk;
+}
+
+/**
+ * @brief Get the flash wait states needed at a given HCLK
+ * @param hclk_hz: AHB clock in Hz
+ * @retval uint8_t: Wait states (FLASH_LATENCY_x value)
+ */
+uint8_t CLKPROF_FlashLatency(uint32_t hclk_hz)
+{
+    return (uint8_t)((hclk_hz - 1U) / CLKPROF_HZ_PER_WS);
+}
+
+/**
+ * @brief Get the lowest-power regulator scale that supports a given HCLK
+ * @note  Scale 3 up to 60 MHz, scale 2 up to 84 MHz
+ * @param hclk_hz: AHB clock in Hz
+ * @retval uint8_t: Voltage scale 2 or 3
+ */
+uint8_t CLKPROF_VoltageScale(uint32_t hclk_hz)
+{
+    return (hclk_hz > CLKPROF_SCALE3_MAX_HZ) ? 2U : 3U;
+}
+
+/**
+ * @brief Check a profile against the VCO and bus clock limits
+ * @param profile: Pointer to CLKPROF_ProfileTypeDef structure
+ * @retval uint8_t: 1 if the profile can be applied, 0 otherwise
+ */
+uint8_t CLKPROF_IsValid(const CLKPROF_ProfileTypeDef *profile)
+{
+    if (profile == NULL || profile->ahb_div == 0U || profile->apb1_div == 0U || profile->apb2_div == 0U) {
+        return 0;
+    }
+
+    if (profile->pll_n != 0U) {
+        uint32_t vco = CLKPROF_HSI_HZ / CLKPROF_PLL_M * profile->pll_n;
+
+        if (vco < CLKPROF_VCO_MIN_HZ || vco > CLKPROF_VCO_MAX_HZ ||
+            profile->pll_p < 2U || profile->pll_p > 8U || (profile->pll_p & 1U) != 0U) {
+            return 0;
+        }
+    }
+
+    return (CLKPROF_SysclkHz(profile) <= CLKPROF_SYSCLK_MAX_HZ &&
+            CLKPROF_Pclk1Hz(profile) <= CLKPROF_PCLK1_MAX_HZ &&
+            CLKPROF_Pclk2Hz(profile) <= CLKPROF_PCLK2_MAX_HZ) ? 1U : 0U;
+}
+
+/**
+ * @brief Compute the USART BRR value for 16x oversampling
+ * @note  The divider is rounded to the nearest 1/16. The HAL
+ *        UART_BRR_SAMPLING16 macro truncates to 1/100 first, so it can
+ *        pick the step below; the baud error here is never larger
+ * @param pclk_hz: Clock of the APB the USART sits on
+ * @param baud: Baud rate
+ * @retval uint16_t: BRR register value
+ */
+uint16_t CLKPROF_UartBrr(uint32_t pclk_hz, uint32_t baud)
+{
+    return (uint16_t)((pclk_hz + baud / 2U) / baud);
+}
+
+/**
+ * @brief Get the baud rate error a BRR value leaves
+ * @param pclk_hz: Clock of the APB the USART sits on
+ * @param baud: Requested baud rate
+ * @retval int32_t: (actual - requested) / requested in parts per million
+ */
+int32_t CLKPROF_UartErrorPpm(uint32_t pclk_hz, uint32_t baud)
+{
+    uint16_t brr = CLKPROF_UartBrr(pclk_hz, baud);
+
+    if (brr == 0U) {
+        return INT32_MAX;
+    }
+
+    int64_t actual_x16 = (int64_t)pclk_hz * 16 / brr;        // Baud * 16, keeps the fraction
+
+    return (int32_t)((actual_x16 - (int64_t)baud * 16) * 1000000 / ((int64_t)baud * 16));
+}
+
+/**
+ * @brief Compute the timer prescaler for a counter tick rate
+ * @note  Exact only when tick_hz divides the timer clock and the divider
+ *        is at most 65536; CLKCTL_AddTimer() rejects other rates
+ * @param timer_clock_hz: Timer kernel clock (CLKPROF_TimerClockHz)
+ * @param tick_hz: Wanted counter rate
+ * @retval uint16_t: PSC register value, rounded to the nearest divider
+ */
+uint16_t CLKPROF_TimerPrescaler(uint32_t timer_clock_hz, uint32_t tick_hz)
+{
+    uint32_t div = (timer_clock_hz + tick_hz / 2U) / tick_hz;
+
+    if (div == 0U) {
+        div = 1;
+    } else if (div > 65536U) {
+        div = 65536;
+    }
+
+    return (uint16_t)(div - 1U);
+}
+
+/**
+ * @brief Compute the SysTick reload value for a tick rate
+ * @param hclk_hz: AHB clock in Hz (SysTick runs on HCLK)
+ * @param tick_hz: Tick rate, 1000 for the HAL 1 ms tick
+ * @retval uint32_t: SysTick LOAD value
+ */
+uint32_t CLKPROF_SysTickReload(uint32_t hclk_hz, uint32_t tick_hz)
+{
+    return hclk_hz / tick_hz - 1U;
+}
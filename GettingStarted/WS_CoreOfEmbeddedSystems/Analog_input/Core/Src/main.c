@@ -22,7 +22,9 @@
 #include <stdio.h>
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "signal_stats.h"
+#include "adc_control.h"
+#include "clock_control.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -32,7 +34,12 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-
+#define SAMPLE_PERIOD_MS    1     // ADC sampling period
+#define FAST_WINDOW         64    // Short window: tracks fast changes
+#define SLOW_WINDOW         1024  // Long window: noise floor and drift
+#define REPORT_DECIMATION   500   // One summary every 500 samples (0.5 s)
+#define VREFINT_PERIOD_MS   1000  // VDDA refresh period
+#define LONG_PRESS_MS       1000  // Button held this long switches the clock profile
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -47,7 +54,19 @@ UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
 uint16_t measure = 0;
-char msg[20];
+char msg[96];
+
+// Two views of the same ADC channel, each with its own sliding window
+STATS_ChannelTypeDef stats_fast;
+STATS_ChannelTypeDef stats_slow;
+uint16_t stats_fast_ws[STATS_WORKSPACE_SIZE(FAST_WINDOW)];
+uint16_t stats_slow_ws[STATS_WORKSPACE_SIZE(SLOW_WINDOW)];
+
+// Acquisition profile and VDDA compensation for the ADC1 signal channel
+ADCCTL_HandleTypeDef adc_ctl;
+
+// Performance profile (system clock) and the peripherals kept at their rates
+CLKCTL_HandleTypeDef clk_ctl;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -56,12 +75,50 @@ static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_ADC1_Init(void);
 /* USER CODE BEGIN PFP */
-
+static void ReportSummary(const char *name, const STATS_ChannelTypeDef *ch);
+static void ReportProfile(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/**
+  * @brief  Send the window summary of a statistics channel over UART2
+  * @note   Values are printed in tenths of a count to avoid float printf
+  * @param  name: channel label
+  * @param  ch: statistics channel
+  * @retval None
+  */
+static void ReportSummary(const char *name, const STATS_ChannelTypeDef *ch)
+{
+  STATS_SummaryTypeDef s;
+  int len;
+
+  STATS_GetSummary(ch, &s);
+  len = snprintf(msg, sizeof(msg), "%s n=%u min=%u max=%u mean=%lu rms=%lu sd=%lu (x0.1) ~%lu mV\r\n",
+                 name, s.count, s.min, s.max,
+                 (unsigned long)(s.mean * 10.0f + 0.5f),
+                 (unsigned long)(s.rms * 10.0f + 0.5f),
+                 (unsigned long)(s.stddev * 10.0f + 0.5f),
+                 (unsigned long)ADCCTL_ToMillivolts(&adc_ctl, (uint16_t)(s.mean + 0.5f)));
+  HAL_UART_Transmit(&huart2, (uint8_t*)msg, len, HAL_MAX_DELAY);
+}
 
+/**
+  * @brief  Send the active clock and acquisition profiles and VDDA over UART2
+  * @retval None
+  */
+static void ReportProfile(void)
+{
+  const ADCPROF_ProfileTypeDef *p = ADCPROF_Get(adc_ctl.profile);
+  int len;
+
+  len = snprintf(msg, sizeof(msg), "clock=%s %lu MHz profile=%s bits=%u tconv=%lu ns vdda=%lu mV\r\n",
+                 CLKPROF_Get(clk_ctl.profile)->name, (unsigned long)(HAL_RCC_GetHCLKFreq() / 1000000U),
+                 p->name, p->resolution_bits,
+                 (unsigned long)ADCPROF_ConversionTimeNs(p, HAL_RCC_GetPCLK2Freq()),
+                 (unsigned long)adc_ctl.vdda_mv);
+  HAL_UART_Transmit(&huart2, (uint8_t*)msg, len, HAL_MAX_DELAY);
+}
 /* USER CODE END 0 */
 
 /**
@@ -96,19 +153,60 @@ int main(void)
   MX_USART2_UART_Init();
   MX_ADC1_Init();
   /* USER CODE BEGIN 2 */
-
+  STATS_Init(&stats_fast, stats_fast_ws, FAST_WINDOW, REPORT_DECIMATION);
+  STATS_Init(&stats_slow, stats_slow_ws, SLOW_WINDOW, REPORT_DECIMATION);
+  CLKCTL_Init(&clk_ctl);
+  CLKCTL_AddUart(&clk_ctl, &huart2);
+  ADCCTL_Init(&adc_ctl, &hadc1, ADC_CHANNEL_0, ADCPROF_BALANCED, VREFINT_PERIOD_MS);
+  ReportProfile();
+  uint32_t next_sample = HAL_GetTick();
+  GPIO_PinState last_btn = GPIO_PIN_SET;
+  uint32_t press_tick = 0;
   /* USER CODE END 2 */
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-    HAL_ADC_Start(&hadc1);
-    HAL_ADC_PollForConversion(&hadc1, 20);
-    measure = HAL_ADC_GetValue(&hadc1);
-    sprintf(msg, "Value read: %hu\r\n", measure);
-    HAL_UART_Transmit(&huart2, (uint8_t*)msg, strlen(msg), HAL_MAX_DELAY);
-    HAL_Delay(50);
+    // Sample at a fixed rate and only send the decimated window summaries
+    if ((int32_t)(HAL_GetTick() - next_sample) >= 0) {
+      next_sample += SAMPLE_PERIOD_MS;
+
+      HAL_ADC_Start(&hadc1);
+      HAL_ADC_PollForConversion(&hadc1, 20);
+      measure = HAL_ADC_GetValue(&hadc1);
+
+      if (STATS_Update(&stats_fast, measure)) {
+        ReportSummary("fast", &stats_fast);
+      }
+      if (STATS_Update(&stats_slow, measure)) {
+        ReportSummary("slow", &stats_slow);
+      }
+
+      ADCCTL_Poll(&adc_ctl);
+    }
+
+    // User button (active low), acted on at release: a short press cycles
+    // the acquisition profiles, a long press the clock profiles
+    GPIO_PinState btn = HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin);
+    if (btn == GPIO_PIN_RESET && last_btn == GPIO_PIN_SET) {
+      press_tick = HAL_GetTick();
+    }
+    if (btn == GPIO_PIN_SET && last_btn == GPIO_PIN_RESET) {
+      if (HAL_GetTick() - press_tick >= LONG_PRESS_MS) {
+        // UART2 baud and SysTick are retuned by the switch, the ADC
+        // prescaler follows the new PCLK2 here
+        CLKCTL_SetProfile(&clk_ctl, (CLKPROF_IdTypeDef)((clk_ctl.profile + 1) % CLKPROF_COUNT));
+        ADCCTL_SetProfile(&adc_ctl, adc_ctl.profile);
+      } else {
+        ADCCTL_SetProfile(&adc_ctl, (ADCPROF_IdTypeDef)((adc_ctl.profile + 1) % ADCPROF_COUNT));
+        // Windows hold counts of the previous resolution: start over
+        STATS_Reset(&stats_fast);
+        STATS_Reset(&stats_slow);
+      }
+      ReportProfile();
+    }
+    last_btn = btn;
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
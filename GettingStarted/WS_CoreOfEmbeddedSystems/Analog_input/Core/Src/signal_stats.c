@@ -0,0 +1,212 @@
+#include "signal_stats.h"
+#include "ram_func.h"
+#include <math.h>
+#include <stddef.h>
+
+/**
+ * @brief Get the ring position of the newest deque entry
+ * @param q: Pointer to STATS_DequeTypeDef structure
+ * @param size: Deque capacity (window length)
+ * @retval uint16_t: Index of the tail entry inside q->pos
+ */
+static inline uint16_t STATS_DequeTail(const STATS_DequeTypeDef *q, uint16_t size)
+{
+    uint32_t idx = (uint32_t)q->head + q->count - 1U;
+    return (uint16_t)((idx >= size) ? idx - size : idx);
+}
+
+/**
+ * @brief Append a ring position at the deque tail
+ * @param q: Pointer to STATS_DequeTypeDef structure
+ * @param size: Deque capacity (window length)
+ * @param pos: Ring position to append
+ */
+static inline void STATS_DequePush(STATS_DequeTypeDef *q, uint16_t size, uint16_t pos)
+{
+    uint32_t idx = (uint32_t)q->head + q->count;
+    q->pos[(idx >= size) ? idx - size : idx] = pos;
+    q->count++;
+}
+
+/**
+ * @brief Drop the deque head if it refers to the ring slot being overwritten
+ * @param q: Pointer to STATS_DequeTypeDef structure
+ * @param size: Deque capacity (window length)
+ * @param pos: Ring position leaving the window
+ */
+static inline void STATS_DequeExpire(STATS_DequeTypeDef *q, uint16_t size, uint16_t pos)
+{
+    if (q->count > 0U && q->pos[q->head] == pos) {
+        q->head = (q->head + 1U >= size) ? 0U : q->head + 1U;
+        q->count--;
+    }
+}
+
+/**
+ * @brief Re-seed the Welford accumulators from the exact integer sums
+ * @note  Called once per window wrap so float rounding cannot drift unbounded
+ * @param ch: Pointer to STATS_ChannelTypeDef structure
+ */
+static void STATS_Resync(STATS_ChannelTypeDef *ch)
+{
+    uint64_t n = ch->count;
+    uint64_t spread = n * ch->sum_sq - (uint64_t)ch->sum * ch->sum;
+
+    ch->mean = (float)ch->sum / (float)n;
+    ch->m2 = (float)spread / (float)n;
+}
+
+/**
+ * @brief Initialize a statistics channel
+ * @param ch: Pointer to STATS_ChannelTypeDef structure
+ * @param workspace: Buffer of STATS_WORKSPACE_SIZE(window) words
+ * @param window: Sliding window length in samples (1..STATS_MAX_WINDOW)
+ * @param decimation: Report a summary every N samples (0 = never)
+ * @retval STATS_StatusTypeDef: Operation status
+ */
+STATS_StatusTypeDef STATS_Init(STATS_ChannelTypeDef *ch, uint16_t *workspace,
+                               uint16_t window, uint16_t decimation)
+{
+    if (ch == NULL || workspace == NULL || window == 0U || window > STATS_MAX_WINDOW) {
+        return STATS_ERROR;
+    }
+
+    ch->samples = workspace;
+    ch->min_q.pos = workspace + window;
+    ch->max_q.pos = workspace + 2U * window;
+    ch->window = window;
+    ch->inv_window = 1.0f / (float)window;
+    ch->decimation = decimation;
+
+    STATS_Reset(ch);
+
+    return STATS_OK;
+}
+
+/**
+ * @brief Discard all samples of a channel, keeping its configuration
+ * @param ch: Pointer to STATS_ChannelTypeDef structure
+ */
+void STATS_Reset(STATS_ChannelTypeDef *ch)
+{
+    if (ch == NULL) {
+        return;
+    }
+
+    ch->count = 0;
+    ch->write_pos = 0;
+    ch->sum = 0;
+    ch->sum_sq = 0;
+    ch->mean = 0.0f;
+    ch->m2 = 0.0f;
+    ch->decim_count = 0;
+    ch->min_q.head = 0;
+    ch->min_q.count = 0;
+    ch->max_q.head = 0;
+    ch->max_q.count = 0;
+}
+
+/**
+ * @brief Push one sample into the channel window
+ * @note  Constant time except for the amortized O(1) deque pops
+ * @param ch: Pointer to STATS_ChannelTypeDef structure
+ * @param sample: New sample value
+ * @retval uint8_t: 1 if a decimated summary is due, 0 otherwise
+ */
+RAM_FUNC uint8_t STATS_Update(STATS_ChannelTypeDef *ch, uint16_t sample)
+{
+    if (ch == NULL) {
+        return 0;
+    }
+
+    const uint16_t size = ch->window;
+    const uint16_t pos = ch->write_pos;
+    float x = (float)sample;
+
+    if (ch->count == size) {
+        // Window full: the oldest sample sits in the slot about to be overwritten
+        uint16_t old = ch->samples[pos];
+        float y = (float)old;
+        float delta = x - y;
+        float old_mean = ch->mean;
+
+        STATS_DequeExpire(&ch->min_q, size, pos);
+        STATS_DequeExpire(&ch->max_q, size, pos);
+
+        ch->sum = ch->sum - old + sample;
+        ch->sum_sq = ch->sum_sq - (uint32_t)old * old + (uint32_t)sample * sample;
+
+        // Sliding-window Welford update (one sample in, one out)
+        ch->mean = old_mean + delta * ch->inv_window;
+        ch->m2 += delta * (x - ch->mean + y - old_mean);
+        if (ch->m2 < 0.0f) {
+            ch->m2 = 0.0f;
+        }
+    } else {
+        // Window still filling: classic Welford update
+        float delta = x - ch->mean;
+
+        ch->count++;
+        ch->sum += sample;
+        ch->sum_sq += (uint32_t)sample * sample;
+        ch->mean += delta / (float)ch->count;
+        ch->m2 += delta * (x - ch->mean);
+    }
+
+    ch->samples[pos] = sample;
+
+    // Keep the min deque increasing and the max deque decreasing
+    while (ch->min_q.count > 0U &&
+           ch->samples[ch->min_q.pos[STATS_DequeTail(&ch->min_q, size)]] >= sample) {
+        ch->min_q.count--;
+    }
+    STATS_DequePush(&ch->min_q, size, pos);
+
+    while (ch->max_q.count > 0U &&
+           ch->samples[ch->max_q.pos[STATS_DequeTail(&ch->max_q, size)]] <= sample) {
+        ch->max_q.count--;
+    }
+    STATS_DequePush(&ch->max_q, size, pos);
+
+    // Advance the ring and re-seed the float accumulators on every wrap
+    ch->write_pos = (pos + 1U >= size) ? 0U : pos + 1U;
+    if (ch->write_pos == 0U && ch->count == size) {
+        STATS_Resync(ch);
+    }
+
+    if (ch->decimation != 0U && ++ch->decim_count >= ch->decimation) {
+        ch->decim_count = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Compute the summary of the samples currently in the window
+ * @param ch: Pointer to STATS_ChannelTypeDef structure
+ * @param summary: Pointer to the summary to fill
+ */
+void STATS_GetSummary(const STATS_ChannelTypeDef *ch, STATS_SummaryTypeDef *summary)
+{
+    if (ch == NULL || summary == NULL) {
+        return;
+    }
+
+    summary->count = ch->count;
+
+    if (ch->count == 0U) {
+        summary->min = 0;
+        summary->max = 0;
+        summary->mean = 0.0f;
+        summary->rms = 0.0f;
+        summary->stddev = 0.0f;
+        return;
+    }
+
+    summary->min = ch->samples[ch->min_q.pos[ch->min_q.head]];
+    summary->max = ch->samples[ch->max_q.pos[ch->max_q.head]];
+    summary->mean = ch->mean;
+    summary->rms = sqrtf((float)ch->sum_sq / (float)ch->count);
+    summary->stddev = sqrtf(ch->m2 / (float)ch->count);
+}
@@ -0,0 +1,52 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+// Configuration definitions
+// Backend selection (build flags):
+//   default      DWT->CYCCNT with interrupts masked (PRIMASK), unit = core cycles
+//   BENCH_HOST   clock_gettime(CLOCK_MONOTONIC), unit = ns, for host comparisons
+#define BENCH_MAX_REPS      101     // Upper bound on repetitions per case (odd: exact median)
+#define BENCH_DEFAULT_REPS  31      // Used when a case leaves reps at 0
+#define BENCH_WARMUP        3       // Untimed runs before the timed ones (caches, flash prefetch)
+#define BENCH_LINE_SIZE     96      // Longest output line
+
+// Benchmark case
+typedef struct {
+    const char *name;               // Case name (no commas, printed as-is)
+    void (*setup)(void *ctx);       // Untimed, before every run; may be NULL
+    void (*run)(void *ctx);         // Code under test
+    void *ctx;                      // Passed to setup and run
+    uint16_t reps;                  // Timed repetitions, 0 = BENCH_DEFAULT_REPS
+} BENCH_CaseTypeDef;
+
+// Benchmark result, overhead already subtracted
+typedef struct {
+    uint32_t min;                   // Fastest run
+    uint32_t median;                // Median run
+    uint32_t max;                   // Slowest run
+    uint16_t reps;                  // Timed repetitions
+} BENCH_ResultTypeDef;
+
+// Line sink, receives one line without terminator
+typedef void (*BENCH_OutputTypeDef)(const char *line);
+
+// Benchmark states
+typedef enum {
+    BENCH_OK = 0,       // Operation successful
+    BENCH_ERROR = 1     // Operation failed
+} BENCH_StatusTypeDef;
+
+// Function prototypes
+void BENCH_Init(BENCH_OutputTypeDef output);
+uint32_t BENCH_GetHz(void);
+uint32_t BENCH_GetOverhead(void);
+BENCH_StatusTypeDef BENCH_Run(const BENCH_CaseTypeDef *bench, BENCH_ResultTypeDef *result);
+void BENCH_RunAll(const BENCH_CaseTypeDef *table, uint32_t count);
+
+// Case table (bench_cases.c)
+extern const BENCH_CaseTypeDef BENCH_Cases[];
+extern const uint32_t BENCH_CaseCount;
+
+#endif /* BENCH_H */
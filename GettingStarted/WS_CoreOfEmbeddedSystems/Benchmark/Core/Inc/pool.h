@@ -0,0 +1,65 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Configuration definitions
+// Size classes, ascending. Block sizes are multiples of POOL_ALIGN; the
+// storage of all classes is placed in the .pool linker section.
+#define POOL_CLASS_COUNT    5
+#define POOL_ALIGN          8       // Block alignment, as malloc guarantees
+#define POOL_SIZE_0         16      // Block size (bytes) and block count per class
+#define POOL_COUNT_0        32
+#define POOL_SIZE_1         32
+#define POOL_COUNT_1        16
+#define POOL_SIZE_2         64
+#define POOL_COUNT_2        16
+#define POOL_SIZE_3         256
+#define POOL_COUNT_3        4
+#define POOL_SIZE_4         1024    // One stdio buffer (BUFSIZ)
+#define POOL_COUNT_4        1
+
+// Build flags:
+//   POOL_MALLOC    route malloc, free, calloc and realloc (and newlib's
+//                  reentrant _r forms, used by stdio) to the pools; target
+//                  builds only
+
+// Block size class
+typedef struct {
+    uint8_t *base;                  // First block
+    uint8_t *end;                   // Past the last block
+    uint16_t size;                  // Block size
+    uint16_t count;                 // Number of blocks
+    void *free_list;                // Returned blocks, linked through their first word
+    uint16_t fresh;                 // Blocks never handed out start at base + fresh * size
+    uint16_t used;                  // Blocks currently allocated
+    uint16_t high_water;            // Largest used since the last reset
+    uint32_t failures;              // Requests this class could not serve
+} POOL_ClassTypeDef;
+
+// Usage statistics of one class
+typedef struct {
+    uint16_t size;                  // Block size
+    uint16_t count;                 // Number of blocks
+    uint16_t used;                  // Blocks currently allocated
+    uint16_t high_water;            // Largest used since the last reset
+    uint32_t failures;              // Requests this class could not serve
+} POOL_StatsTypeDef;
+
+// Pool states
+typedef enum {
+    POOL_OK = 0,        // Operation successful
+    POOL_ERROR = 1      // Operation failed
+} POOL_StatusTypeDef;
+
+// Function prototypes
+void POOL_Init(void);
+void *POOL_Alloc(size_t size);
+void POOL_Free(void *ptr);
+void *POOL_AllocSafe(size_t size);
+void POOL_FreeSafe(void *ptr);
+size_t POOL_BlockSize(const void *ptr);
+POOL_StatusTypeDef POOL_GetStats(uint8_t cls, POOL_StatsTypeDef *stats);
+
+#endif /* POOL_H */
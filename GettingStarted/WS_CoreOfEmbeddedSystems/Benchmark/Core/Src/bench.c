@@ -0,0 +1,239 @@
+#include "bench.h"
+#include <stddef.h>
+#include <stdio.h>
+
+#if defined(BENCH_HOST)
+#include <time.h>
+#define BENCH_UNIT "ns"
+#else
+#include "stm32f4xx_hal.h"
+#define BENCH_UNIT "cycles"
+#endif
+
+static BENCH_OutputTypeDef bench_output;    // Line sink, NULL = silent
+static uint32_t bench_hz;                   // Timer ticks per second
+static uint32_t bench_overhead;             // Cost of an empty measurement
+static uint32_t bench_samples[BENCH_MAX_REPS];
+
+/**
+ * @brief Read the benchmark timer
+ * @retval uint32_t: Current tick (wraps, only differences are meaningful)
+ */
+static inline uint32_t BENCH_Now(void)
+{
+#if defined(BENCH_HOST)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/**
+ * @brief Empty case, used to calibrate the measurement overhead
+ * @param ctx: Unused
+ */
+static void BENCH_Empty(void *ctx)
+{
+    (void)ctx;
+}
+
+/**
+ * @brief Time one run of a case
+ * @note  The setup hook runs first, outside the timed window. On target the
+ *        timed window runs with PRIMASK set, so no interrupt can land in it;
+ *        code under test must not wait on an interrupt
+ * @param bench: Case to run
+ * @retval uint32_t: Elapsed ticks, overhead not subtracted
+ */
+static uint32_t BENCH_Measure(const BENCH_CaseTypeDef *bench)
+{
+    uint32_t start;
+    uint32_t stop;
+
+    if (bench->setup != NULL) {
+        bench->setup(bench->ctx);
+    }
+
+#if defined(BENCH_HOST)
+    start = BENCH_Now();
+    bench->run(bench->ctx);
+    stop = BENCH_Now();
+#else
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    start = BENCH_Now();
+    bench->run(bench->ctx);
+    stop = BENCH_Now();
+    __set_PRIMASK(primask);
+#endif
+
+    return stop - start;
+}
+
+/**
+ * @brief Sort samples in place, ascending
+ * @note  Insertion sort: at most BENCH_MAX_REPS entries, mostly near-sorted
+ * @param samples: Samples to sort
+ * @param count: Number of samples
+ */
+static void BENCH_Sort(uint32_t *samples, uint32_t count)
+{
+    for (uint32_t i = 1; i < count; i++) {
+        uint32_t value = samples[i];
+        uint32_t j = i;
+
+        while (j > 0U && samples[j - 1U] > value) {
+            samples[j] = samples[j - 1U];
+            j--;
+        }
+        samples[j] = value;
+    }
+}
+
+/**
+ * @brief Warm up, time and summarize a case
+ * @param bench: Case to run
+ * @param overhead: Ticks to subtract from every sample
+ * @param result: Pointer to the result to fill
+ */
+static void BENCH_Collect(const BENCH_CaseTypeDef *bench, uint32_t overhead,
+                          BENCH_ResultTypeDef *result)
+{
+    uint32_t reps = (bench->reps == 0U) ? BENCH_DEFAULT_REPS : bench->reps;
+
+    if (reps > BENCH_MAX_REPS) {
+        reps = BENCH_MAX_REPS;
+    }
+
+    for (uint32_t i = 0; i < BENCH_WARMUP; i++) {
+        (void)BENCH_Measure(bench);
+    }
+
+    for (uint32_t i = 0; i < reps; i++) {
+        uint32_t ticks = BENCH_Measure(bench);
+        bench_samples[i] = (ticks > overhead) ? ticks - overhead : 0U;
+    }
+
+    BENCH_Sort(bench_samples, reps);
+
+    result->min = bench_samples[0];
+    result->median = bench_samples[reps / 2U];
+    result->max = bench_samples[reps - 1U];
+    result->reps = (uint16_t)reps;
+}
+
+/**
+ * @brief Send one line to the output sink
+ * @param line: Line without terminator
+ */
+static void BENCH_Print(const char *line)
+{
+    if (bench_output != NULL) {
+        bench_output(line);
+    }
+}
+
+/**
+ * @brief Initialize the harness and calibrate the measurement overhead
+ * @note  Call after SystemClock_Config, and again after any clock change
+ * @param output: Line sink for BENCH_RunAll, may be NULL
+ */
+void BENCH_Init(BENCH_OutputTypeDef output)
+{
+    static const BENCH_CaseTypeDef empty = { "overhead", NULL, BENCH_Empty, NULL, BENCH_MAX_REPS };
+    BENCH_ResultTypeDef result;
+
+    bench_output = output;
+
+#if defined(BENCH_HOST)
+    bench_hz = 1000000000UL;
+#else
+    bench_hz = HAL_RCC_GetHCLKFreq();
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    // The median of an empty case is the fixed cost of the timed window
+    BENCH_Collect(&empty, 0, &result);
+    bench_overhead = result.median;
+}
+
+/**
+ * @brief Get the timer rate
+ * @retval uint32_t: Ticks per second (core clock on target, 1 GHz on host)
+ */
+uint32_t BENCH_GetHz(void)
+{
+    return bench_hz;
+}
+
+/**
+ * @brief Get the calibrated measurement overhead
+ * @retval uint32_t: Ticks subtracted from every sample
+ */
+uint32_t BENCH_GetOverhead(void)
+{
+    return bench_overhead;
+}
+
+/**
+ * @brief Run one case
+ * @param bench: Case to run
+ * @param result: Pointer to the result to fill
+ * @retval BENCH_StatusTypeDef: Operation status
+ */
+BENCH_StatusTypeDef BENCH_Run(const BENCH_CaseTypeDef *bench, BENCH_ResultTypeDef *result)
+{
+    if (bench == NULL || bench->run == NULL || result == NULL) {
+        return BENCH_ERROR;
+    }
+
+    BENCH_Collect(bench, bench_overhead, result);
+
+    return BENCH_OK;
+}
+
+/**
+ * @brief Run a case table and print the results
+ * @note  Output format, one record per line:
+ *          # bench,hz=<hz>,unit=<cycles|ns>,overhead=<ticks>,warmup=<n>
+ *          BENCH,<name>,<reps>,<min>,<median>,<max>
+ *          # end,cases=<n>
+ *        Lines starting with '#' are metadata; a case that cannot run is
+ *        reported as BENCH,<name>,0,0,0,0
+ * @param table: Case table
+ * @param count: Number of cases
+ */
+void BENCH_RunAll(const BENCH_CaseTypeDef *table, uint32_t count)
+{
+    char line[BENCH_LINE_SIZE];
+    BENCH_ResultTypeDef result;
+
+    snprintf(line, sizeof(line), "# bench,hz=%lu,unit=%s,overhead=%lu,warmup=%u",
+             (unsigned long)bench_hz, BENCH_UNIT, (unsigned long)bench_overhead,
+             (unsigned int)BENCH_WARMUP);
+    BENCH_Print(line);
+
+    for (uint32_t i = 0; table != NULL && i < count; i++) {
+        if (BENCH_Run(&table[i], &result) != BENCH_OK) {
+            result.min = 0;
+            result.median = 0;
+            result.max = 0;
+            result.reps = 0;
+        }
+
+        snprintf(line, sizeof(line), "BENCH,%s,%u,%lu,%lu,%lu",
+                 (table[i].name != NULL) ? table[i].name : "?", (unsigned int)result.reps,
+                 (unsigned long)result.min, (unsigned long)result.median,
+                 (unsigned long)result.max);
+        BENCH_Print(line);
+    }
+
+    snprintf(line, sizeof(line), "# end,cases=%lu", (unsigned long)count);
+    BENCH_Print(line);
+}
@@ -0,0 +1,423 @@
+#include "bench.h"
+#include "pool.h"
+#include "ram_func.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(BENCH_HOST)
+#include "main.h"
+#include "hc05_driver.h"
+#include "gpio_pin.h"
+
+extern ADC_HandleTypeDef hadc1;
+extern UART_HandleTypeDef huart2;
+#endif
+
+// Configuration definitions
+#define BENCH_COPY_SIZE     256     // memcpy block size
+#define BENCH_UART_REPS     5       // Each run sends a line, keep the output short
+#define BENCH_FIR_TAPS      16      // Q15 FIR kernel length
+#define BENCH_FIR_LEN       64      // Output samples per run
+#define BENCH_ALLOC_SIZE    32      // Single allocation size
+#define BENCH_CHURN_BLOCKS  8       // Allocations per churn run
+#if !defined(BENCH_HOST)
+#define BENCH_LED_PIN       GPIOA, 5                                    // LD2
+#define BENCH_GROUP_MASK    (GPIO_PIN_5 | GPIO_PIN_6 | GPIO_PIN_7 | GPIO_PIN_8)   // LD2 + unused PA6..PA8
+#endif
+
+// Shared scratch buffers, reached through ctx so the calls cannot be folded
+typedef struct {
+    char text[32];                  // sprintf target
+    uint8_t src[BENCH_COPY_SIZE];   // memcpy source
+    uint8_t dst[BENCH_COPY_SIZE];   // memcpy destination
+} BENCH_ScratchTypeDef;
+
+static BENCH_ScratchTypeDef scratch;
+
+// FIR data, shared by the flash and SRAM copies of the kernel
+typedef struct {
+    int16_t x[BENCH_FIR_LEN + BENCH_FIR_TAPS - 1];  // Input history + block
+    int16_t h[BENCH_FIR_TAPS];                      // Coefficients
+    int16_t y[BENCH_FIR_LEN];                       // Output block
+} BENCH_FirDataTypeDef;
+
+// FIR case: data plus the flash accelerator state it runs under
+typedef struct {
+    BENCH_FirDataTypeDef *data;
+    uint8_t art;                    // 1 = ART prefetch and caches on (reset default)
+} BENCH_FirCaseTypeDef;
+
+static BENCH_FirDataTypeDef fir_data;
+static BENCH_FirCaseTypeDef fir_art_on = { &fir_data, 1 };
+
+// Allocator scratch: blocks escape through it, so malloc/free pairs cannot be elided
+typedef struct {
+    void *blocks[BENCH_CHURN_BLOCKS];
+} BENCH_AllocTypeDef;
+
+static BENCH_AllocTypeDef alloc_scratch;
+
+// Mixed request sizes, freed out of order (every pool class is touched)
+static const uint16_t bench_churn_sizes[BENCH_CHURN_BLOCKS] = { 24, 100, 16, 600, 48, 8, 200, 60 };
+static const uint8_t bench_churn_order[BENCH_CHURN_BLOCKS] = { 3, 0, 6, 1, 7, 2, 5, 4 };
+
+/**
+ * @brief Format one integer
+ * @param ctx: BENCH_ScratchTypeDef
+ */
+static void BENCH_SprintfInt(void *ctx)
+{
+    BENCH_ScratchTypeDef *s = ctx;
+
+    sprintf(s->text, "%lu", 123456789UL);
+}
+
+/**
+ * @brief Format the Analog_input report line
+ * @param ctx: BENCH_ScratchTypeDef
+ */
+static void BENCH_SprintfFmt(void *ctx)
+{
+    BENCH_ScratchTypeDef *s = ctx;
+
+    sprintf(s->text, "Value read: %hu\r\n", (unsigned short)4095);
+}
+
+/**
+ * @brief Copy one block
+ * @param ctx: BENCH_ScratchTypeDef
+ */
+static void BENCH_Memcpy(void *ctx)
+{
+    BENCH_ScratchTypeDef *s = ctx;
+
+    memcpy(s->dst, s->src, BENCH_COPY_SIZE);
+}
+
+/**
+ * @brief Allocate and free one block from the pools
+ * @param ctx: BENCH_AllocTypeDef
+ */
+static void BENCH_PoolOne(void *ctx)
+{
+    BENCH_AllocTypeDef *a = ctx;
+
+    a->blocks[0] = POOL_Alloc(BENCH_ALLOC_SIZE);
+    POOL_Free(a->blocks[0]);
+}
+
+/**
+ * @brief Allocate and free one block with the C library
+ * @note  glibc on the host; newlib-nano over _sbrk on target, or the
+ *        pools when built with POOL_MALLOC
+ * @param ctx: BENCH_AllocTypeDef
+ */
+static void BENCH_MallocOne(void *ctx)
+{
+    BENCH_AllocTypeDef *a = ctx;
+
+    a->blocks[0] = malloc(BENCH_ALLOC_SIZE);
+    free(a->blocks[0]);
+}
+
+/**
+ * @brief Mixed-size allocations freed out of order, from the pools
+ * @param ctx: BENCH_AllocTypeDef
+ */
+static void BENCH_PoolChurn(void *ctx)
+{
+    BENCH_AllocTypeDef *a = ctx;
+
+    for (uint32_t i = 0; i < BENCH_CHURN_BLOCKS; i++) {
+        a->blocks[i] = POOL_Alloc(bench_churn_sizes[i]);
+    }
+    for (uint32_t i = 0; i < BENCH_CHURN_BLOCKS; i++) {
+        POOL_Free(a->blocks[bench_churn_order[i]]);
+    }
+}
+
+/**
+ * @brief The same churn with the C library allocator
+ * @param ctx: BENCH_AllocTypeDef
+ */
+static void BENCH_MallocChurn(void *ctx)
+{
+    BENCH_AllocTypeDef *a = ctx;
+
+    for (uint32_t i = 0; i < BENCH_CHURN_BLOCKS; i++) {
+        a->blocks[i] = malloc(bench_churn_sizes[i]);
+    }
+    for (uint32_t i = 0; i < BENCH_CHURN_BLOCKS; i++) {
+        free(a->blocks[bench_churn_order[i]]);
+    }
+}
+
+/**
+ * @brief Q15 FIR over one block, inlined into each placement below
+ * @param d: Pointer to BENCH_FirDataTypeDef structure
+ */
+static inline __attribute__((always_inline)) void BENCH_FirKernel(BENCH_FirDataTypeDef *d)
+{
+    for (uint32_t n = 0; n < BENCH_FIR_LEN; n++) {
+        int32_t acc = 0;
+
+        for (uint32_t k = 0; k < BENCH_FIR_TAPS; k++) {
+            acc += (int32_t)d->h[k] * d->x[n + k];
+        }
+        d->y[n] = (int16_t)(acc >> 15);
+    }
+}
+
+/**
+ * @brief FIR kernel executed from flash
+ * @param ctx: BENCH_FirCaseTypeDef
+ */
+static void BENCH_FirFlash(void *ctx)
+{
+    BENCH_FirKernel(((BENCH_FirCaseTypeDef *)ctx)->data);
+}
+
+/**
+ * @brief The same FIR kernel executed from SRAM
+ * @param ctx: BENCH_FirCaseTypeDef
+ */
+RAM_FUNC static void BENCH_FirRam(void *ctx)
+{
+    BENCH_FirKernel(((BENCH_FirCaseTypeDef *)ctx)->data);
+}
+
+#if !defined(BENCH_HOST)
+static HC05_HandleTypeDef hc05;
+static BENCH_FirCaseTypeDef fir_art_off = { &fir_data, 0 };
+
+/**
+ * @brief Apply the flash accelerator state of a FIR case
+ * @note  Untimed. Turning the ART on starts from empty caches, so the
+ *        warm-up runs refill them as after reset. With the ART off every
+ *        flash fetch pays the full wait states (2 WS at 84 MHz), which
+ *        is the case SRAM placement protects against; with it on a small
+ *        loop is served from the cache and SRAM code, fetched over the
+ *        S-bus it shares with data, can be the slower of the two
+ * @param ctx: BENCH_FirCaseTypeDef
+ */
+static void BENCH_FirSetup(void *ctx)
+{
+    const BENCH_FirCaseTypeDef *c = ctx;
+
+    __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+    __HAL_FLASH_INSTRUCTION_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    if (c->art) {
+        __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+        __HAL_FLASH_DATA_CACHE_RESET();
+        __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+        __HAL_FLASH_DATA_CACHE_ENABLE();
+        __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+    }
+}
+
+
+/**
+ * @brief Toggle LD2 through the HAL
+ * @param ctx: Unused
+ */
+static void BENCH_GpioToggle(void *ctx)
+{
+    HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
+}
+
+/**
+ * @brief Set LD2 through the HAL
+ * @param ctx: Unused
+ */
+static void BENCH_HalWritePin(void *ctx)
+{
+    HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, GPIO_PIN_SET);
+}
+
+/**
+ * @brief Set LD2 with the compile-time pin layer (one BSRR store)
+ * @param ctx: Unused
+ */
+static void BENCH_PinSet(void *ctx)
+{
+    PIN_SET(BENCH_LED_PIN);
+}
+
+/**
+ * @brief Toggle LD2 with the compile-time pin layer (ODR read + BSRR store)
+ * @param ctx: Unused
+ */
+static void BENCH_PinToggle(void *ctx)
+{
+    PIN_TOGGLE(BENCH_LED_PIN);
+}
+
+/**
+ * @brief Drive four pins to a pattern through the HAL, one call per pin
+ * @param ctx: Unused
+ */
+static void BENCH_HalWrite4(void *ctx)
+{
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_6, GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_7, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_8, GPIO_PIN_RESET);
+}
+
+/**
+ * @brief Drive the same four pins with one group store
+ * @param ctx: Unused
+ */
+static void BENCH_GroupWrite4(void *ctx)
+{
+    PIN_GROUP_WRITE(GPIOA, BENCH_GROUP_MASK, GPIO_PIN_5 | GPIO_PIN_7);
+}
+
+/**
+ * @brief Send 16 bytes in polling mode (about 1.4 ms at 115200 baud)
+ * @note  The payload is a metadata line so the output stays parseable
+ * @param ctx: Unused
+ */
+static void BENCH_UartTx(void *ctx)
+{
+    static const char payload[] = "# uart_payload\r\n";
+
+    HAL_UART_Transmit(&huart2, (const uint8_t *)payload, sizeof(payload) - 1U, HAL_MAX_DELAY);
+}
+
+/**
+ * @brief One polled ADC conversion, as in the Analog_input loop
+ * @note  With interrupts masked the HAL tick is frozen, so the timeout
+ *        cannot expire; the conversion itself takes ~1 us
+ * @param ctx: Unused
+ */
+static void BENCH_AdcPoll(void *ctx)
+{
+    HAL_ADC_Start(&hadc1);
+    HAL_ADC_PollForConversion(&hadc1, 20);
+    (void)HAL_ADC_GetValue(&hadc1);
+}
+
+/**
+ * @brief Present one ordinary character to the HC-05 receive handler
+ * @note  Untimed: the pending reception is aborted so the handler's
+ *        HAL_UART_Receive_IT re-arm takes its normal path
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05Setup(void *ctx)
+{
+    HC05_HandleTypeDef *h = ctx;
+
+    HAL_UART_AbortReceive(&huart2);
+    h->huart = &huart2;
+    h->rx_fill = 0;
+    h->data_received = 0;
+    h->rx_paused = 0;
+    h->rx_index = 0;
+    h->rx_buffer[0][0] = 'a';
+}
+
+/**
+ * @brief Receive-complete handling of one character
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05Irq(void *ctx)
+{
+    HC05_IRQHandler(ctx);
+}
+
+/**
+ * @brief Leave a completed command line in the driver's ready buffer
+ * @note  Untimed: the state HC05_IRQHandler hands over at a line end
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05LineSetup(void *ctx)
+{
+    HC05_HandleTypeDef *h = ctx;
+
+    strcpy(h->rx_buffer[1], "led on");
+    h->rx_fill = 0;
+    h->rx_paused = 0;
+    h->data_received = 1;
+}
+
+/**
+ * @brief Take the line by copying it out (HC05_ReceiveData)
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05RxCopy(void *ctx)
+{
+    HC05_ReceiveData(ctx, (char *)scratch.dst, sizeof(scratch.dst));
+}
+
+/**
+ * @brief Take the line in place (HC05_GetLine + HC05_ReleaseLine)
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05RxInPlace(void *ctx)
+{
+    (void)HC05_GetLine(ctx);
+    HC05_ReleaseLine(ctx);
+}
+
+/**
+ * @brief Empty the transmit queue with a transmission marked in flight
+ * @note  Untimed: the commit then only queues, no UART interrupt starts
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05TxSetup(void *ctx)
+{
+    HC05_HandleTypeDef *h = ctx;
+
+    h->tx_head = 0;
+    h->tx_tail = 0;
+    h->tx_busy = 1;
+}
+
+/**
+ * @brief Queue the uart_tx_16B payload for interrupt transmission
+ * @param ctx: HC05_HandleTypeDef
+ */
+static void BENCH_Hc05TxQueue(void *ctx)
+{
+    static const char payload[] = "# uart_payload\r\n";
+
+    HC05_Write(ctx, payload, sizeof(payload) - 1U);
+}
+#endif
+
+const BENCH_CaseTypeDef BENCH_Cases[] = {
+#if !defined(BENCH_HOST)
+    { "gpio_toggle",   NULL,            BENCH_GpioToggle,   NULL,     0 },
+    { "hal_write_pin", NULL,            BENCH_HalWritePin,  NULL,     0 },
+    { "pin_set",       NULL,            BENCH_PinSet,       NULL,     0 },
+    { "pin_toggle",    NULL,            BENCH_PinToggle,    NULL,     0 },
+    { "hal_write_4",   NULL,            BENCH_HalWrite4,    NULL,     0 },
+    { "group_write_4", NULL,            BENCH_GroupWrite4,  NULL,     0 },
+    { "uart_tx_16B",   NULL,            BENCH_UartTx,       NULL,     BENCH_UART_REPS },
+    { "adc_poll",      NULL,            BENCH_AdcPoll,      NULL,     0 },
+    { "hc05_irq",      BENCH_Hc05Setup, BENCH_Hc05Irq,      &hc05,    0 },
+    { "hc05_rx_copy",  BENCH_Hc05LineSetup, BENCH_Hc05RxCopy,    &hc05, 0 },
+    { "hc05_rx_inplace", BENCH_Hc05LineSetup, BENCH_Hc05RxInPlace, &hc05, 0 },
+    { "hc05_tx_queue_16B", BENCH_Hc05TxSetup, BENCH_Hc05TxQueue,   &hc05, 0 },
+    // ART off first: the "on" cases restore it for everything after them
+    { "fir_flash_off", BENCH_FirSetup,  BENCH_FirFlash,     &fir_art_off, 0 },
+    { "fir_ram_off",   BENCH_FirSetup,  BENCH_FirRam,       &fir_art_off, 0 },
+    { "fir_flash",     BENCH_FirSetup,  BENCH_FirFlash,     &fir_art_on,  0 },
+    { "fir_ram",       BENCH_FirSetup,  BENCH_FirRam,       &fir_art_on,  0 },
+#else
+    { "fir_flash",     NULL,            BENCH_FirFlash,     &fir_art_on,  0 },
+    { "fir_ram",       NULL,            BENCH_FirRam,       &fir_art_on,  0 },
+#endif
+    { "sprintf_int",   NULL,            BENCH_SprintfInt,   &scratch, 0 },
+    { "sprintf_fmt",   NULL,            BENCH_SprintfFmt,   &scratch, 0 },
+    { "memcpy_256B",   NULL,            BENCH_Memcpy,       &scratch, 0 },
+    { "pool_32B",      NULL,            BENCH_PoolOne,      &alloc_scratch, 0 },
+    { "malloc_32B",    NULL,            BENCH_MallocOne,    &alloc_scratch, 0 },
+    { "pool_churn",    NULL,            BENCH_PoolChurn,    &alloc_scratch, 0 },
+    { "malloc_churn",  NULL,            BENCH_MallocChurn,  &alloc_scratch, 0 },
+};
+
+const uint32_t BENCH_CaseCount = sizeof(BENCH_Cases) / sizeof(BENCH_Cases[0]);
@@ -0,0 +1,292 @@
+#include "pool.h"
+#include <string.h>
+
+#if defined(__GNUC__) && defined(__arm__)
+#include "stm32f4xx.h"
+#define POOL_SECTION    __attribute__((section(".pool"), aligned(POOL_ALIGN)))
+#else
+#define POOL_SECTION    __attribute__((aligned(POOL_ALIGN)))
+#endif
+
+// Block storage, not initialized by the startup (NOLOAD section)
+static uint8_t pool_storage_0[POOL_SIZE_0 * POOL_COUNT_0] POOL_SECTION;
+static uint8_t pool_storage_1[POOL_SIZE_1 * POOL_COUNT_1] POOL_SECTION;
+static uint8_t pool_storage_2[POOL_SIZE_2 * POOL_COUNT_2] POOL_SECTION;
+static uint8_t pool_storage_3[POOL_SIZE_3 * POOL_COUNT_3] POOL_SECTION;
+static uint8_t pool_storage_4[POOL_SIZE_4 * POOL_COUNT_4] POOL_SECTION;
+
+// Statically initialized: usable before main, e.g. by malloc from the C library start-up
+static POOL_ClassTypeDef pool_classes[POOL_CLASS_COUNT] = {
+    { pool_storage_0, pool_storage_0 + sizeof(pool_storage_0), POOL_SIZE_0, POOL_COUNT_0, NULL, 0, 0, 0, 0 },
+    { pool_storage_1, pool_storage_1 + sizeof(pool_storage_1), POOL_SIZE_1, POOL_COUNT_1, NULL, 0, 0, 0, 0 },
+    { pool_storage_2, pool_storage_2 + sizeof(pool_storage_2), POOL_SIZE_2, POOL_COUNT_2, NULL, 0, 0, 0, 0 },
+    { pool_storage_3, pool_storage_3 + sizeof(pool_storage_3), POOL_SIZE_3, POOL_COUNT_3, NULL, 0, 0, 0, 0 },
+    { pool_storage_4, pool_storage_4 + sizeof(pool_storage_4), POOL_SIZE_4, POOL_COUNT_4, NULL, 0, 0, 0, 0 },
+};
+
+/**
+ * @brief Find the class a block belongs to
+ * @param ptr: Block address
+ * @retval POOL_ClassTypeDef*: Owning class, NULL if ptr is not a pool block
+ */
+static inline POOL_ClassTypeDef *POOL_ClassOf(const void *ptr)
+{
+    const uint8_t *p = ptr;
+
+    for (uint8_t i = 0; i < POOL_CLASS_COUNT; i++) {
+        if (p >= pool_classes[i].base && p < pool_classes[i].end) {
+            return &pool_classes[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Return every block and clear the statistics
+ * @note  Optional: the class table is valid from reset. Blocks handed out
+ *        before the call must not be used or freed afterwards
+ */
+void POOL_Init(void)
+{
+    for (uint8_t i = 0; i < POOL_CLASS_COUNT; i++) {
+        POOL_ClassTypeDef *c = &pool_classes[i];
+
+        c->free_list = NULL;
+        c->fresh = 0;
+        c->used = 0;
+        c->high_water = 0;
+        c->failures = 0;
+    }
+}
+
+/**
+ * @brief Allocate a block
+ * @note  Constant time: the smallest class that fits serves the request,
+ *        the next larger ones only when it is exhausted, so at most
+ *        POOL_CLASS_COUNT classes are visited. Each class hands out the
+ *        head of its free list, or else its next never-used block; no
+ *        search, split or merge. Not interrupt-safe, see POOL_AllocSafe()
+ * @param size: Requested size in bytes
+ * @retval void*: Block of at least size bytes aligned to POOL_ALIGN, NULL if
+ *         size is 0 or larger than the largest class, or no block is left
+ */
+void *POOL_Alloc(size_t size)
+{
+    uint8_t i = 0;
+
+    if (size == 0U) {
+        return NULL;
+    }
+
+    while (i < POOL_CLASS_COUNT && pool_classes[i].size < size) {
+        i++;
+    }
+
+    for (; i < POOL_CLASS_COUNT; i++) {
+        POOL_ClassTypeDef *c = &pool_classes[i];
+        void *block;
+
+        if (c->free_list != NULL) {
+            block = c->free_list;
+            c->free_list = *(void **)block;
+        } else if (c->fresh < c->count) {
+            block = c->base + (uint32_t)c->fresh * c->size;
+            c->fresh++;
+        } else {
+            c->failures++;
+            continue;
+        }
+
+        if (++c->used > c->high_water) {
+            c->high_water = c->used;
+        }
+        return block;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Return a block to its class
+ * @note  Constant time; pointers outside the pools (including NULL) are
+ *        ignored. Not interrupt-safe, see POOL_FreeSafe()
+ * @param ptr: Block returned by POOL_Alloc() or POOL_AllocSafe()
+ */
+void POOL_Free(void *ptr)
+{
+    POOL_ClassTypeDef *c = POOL_ClassOf(ptr);
+
+    if (c == NULL) {
+        return;
+    }
+
+    *(void **)ptr = c->free_list;
+    c->free_list = ptr;
+    c->used--;
+}
+
+/**
+ * @brief Interrupt-safe POOL_Alloc()
+ * @note  Runs with interrupts masked (PRIMASK saved and restored), so it
+ *        may be called from interrupts and thread code alike. Once any
+ *        interrupt allocates, every caller must use the Safe variants
+ * @param size: Requested size in bytes
+ * @retval void*: Block, NULL on failure (see POOL_Alloc())
+ */
+void *POOL_AllocSafe(size_t size)
+{
+#if defined(__GNUC__) && defined(__arm__)
+    uint32_t primask = __get_PRIMASK();
+    void *block;
+
+    __disable_irq();
+    block = POOL_Alloc(size);
+    __set_PRIMASK(primask);
+
+    return block;
+#else
+    return POOL_Alloc(size);
+#endif
+}
+
+/**
+ * @brief Interrupt-safe POOL_Free()
+ * @param ptr: Block returned by POOL_Alloc() or POOL_AllocSafe()
+ */
+void POOL_FreeSafe(void *ptr)
+{
+#if defined(__GNUC__) && defined(__arm__)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    POOL_Free(ptr);
+    __set_PRIMASK(primask);
+#else
+    POOL_Free(ptr);
+#endif
+}
+
+/**
+ * @brief Get the usable size of a block
+ * @param ptr: Block returned by POOL_Alloc() or POOL_AllocSafe()
+ * @retval size_t: Block size of its class, 0 if ptr is not a pool block
+ */
+size_t POOL_BlockSize(const void *ptr)
+{
+    const POOL_ClassTypeDef *c = POOL_ClassOf(ptr);
+
+    return (c != NULL) ? c->size : 0U;
+}
+
+/**
+ * @brief Read the usage statistics of a class
+ * @param cls: Class index, 0 to POOL_CLASS_COUNT - 1
+ * @param stats: Pointer to POOL_StatsTypeDef structure, filled on success
+ * @retval POOL_StatusTypeDef: POOL_OK, or POOL_ERROR on a bad argument
+ */
+POOL_StatusTypeDef POOL_GetStats(uint8_t cls, POOL_StatsTypeDef *stats)
+{
+    if (cls >= POOL_CLASS_COUNT || stats == NULL) {
+        return POOL_ERROR;
+    }
+
+    const POOL_ClassTypeDef *c = &pool_classes[cls];
+
+    stats->size = c->size;
+    stats->count = c->count;
+    stats->used = c->used;
+    stats->high_water = c->high_water;
+    stats->failures = c->failures;
+
+    return POOL_OK;
+}
+
+#if defined(POOL_MALLOC)
+#include <errno.h>
+
+struct _reent;
+
+// C library allocator entry points, replacing newlib-nano's nano-mallocr
+void *malloc(size_t size)
+{
+    void *ptr = POOL_AllocSafe(size);
+
+    if (ptr == NULL && size != 0U) {
+        errno = ENOMEM;
+    }
+
+    return ptr;
+}
+
+void free(void *ptr)
+{
+    POOL_FreeSafe(ptr);
+}
+
+void *calloc(size_t n, size_t size)
+{
+    void *ptr;
+
+    if (size != 0U && n > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    ptr = malloc(n * size);
+    if (ptr != NULL) {
+        memset(ptr, 0, n * size);
+    }
+
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    size_t old_size = POOL_BlockSize(ptr);
+    void *block;
+
+    if (ptr == NULL) {
+        return malloc(size);
+    }
+    if (size == 0U) {
+        POOL_FreeSafe(ptr);
+        return NULL;
+    }
+    if (size <= old_size) {
+        return ptr;
+    }
+
+    block = malloc(size);
+    if (block != NULL) {
+        memcpy(block, ptr, old_size);
+        POOL_FreeSafe(ptr);
+    }
+
+    return block;
+}
+
+void *_malloc_r(struct _reent *r, size_t size)
+{
+    (void)r;
+    return malloc(size);
+}
+
+void _free_r(struct _reent *r, void *ptr)
+{
+    (void)r;
+    free(ptr);
+}
+
+void *_calloc_r(struct _reent *r, size_t n, size_t size)
+{
+    (void)r;
+    return calloc(n, size);
+}
+
+void *_realloc_r(struct _reent *r, void *ptr, size_t size)
+{
+    (void)r;
+    return realloc(ptr, size);
+}
+#endif /* POOL_MALLOC */
@@ -0,0 +1,174 @@
+/**
+ * @brief Host runner for the portable benchmark cases
+ * @note  Not part of the firmware build (Host is not a source folder).
+ *        Build and run from the project directory:
+ *          gcc -O2 -DBENCH_HOST -ICore/Inc -I../Analog_input/Core/Inc \
+ *              Core/Src/bench.c Core/Src/bench_cases.c Core/Src/pool.c \
+ *              ../Analog_input/Core/Src/signal_stats.c \
+ *              Host/bench_host.c -lm -o bench_host && ./bench_host
+ *        Output lines match the target format, with unit=ns. The host-only
+ *        cases time project modules that the Benchmark firmware does not
+ *        link, and are followed by their accuracy checks
+ */
+#include "bench.h"
+#include "signal_stats.h"
+#include <math.h>
+#include <stdio.h>
+
+// Configuration definitions
+#define HOST_STATS_BLOCK    64          // Samples pushed per timed run
+#define HOST_STATS_FAST     64          // Analog_input FAST_WINDOW
+#define HOST_STATS_SLOW     1024        // Analog_input SLOW_WINDOW
+#define HOST_STATS_INPUT    4096        // Synthetic ADC record, replayed cyclically
+#define HOST_STATS_CHECKS   200000      // Samples of the accuracy run
+
+// Statistics case: a channel and its position in the input record
+typedef struct {
+    STATS_ChannelTypeDef ch;
+    uint16_t *workspace;
+    uint32_t next;
+} HOST_StatsCaseTypeDef;
+
+static uint16_t stats_input[HOST_STATS_INPUT];
+static uint16_t stats_fast_ws[STATS_WORKSPACE_SIZE(HOST_STATS_FAST)];
+static uint16_t stats_slow_ws[STATS_WORKSPACE_SIZE(HOST_STATS_SLOW)];
+static HOST_StatsCaseTypeDef stats_fast = { .workspace = stats_fast_ws };
+static HOST_StatsCaseTypeDef stats_slow = { .workspace = stats_slow_ws };
+
+/**
+ * @brief Print one result line
+ * @param line: Line without terminator
+ */
+static void BENCH_HostOutput(const char *line)
+{
+    puts(line);
+}
+
+/**
+ * @brief Next value of a xorshift32 generator
+ * @param state: Generator state, nonzero
+ * @retval uint32_t: Pseudo-random value
+ */
+static uint32_t HOST_Random(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/**
+ * @brief Generate one 12-bit ADC-like sample
+ * @note  Slow sine around mid-scale, +-16 LSB noise and a step every 3000
+ *        samples: a large mean with a small spread is the hard case for
+ *        the float variance
+ * @param n: Sample index
+ * @param state: Generator state
+ * @retval uint16_t: Sample, 0..4095
+ */
+static uint16_t HOST_AdcSample(uint32_t n, uint32_t *state)
+{
+    double v = 2048.0 + 1500.0 * sin((double)n * 0.0021) + (double)(HOST_Random(state) % 33U) - 16.0;
+
+    if ((n / 3000U) % 2U) {
+        v += 400.0;
+    }
+    v = (v < 0.0) ? 0.0 : (v > 4095.0) ? 4095.0 : v;
+
+    return (uint16_t)v;
+}
+
+/**
+ * @brief Push a block of samples into a statistics channel
+ * @param ctx: HOST_StatsCaseTypeDef
+ */
+static void HOST_StatsUpdate(void *ctx)
+{
+    HOST_StatsCaseTypeDef *c = ctx;
+
+    for (uint32_t i = 0; i < HOST_STATS_BLOCK; i++) {
+        STATS_Update(&c->ch, stats_input[c->next]);
+        c->next = (c->next + 1U) % HOST_STATS_INPUT;
+    }
+}
+
+/**
+ * @brief Compare the window summary with a double precision recomputation
+ * @note  Prints the largest deviations over HOST_STATS_CHECKS samples, in
+ *        ADC counts, checked at every decimated report as on target
+ * @param window: Window length
+ * @param workspace: Buffer of STATS_WORKSPACE_SIZE(window) words
+ */
+static void HOST_StatsAccuracy(uint16_t window, uint16_t *workspace)
+{
+    STATS_ChannelTypeDef ch;
+    STATS_SummaryTypeDef s;
+    static uint16_t history[HOST_STATS_CHECKS];
+    double err_mean = 0.0, err_rms = 0.0, err_std = 0.0;
+    uint32_t minmax_errors = 0, state = 0x2545F491UL;
+    char line[128];
+
+    STATS_Init(&ch, workspace, window, 500);
+
+    for (uint32_t n = 0; n < HOST_STATS_CHECKS; n++) {
+        history[n] = HOST_AdcSample(n, &state);
+        if (!STATS_Update(&ch, history[n])) {
+            continue;
+        }
+
+        uint32_t count = (n + 1U < window) ? n + 1U : window;
+        double sum = 0.0, sum_sq = 0.0, m2 = 0.0;
+        uint16_t lo = 0xFFFF, hi = 0;
+
+        for (uint32_t k = n + 1U - count; k <= n; k++) {
+            sum += history[k];
+            sum_sq += (double)history[k] * history[k];
+            lo = (history[k] < lo) ? history[k] : lo;
+            hi = (history[k] > hi) ? history[k] : hi;
+        }
+        double mean = sum / count;
+        for (uint32_t k = n + 1U - count; k <= n; k++) {
+            m2 += (history[k] - mean) * (history[k] - mean);
+        }
+
+        STATS_GetSummary(&ch, &s);
+        err_mean = fmax(err_mean, fabs(s.mean - mean));
+        err_rms = fmax(err_rms, fabs(s.rms - sqrt(sum_sq / count)));
+        err_std = fmax(err_std, fabs(s.stddev - sqrt(m2 / count)));
+        minmax_errors += (s.min != lo || s.max != hi);
+    }
+
+    snprintf(line, sizeof(line), "# stats_accuracy,window=%u,mean=%.2e,rms=%.2e,stddev=%.2e,minmax_errors=%lu",
+             (unsigned int)window, err_mean, err_rms, err_std, (unsigned long)minmax_errors);
+    BENCH_HostOutput(line);
+}
+
+// Host-only cases (modules of the other projects)
+static const BENCH_CaseTypeDef host_cases[] = {
+    { "stats_fast_64S", NULL, HOST_StatsUpdate, &stats_fast, 0 },
+    { "stats_slow_64S", NULL, HOST_StatsUpdate, &stats_slow, 0 },
+};
+
+int main(void)
+{
+    uint32_t state = 0x12345678UL;
+
+    for (uint32_t n = 0; n < HOST_STATS_INPUT; n++) {
+        stats_input[n] = HOST_AdcSample(n, &state);
+    }
+    STATS_Init(&stats_fast.ch, stats_fast_ws, HOST_STATS_FAST, 0);
+    STATS_Init(&stats_slow.ch, stats_slow_ws, HOST_STATS_SLOW, 0);
+
+    BENCH_Init(BENCH_HostOutput);
+    BENCH_RunAll(BENCH_Cases, BENCH_CaseCount);
+    BENCH_RunAll(host_cases, sizeof(host_cases) / sizeof(host_cases[0]));
+
+    HOST_StatsAccuracy(HOST_STATS_FAST, stats_fast_ws);
+    HOST_StatsAccuracy(HOST_STATS_SLOW, stats_slow_ws);
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Host test helpers
+// The Host/test_*.c programs compile project modules for the host (each
+// file header gives its build command, run from the Benchmark project
+// directory). CHECK reports a failed condition with its location and the
+// test goes on; main ends with HOST_TestResult(), which prints a summary
+// and returns the process exit code. HOST_Random gives every test the
+// same reproducible input sequence.
+#define HOST_TEST_MAX_REPORTS 20    // Failures printed in full, the rest only counted
+
+static unsigned long host_checks;
+static unsigned long host_failures;
+static uint32_t host_random = 12345;
+
+/**
+ * @brief Record one check
+ * @param ok: Check outcome
+ * @param file: Source file of the check
+ * @param line: Source line of the check
+ * @param text: Condition text
+ * @retval int: ok
+ */
+static inline int HOST_Check(int ok, const char *file, int line, const char *text)
+{
+    host_checks++;
+    if (!ok && host_failures++ < HOST_TEST_MAX_REPORTS) {
+        printf("FAIL %s:%d: %s\n", file, line, text);
+    }
+    return ok;
+}
+
+/**
+ * @brief Print the summary of a test program
+ * @param name: Test name
+ * @retval int: Exit code, 0 when every check passed
+ */
+static inline int HOST_TestResult(const char *name)
+{
+    printf("%s: %lu checks, %lu failed\n", name, host_checks, host_failures);
+    return host_failures ? 1 : 0;
+}
+
+/**
+ * @brief Pseudo-random number (xorshift32), reproducible between hosts
+ * @note  One sequence per test program, seeded the same every run
+ * @retval uint32_t: 0..0xFFFFFFFF
+ */
+static inline uint32_t HOST_Random(void)
+{
+    host_random ^= host_random << 13;
+    host_random ^= host_random >> 17;
+    host_random ^= host_random << 5;
+    return host_random;
+}
+
+#define CHECK(cond) HOST_Check(!!(cond), __FILE__, __LINE__, #cond)
+
+#endif /* HOST_TEST_H */
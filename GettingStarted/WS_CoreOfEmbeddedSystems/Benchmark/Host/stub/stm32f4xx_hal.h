@@ -0,0 +1,128 @@
+#ifndef STM32F4XX_HAL_H
+#define STM32F4XX_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host stand-in for the HAL
+// Only what the HC-05 driver (hc05_driver.c) and its flash record
+// (bt_config.c) use, for Host/test_hc05_boot.c, and the EXTI router
+// (exti_router.c), for Host/test_exti_router.c. The tests define the
+// functions against their virtual clock, UART, flash sector and EXTI
+// registers; build the HC-05 test with
+// -DBTCFG_FLASH_ADDR='((uintptr_t)HOST_Flash)' so the record lives there.
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR = 1,
+    HAL_BUSY = 2,
+    HAL_TIMEOUT = 3
+} HAL_StatusTypeDef;
+
+// UART
+typedef enum {
+    HAL_UART_STATE_READY = 0x20,
+    HAL_UART_STATE_BUSY_RX = 0x22
+} HAL_UART_StateTypeDef;
+
+typedef struct {
+    uint32_t BaudRate;
+} UART_InitTypeDef;
+
+typedef struct {
+    UART_InitTypeDef Init;
+    volatile HAL_UART_StateTypeDef RxState;
+    uint8_t *rx_ptr;                        // Armed reception byte, NULL when not armed
+    uint8_t ore;                            // Overrun flag (SR.ORE)
+    uint8_t tx_busy;
+} UART_HandleTypeDef;
+
+#define __HAL_UART_CLEAR_OREFLAG(huart)     ((huart)->ore = 0U)
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *data, uint16_t size);
+HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size);
+
+// GPIO and tick
+typedef struct {
+    uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+void HAL_Delay(uint32_t ms);
+uint32_t HAL_GetTick(void);
+
+// Core: a single thread, interrupts are simulated calls
+#define __DMB()                             __asm__ volatile("" ::: "memory")
+static inline uint32_t __get_PRIMASK(void) { return 0U; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+static inline void __disable_irq(void) {}
+#define __CLZ(x)                            ((uint8_t)(((x) == 0U) ? 32 : __builtin_clz(x)))
+
+// NVIC and EXTI
+typedef enum {
+    EXTI0_IRQn = 6,
+    EXTI1_IRQn = 7,
+    EXTI2_IRQn = 8,
+    EXTI3_IRQn = 9,
+    EXTI4_IRQn = 10,
+    EXTI9_5_IRQn = 23,
+    EXTI15_10_IRQn = 40
+} IRQn_Type;
+
+void HAL_NVIC_SetPriority(IRQn_Type irqn, uint32_t preempt_priority, uint32_t sub_priority);
+void HAL_NVIC_EnableIRQ(IRQn_Type irqn);
+
+// Plain memory: a write to PR stores the value, the test applies the
+// write-1-to-clear itself
+typedef struct {
+    volatile uint32_t IMR;
+    volatile uint32_t EMR;
+    volatile uint32_t RTSR;
+    volatile uint32_t FTSR;
+    volatile uint32_t SWIER;
+    volatile uint32_t PR;
+} EXTI_TypeDef;
+
+extern EXTI_TypeDef HOST_Exti;
+#define EXTI                                (&HOST_Exti)
+
+// Flash
+extern uint8_t HOST_Flash[];                // Simulated sector 7
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Sector;
+    uint32_t NbSectors;
+    uint32_t VoltageRange;
+} FLASH_EraseInitTypeDef;
+
+#define FLASH_TYPEERASE_SECTORS             0U
+#define FLASH_SECTOR_7                      7U
+#define FLASH_VOLTAGE_RANGE_3               2U
+#define FLASH_TYPEPROGRAM_WORD              2U
+#define FLASH_FLAG_EOP                      0x01U
+#define FLASH_FLAG_OPERR                    0x02U
+#define FLASH_FLAG_WRPERR                   0x10U
+#define FLASH_FLAG_PGAERR                   0x20U
+#define FLASH_FLAG_PGPERR                   0x40U
+#define FLASH_FLAG_PGSERR                   0x80U
+#define __HAL_FLASH_CLEAR_FLAG(flags)       ((void)(flags))
+#define __HAL_FLASH_DATA_CACHE_DISABLE()    ((void)0)
+#define __HAL_FLASH_DATA_CACHE_RESET()      ((void)0)
+#define __HAL_FLASH_DATA_CACHE_ENABLE()     ((void)0)
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *erase, uint32_t *sector_error);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t type, uint32_t address, uint64_t data);
+
+#endif /* STM32F4XX_HAL_H */
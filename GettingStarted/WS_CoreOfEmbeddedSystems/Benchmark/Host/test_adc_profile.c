@@ -0,0 +1,104 @@
+/**
+ * @brief Host test of the ADC conversions (Analog_input project, adc_profile.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../Analog_input/Core/Inc \
+ *              ../Analog_input/Core/Src/adc_profile.c \
+ *              Host/test_adc_profile.c -lm -o test_adc_profile && ./test_adc_profile
+ *        Checks ADCPROF_VddaMillivolts and ADCPROF_ToMillivolts against
+ *        the reference manual formulas at 12, 10, 8 and 6-bit resolution:
+ *        VDDA = 3.3 V * VREFINT_CAL / VREFINT_DATA with the data scaled to
+ *        12 bits, V = VDDA * DATA / FULL_SCALE. Every result must be the
+ *        exact value rounded to nearest, over every reading and
+ *        calibration word, with the typical VREFINT when the word is
+ *        blank and 0 for a zero reading
+ */
+#include "host_test.h"
+#include "adc_profile.h"
+#include <math.h>
+
+// Configuration definitions
+#define TEST_VDDA_MIN_MV    1700                // VDDA range of the STM32F401
+#define TEST_VDDA_MAX_MV    3600
+#define TEST_SUPPLY_MV      3000                // Supply of the resolution example
+
+// Reference formulas (RM0368 and the __LL_ADC_CALC_VREFANALOG_VOLTAGE and
+// __LL_ADC_CALC_DATA_TO_VOLTAGE helpers of stm32f4xx_ll_adc.h), exact
+#define TEST_FULL_SCALE(bits)           ((1UL << (bits)) - 1U)
+#define TEST_VDDA(raw, bits, cal)       (3300.0 * (cal) / ((double)(raw) * (1UL << (12U - (bits)))))
+#define TEST_MV(raw, bits, vdda)        ((double)(raw) * (vdda) / TEST_FULL_SCALE(bits))
+
+/**
+ * @brief Check a result is the exact value rounded to nearest
+ * @param got: Integer result
+ * @param exact: Exact value
+ * @retval int: 1 if within half a unit
+ */
+static int TEST_Rounded(uint32_t got, double exact)
+{
+    return CHECK(fabs((double)got - exact) <= 0.5 + 1e-9);
+}
+
+int main(void)
+{
+    static const uint8_t resolutions[] = { 12, 10, 8, 6 };
+
+    for (uint32_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        uint8_t bits = resolutions[r];
+        uint32_t full_scale = TEST_FULL_SCALE(bits);
+
+        // VDDA: every reading against every calibration word
+        for (uint32_t cal = 1; cal <= 4095U; cal++) {
+            for (uint32_t raw = 1; raw <= full_scale; raw++) {
+                TEST_Rounded(ADCPROF_VddaMillivolts((uint16_t)raw, bits, (uint16_t)cal),
+                             TEST_VDDA(raw, bits, cal));
+            }
+        }
+
+        // Blank calibration word: the typical VREFINT
+        for (uint32_t raw = 1; raw <= full_scale; raw++) {
+            double typical = ADCPROF_VREFINT_TYP_MV * 4095.0 / ((double)raw * (1UL << (12U - bits)));
+
+            TEST_Rounded(ADCPROF_VddaMillivolts((uint16_t)raw, bits, 0), typical);
+            TEST_Rounded(ADCPROF_VddaMillivolts((uint16_t)raw, bits, 0xFFFF), typical);
+        }
+
+        // Input voltage: every reading over the VDDA range, full scale is VDDA
+        for (uint32_t vdda = TEST_VDDA_MIN_MV; vdda <= TEST_VDDA_MAX_MV; vdda++) {
+            for (uint32_t raw = 0; raw <= full_scale; raw++) {
+                TEST_Rounded(ADCPROF_ToMillivolts((uint16_t)raw, bits, vdda), TEST_MV(raw, bits, vdda));
+            }
+            CHECK(ADCPROF_ToMillivolts((uint16_t)full_scale, bits, vdda) == vdda);
+        }
+
+        // Zero reading: no VDDA (not a division by zero), 0 mV input
+        CHECK(ADCPROF_VddaMillivolts(0, bits, 1500) == 0U);
+        CHECK(ADCPROF_VddaMillivolts(0, bits, 0) == 0U);
+        CHECK(ADCPROF_ToMillivolts(0, bits, 3300) == 0U);
+    }
+
+    // Resolutions the ADC does not have
+    CHECK(ADCPROF_VddaMillivolts(1500, 0, 1500) == 0U);
+    CHECK(ADCPROF_VddaMillivolts(1500, 13, 1500) == 0U);
+    CHECK(ADCPROF_ToMillivolts(100, 0, 3300) == 0U);
+    CHECK(ADCPROF_ToMillivolts(100, 13, 3300) == 0U);
+
+    // The same VREFINT read at every resolution: lower resolutions keep the
+    // upper bits of the 12-bit result, so the estimate is high by at most
+    // one dropped LSB range
+    uint32_t cal = (uint32_t)lround(ADCPROF_VREFINT_TYP_MV * 4095.0 / ADCPROF_VREFINT_CAL_VREF);
+    uint32_t raw12 = (uint32_t)lround(ADCPROF_VREFINT_TYP_MV * 4095.0 / TEST_SUPPLY_MV);
+
+    printf("VREFINT %lu mV at VDDA %u mV, VDDA estimate:", (unsigned long)ADCPROF_VREFINT_TYP_MV, TEST_SUPPLY_MV);
+    for (uint32_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        uint8_t bits = resolutions[r];
+        uint32_t raw = raw12 >> (12U - bits);
+        uint32_t vdda = ADCPROF_VddaMillivolts((uint16_t)raw, bits, (uint16_t)cal);
+        double bound = TEST_SUPPLY_MV * ((double)raw12 / (raw << (12U - bits)) - 1.0) + 2.0;
+
+        CHECK((int32_t)vdda - TEST_SUPPLY_MV >= -2 && (int32_t)vdda - TEST_SUPPLY_MV <= bound);
+        printf("%s %u-bit %lu mV", (r == 0U) ? "" : ",", bits, (unsigned long)vdda);
+    }
+    printf("\n");
+
+    return HOST_TestResult("adc_profile");
+}
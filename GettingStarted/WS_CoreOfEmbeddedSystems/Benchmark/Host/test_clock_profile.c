@@ -0,0 +1,143 @@
+/**
+ * @brief Host test of the clock profiles (Analog_input project, clock_profile.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../Analog_input/Core/Inc \
+ *              ../Analog_input/Core/Src/clock_profile.c ../Analog_input/Core/Src/adc_profile.c \
+ *              Host/test_clock_profile.c -lm -o test_clock_profile && ./test_clock_profile
+ *        For every profile, checks the clock tree against the STM32F401
+ *        limits and the values CLKCTL_SetProfile recomputes: flash wait
+ *        states, USART BRR (against the HAL UART_BRR_SAMPLING16 macro),
+ *        timer PSC for the rates CLKCTL_AddTimer accepts, the SysTick
+ *        reload of the 1 ms tick and the ADC prescaler of every
+ *        acquisition profile. Then compares the BRR rounding with the HAL
+ *        macro over a sweep of clocks and baud rates
+ */
+#include "host_test.h"
+#include "clock_profile.h"
+#include "adc_profile.h"
+#include <math.h>
+
+// Configuration definitions
+#define TEST_MAX_ERROR_PPM  10000               // 1 %: well inside the UART receiver tolerance
+
+// UART_BRR_SAMPLING16 from stm32f4xx_hal_uart.h, for comparison
+#define TEST_HAL_DIV(pclk, baud)    ((uint32_t)((((uint64_t)(pclk)) * 25U) / (4U * ((uint64_t)(baud)))))
+#define TEST_HAL_MANT(pclk, baud)   (TEST_HAL_DIV((pclk), (baud)) / 100U)
+#define TEST_HAL_FRAQ(pclk, baud)   ((((TEST_HAL_DIV((pclk), (baud)) - (TEST_HAL_MANT((pclk), (baud)) * 100U)) * 16U) \
+                                      + 50U) / 100U)
+#define TEST_HAL_BRR(pclk, baud)    ((TEST_HAL_MANT((pclk), (baud)) << 4U) + \
+                                     (TEST_HAL_FRAQ((pclk), (baud)) & 0xF0U) + \
+                                     (TEST_HAL_FRAQ((pclk), (baud)) & 0x0FU))
+
+/**
+ * @brief Baud rate error of a BRR value
+ * @param pclk_hz: USART clock
+ * @param baud: Requested baud rate
+ * @param brr: BRR value
+ * @retval double: |actual - requested| in baud
+ */
+static double TEST_BaudError(uint32_t pclk_hz, uint32_t baud, uint32_t brr)
+{
+    return fabs((double)pclk_hz / brr - baud);
+}
+
+int main(void)
+{
+    static const uint32_t bauds[] = { 9600, 38400, 57600, 115200 };
+    static const uint32_t ticks[] = { 1000000, 100000, 10000 };    // The rates CLKCTL_AddTimer documents
+    static const uint32_t expect_hclk[CLKPROF_COUNT] = { 16000000, 42000000, 84000000 };
+
+    for (uint32_t id = 0; id < CLKPROF_COUNT; id++) {
+        const CLKPROF_ProfileTypeDef *p = CLKPROF_Get((CLKPROF_IdTypeDef)id);
+        uint32_t hclk = CLKPROF_HclkHz(p);
+        uint32_t pclk1 = CLKPROF_Pclk1Hz(p);
+        uint32_t pclk2 = CLKPROF_Pclk2Hz(p);
+
+        printf("%-8s SYSCLK %lu HCLK %lu PCLK1 %lu PCLK2 %lu, %u WS, scale %u\n", p->name,
+               (unsigned long)CLKPROF_SysclkHz(p), (unsigned long)hclk, (unsigned long)pclk1,
+               (unsigned long)pclk2, CLKPROF_FlashLatency(hclk), CLKPROF_VoltageScale(hclk));
+
+        // Clock tree within the limits, at the documented frequency
+        CHECK(CLKPROF_IsValid(p));
+        CHECK(hclk == expect_hclk[id]);
+        CHECK(pclk1 <= CLKPROF_PCLK1_MAX_HZ && pclk2 <= CLKPROF_PCLK2_MAX_HZ);
+
+        // Flash (RM0368 table 6, 2.7-3.6 V): 0 WS to 30 MHz, 1 to 60, 2 to 84
+        CHECK(CLKPROF_FlashLatency(hclk) == ((hclk <= 30000000UL) ? 0U : (hclk <= 60000000UL) ? 1U : 2U));
+        CHECK(CLKPROF_VoltageScale(hclk) == ((hclk <= 60000000UL) ? 3U : 2U));
+
+        // SysTick: exactly 1 ms per reload
+        CHECK((CLKPROF_SysTickReload(hclk, 1000) + 1U) * 1000U == hclk);
+
+        // USART2 (APB1) and USART1/6 (APB2): never worse than the HAL, under 1 %
+        for (uint32_t b = 0; b < sizeof(bauds) / sizeof(bauds[0]); b++) {
+            uint32_t clocks[2] = { pclk1, pclk2 };
+
+            for (uint32_t bus = 0; bus < 2U; bus++) {
+                uint16_t brr = CLKPROF_UartBrr(clocks[bus], bauds[b]);
+                int32_t ppm = CLKPROF_UartErrorPpm(clocks[bus], bauds[b]);
+
+                CHECK(TEST_BaudError(clocks[bus], bauds[b], brr) <=
+                      TEST_BaudError(clocks[bus], bauds[b], TEST_HAL_BRR(clocks[bus], bauds[b])) + 1e-9);
+                CHECK(ppm > -TEST_MAX_ERROR_PPM && ppm < TEST_MAX_ERROR_PPM);
+            }
+            printf("  USART2 %6lu baud: BRR 0x%04X, %ld ppm\n", (unsigned long)bauds[b],
+                   CLKPROF_UartBrr(pclk1, bauds[b]), (long)CLKPROF_UartErrorPpm(pclk1, bauds[b]));
+        }
+
+        // Timers on both buses: the counter rate is exact
+        for (uint8_t apb2 = 0; apb2 < 2U; apb2++) {
+            uint32_t clock = CLKPROF_TimerClockHz(p, apb2);
+            uint8_t div = apb2 ? p->apb2_div : p->apb1_div;
+
+            CHECK(clock == ((div == 1U) ? 1U : 2U) * (apb2 ? pclk2 : pclk1));
+            for (uint32_t t = 0; t < sizeof(ticks) / sizeof(ticks[0]); t++) {
+                CHECK((uint32_t)(CLKPROF_TimerPrescaler(clock, ticks[t]) + 1U) * ticks[t] == clock);
+            }
+        }
+
+        // ADC: never clocked faster than at the nominal PCLK2, same clock when possible
+        for (uint32_t a = 0; a < ADCPROF_COUNT; a++) {
+            const ADCPROF_ProfileTypeDef *ap = ADCPROF_Get((ADCPROF_IdTypeDef)a);
+            uint32_t fadc = ADCPROF_AdcClockHz(ap, pclk2);
+            uint32_t nominal = ADCPROF_NOMINAL_PCLK2_HZ / ap->prescaler;
+
+            CHECK(ADCPROF_IsValid(ap, pclk2));
+            CHECK(fadc <= nominal && fadc <= ADCPROF_ADC_CLOCK_MAX_HZ);
+            CHECK(pclk2 / 2U < nominal || fadc == nominal);
+            printf("  ADC %-8s /%u: %lu Hz, %lu ns per conversion\n", ap->name, ADCPROF_Prescaler(ap, pclk2),
+                   (unsigned long)fadc, (unsigned long)ADCPROF_ConversionTimeNs(ap, pclk2));
+        }
+    }
+
+    // Out of range and broken profiles
+    CHECK(CLKPROF_Get(CLKPROF_COUNT) == NULL);
+    CHECK(!CLKPROF_IsValid(NULL));
+    CLKPROF_ProfileTypeDef bad = CLKPROF_Profiles[CLKPROF_MAX];
+    bad.apb1_div = 1;                                       // PCLK1 84 MHz
+    CHECK(!CLKPROF_IsValid(&bad));
+    bad = CLKPROF_Profiles[CLKPROF_MAX];
+    bad.pll_p = 2;                                          // SYSCLK 168 MHz
+    CHECK(!CLKPROF_IsValid(&bad));
+    bad = CLKPROF_Profiles[CLKPROF_MAX];
+    bad.pll_n = 100;                                        // VCO 100 MHz
+    CHECK(!CLKPROF_IsValid(&bad));
+    CHECK(CLKPROF_UartErrorPpm(1000, 115200) == INT32_MAX);
+
+    // BRR sweep: rounding to the nearest 1/16 is never worse than the HAL
+    uint32_t cases = 0, differ = 0;
+    for (uint32_t pclk = 8000000; pclk <= 84000000UL; pclk += 2000000) {
+        for (uint32_t baud = pclk / 65535U + 1U; baud <= pclk / 16U; baud += baud / 97U + 1U) {
+            uint16_t brr = CLKPROF_UartBrr(pclk, baud);
+            uint32_t hal = TEST_HAL_BRR(pclk, baud);
+
+            CHECK(TEST_BaudError(pclk, baud, brr) <= TEST_BaudError(pclk, baud, hal) + 1e-9);
+            cases++;
+            differ += (brr != hal);
+        }
+    }
+    printf("BRR sweep: %lu cases, %lu differ from the HAL macro, none worse\n",
+           (unsigned long)cases, (unsigned long)differ);
+
+    return HOST_TestResult("clock_profile");
+}
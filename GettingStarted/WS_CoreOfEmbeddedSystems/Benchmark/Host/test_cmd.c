@@ -0,0 +1,244 @@
+/**
+ * @brief Host test and benchmark of the command-line library (cmd.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../Serial_polling/Core/Inc \
+ *              ../Serial_polling/Core/Src/cmd.c Host/test_cmd.c \
+ *              -lm -o test_cmd && ./test_cmd
+ *        The Serial_interrupt and Bluetooth_HC05 copies are identical.
+ *        Round-trips random values through the argument parsers against
+ *        strtol, strtoul and strtof (CMD_ParseFloat is held to its
+ *        documented accuracy), checks the tokenizer and dispatcher, and
+ *        times CMD_Execute against the lowercase-copy + strcmp chain the
+ *        examples used before. Host timings only; nothing was measured on
+ *        the board
+ */
+#include "host_test.h"
+#include "cmd.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Configuration definitions
+#define TEST_VALUES         200000
+#define TEST_LINES          2000000
+#define TEST_LINE_SIZE      256                 // Lowercase copy of the old examples
+
+static uint32_t hits;
+static size_t written;
+
+/**
+ * @brief Output adapter: count the bytes
+ */
+static void TEST_Write(void *io, const char *data, size_t len)
+{
+    (void)io;
+    (void)data;
+    written += len;
+}
+
+/**
+ * @brief Handler of every test command
+ */
+static CMD_StatusTypeDef TEST_Hit(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    (void)out;
+    (void)argc;
+    (void)argv;
+    hits++;
+
+    return CMD_OK;
+}
+
+static const CMD_CommandTypeDef commands[] = {
+    { "ledon",  "",       "LED on",        TEST_Hit, 0, 0 },
+    { "ledoff", "",       "LED off",       TEST_Hit, 0, 0 },
+    { "led",    "on|off", "LED on or off", TEST_Hit, 1, 1 },
+    { "blink",  "<ms>",   "Blink period",  TEST_Hit, 1, 1 },
+    { "stats",  "",       "Statistics",    TEST_Hit, 0, 0 },
+    { "toggle", "",       "Toggle LED",    TEST_Hit, 0, 0 },
+};
+static const CMD_TableTypeDef table = CMD_TABLE(commands);
+
+/**
+ * @brief The dispatch the examples used before the library
+ * @note  Copies the line to a lowercase buffer and compares it with every
+ *        command in turn, as Bluetooth_HC05 and Serial_interrupt did
+ * @param command: Received line
+ */
+static void TEST_StrcmpChain(const char *command)
+{
+    char lower[TEST_LINE_SIZE];
+
+    strncpy(lower, command, sizeof(lower) - 1U);
+    lower[sizeof(lower) - 1U] = '\0';
+    for (int i = 0; lower[i]; i++) {
+        if (lower[i] >= 'A' && lower[i] <= 'Z') {
+            lower[i] = lower[i] + 32;
+        }
+    }
+
+    if (strcmp(lower, "ledon") == 0) {
+        hits++;
+    } else if (strcmp(lower, "ledoff") == 0) {
+        hits++;
+    } else if (strcmp(lower, "led on") == 0) {
+        hits++;
+    } else if (strcmp(lower, "blink 100") == 0) {
+        hits++;
+    } else if (strcmp(lower, "stats") == 0) {
+        hits++;
+    } else if (strcmp(lower, "toggle") == 0) {
+        hits++;
+    } else {
+        char msg[128];
+
+        snprintf(msg, sizeof(msg), "Unknown command: '%s'. Type 'help' for available commands.", command);
+        TEST_Write(NULL, msg, strlen(msg));
+    }
+}
+
+/**
+ * @brief Distance between two floats in units in the last place
+ * @param a: Value
+ * @param b: Value of the same sign
+ * @retval uint32_t: Representable floats between a and b
+ */
+static uint32_t TEST_Ulps(float a, float b)
+{
+    int32_t ia, ib;
+
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+
+    return (uint32_t)((ia > ib) ? ia - ib : ib - ia);
+}
+
+/**
+ * @brief Monotonic time
+ * @retval double: Seconds
+ */
+static double TEST_Now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    CMD_OutputTypeDef out = { TEST_Write, NULL, NULL, NULL };
+    uint32_t off_by_one = 0, worst_far = 0;
+    char s[48];
+
+    for (uint32_t i = 0; i < TEST_VALUES; i++) {
+        int32_t v;
+        uint32_t u;
+        float f;
+
+        // Integers over the whole range
+        int32_t r = (int32_t)HOST_Random();
+        snprintf(s, sizeof(s), "%ld", (long)r);
+        CHECK(CMD_ParseInt(s, &v) == CMD_OK && v == r);
+        snprintf(s, sizeof(s), "%lu", (unsigned long)(uint32_t)r);
+        CHECK(CMD_ParseUint(s, &u) == CMD_OK && u == (uint32_t)r);
+        snprintf(s, sizeof(s), "0x%lX", (unsigned long)(uint32_t)r);
+        CHECK(CMD_ParseHex(s, &u) == CMD_OK && u == strtoul(s, NULL, 16));
+
+        // Up to 7 significant digits, scale within 10: one rounding, exact
+        uint32_t m = HOST_Random() % 10000000U;
+        int32_t e = (int32_t)(HOST_Random() % 21U) - 10;
+        snprintf(s, sizeof(s), "%s%lue%ld", (HOST_Random() & 1U) ? "-" : "", (unsigned long)m, (long)e);
+        CHECK(CMD_ParseFloat(s, &f) == CMD_OK && f == strtof(s, NULL));
+
+        // Fixed-point input as typed, up to 9 significant digits: within 1 ulp
+        snprintf(s, sizeof(s), "%.*f", (int)(HOST_Random() % 6U),
+                 ((double)HOST_Random() - 2147483648.0) / 1000.0);
+        CHECK(CMD_ParseFloat(s, &f) == CMD_OK && TEST_Ulps(f, strtof(s, NULL)) <= 1U);
+        off_by_one += (f != strtof(s, NULL));
+
+        // Exponents beyond 10 round several times: within 2 ulp
+        snprintf(s, sizeof(s), "%.6e", (double)(HOST_Random() % 10000000U + 1U) *
+                 pow(10.0, (double)(HOST_Random() % 60U) - 36.0));
+        CHECK(CMD_ParseFloat(s, &f) == CMD_OK);
+        uint32_t far = TEST_Ulps(f, strtof(s, NULL));
+        worst_far = (far > worst_far) ? far : worst_far;
+    }
+    CHECK(worst_far <= 2U);
+    printf("float: %lu of %u fixed-point inputs 1 ulp off strtof, worst %lu ulp beyond 1e+-10\n",
+           (unsigned long)off_by_one, TEST_VALUES, (unsigned long)worst_far);
+
+    // Malformed and out-of-range arguments, value left alone
+    static const char *const bad_int[] = { "", "-", "+", "1x", "2147483648", "-2147483649", "1 " };
+    for (uint32_t i = 0; i < sizeof(bad_int) / sizeof(bad_int[0]); i++) {
+        int32_t v = 7;
+        CHECK(CMD_ParseInt(bad_int[i], &v) == CMD_ERROR && v == 7);
+    }
+    static const char *const bad_hex[] = { "0x", "0x123456789", "0xG", "" };
+    for (uint32_t i = 0; i < sizeof(bad_hex) / sizeof(bad_hex[0]); i++) {
+        uint32_t u = 7;
+        CHECK(CMD_ParseHex(bad_hex[i], &u) == CMD_ERROR && u == 7U);
+    }
+    static const char *const bad_float[] = { "", ".", "-", "1e", "1.2.3", "1e99", "1x" };
+    for (uint32_t i = 0; i < sizeof(bad_float) / sizeof(bad_float[0]); i++) {
+        float f = 7.0f;
+        CHECK(CMD_ParseFloat(bad_float[i], &f) == CMD_ERROR && f == 7.0f);
+    }
+    int32_t v;
+    uint32_t u;
+    float f;
+    CHECK(CMD_ParseInt("-2147483648", &v) == CMD_OK && v == INT32_MIN);
+    CHECK(CMD_ParseUint("4294967295", &u) == CMD_OK && u == 0xFFFFFFFFUL);
+    CHECK(CMD_ParseUint("4294967296", &u) == CMD_ERROR);
+    CHECK(CMD_ParseFloat("3e-3", &f) == CMD_OK && f == 3e-3f);
+    CHECK(CMD_ParseFloat("-1.25", &f) == CMD_OK && f == -1.25f);
+    uint8_t index;
+    static const char *const states[] = { "off", "on" };
+    CHECK(CMD_ParseEnum("ON", states, 2, &index) == CMD_OK && index == 1U);
+    CHECK(CMD_ParseEnum("onn", states, 2, &index) == CMD_ERROR);
+
+    // Tokenizer: blanks collapse, quotes group, the count is bounded
+    char line[] = "  set  \"a b\" c ";
+    char *argv[CMD_MAX_ARGS];
+    CHECK(CMD_Tokenize(line, argv, CMD_MAX_ARGS) == 3);
+    CHECK(strcmp(argv[0], "set") == 0 && strcmp(argv[1], "a b") == 0 && strcmp(argv[2], "c") == 0);
+    char many[] = "a b c d e f g h i j";
+    CHECK(CMD_Tokenize(many, argv, 4) == -1);
+
+    // Dispatcher: case, argument count, unknown, blank
+    char l1[] = "LEDON", l2[] = "led", l3[] = "bogus", l4[] = "   ", l5[] = "blink 100";
+    hits = 0;
+    CHECK(CMD_Execute(&table, l1, &out) == CMD_OK && hits == 1U);
+    CHECK(CMD_Execute(&table, l2, &out) == CMD_USAGE && hits == 1U);
+    CHECK(CMD_Execute(&table, l3, &out) == CMD_UNKNOWN);
+    CHECK(CMD_Execute(&table, l4, &out) == CMD_EMPTY);
+    CHECK(CMD_Execute(&table, l5, &out) == CMD_OK && hits == 2U);
+
+    // Dispatch cost against the old chain, same lines for both
+    static const char *const input[] = { "ledon", "LEDOFF", "led on", "blink 100", "stats", "toggle", "bogus" };
+    const uint32_t inputs = sizeof(input) / sizeof(input[0]);
+    char buffer[64];
+    uint32_t lib_hits, chain_hits;
+
+    hits = 0;
+    double t0 = TEST_Now();
+    for (uint32_t i = 0; i < TEST_LINES; i++) {
+        strcpy(buffer, input[i % inputs]);      // CMD_Execute works in place
+        CMD_Execute(&table, buffer, &out);
+    }
+    double t1 = TEST_Now();
+    lib_hits = hits;
+    hits = 0;
+    for (uint32_t i = 0; i < TEST_LINES; i++) {
+        TEST_StrcmpChain(input[i % inputs]);
+    }
+    double t2 = TEST_Now();
+    chain_hits = hits;
+
+    CHECK(lib_hits == chain_hits);
+    printf("dispatch on this host: CMD_Execute %.1f ns/line, strcmp chain %.1f ns/line\n",
+           (t1 - t0) / TEST_LINES * 1e9, (t2 - t1) / TEST_LINES * 1e9);
+
+    return HOST_TestResult("cmd");
+}
@@ -0,0 +1,168 @@
+/**
+ * @brief Host replay of button edge traces (UserButton_interrupt project, debounce.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../UserButton_interrupt/Core/Inc \
+ *              ../UserButton_interrupt/Core/Src/debounce.c \
+ *              Host/test_debounce.c -o test_debounce && ./test_debounce
+ *        Replays edge traces through the same glue as button.c: the EXTI
+ *        line is masked on the first edge, later edges only latch the
+ *        pending bit, and the one-pulse timer reports them as 'bounced'.
+ *        The traces are written in the shape of tactile-switch scope
+ *        captures (bursts of 50 us..4 ms pulses on press and release); no
+ *        board capture is included. A trace is a list of edge times in us,
+ *        starting from the released level, so a logic-analyzer export can
+ *        be pasted in as another case
+ */
+#include "host_test.h"
+#include "debounce.h"
+#include <string.h>
+
+// One trace and the events it must produce
+typedef struct {
+    const char *name;
+    const uint32_t *edges;              // Edge times (us), ascending
+    uint32_t count;
+    uint32_t end_us;                    // Simulation length
+    const char *expect;                 // "press@10 release@90 ..." (ms)
+} TEST_TraceTypeDef;
+
+static const char *const event_names[] = { "press", "release", "long", "click", "double" };
+
+// Click: 2 ms press bounce, 0.7 ms release bounce
+static const uint32_t click[] = {
+    10000, 10200, 10350, 10900, 11000, 11600, 12100,
+    90000, 90100, 90700,
+};
+// Double click: two short presses 120 ms apart, each with bounce
+static const uint32_t dbl[] = {
+    10000, 10300, 10500, 80000, 80400, 80600,
+    200000, 200200, 200600, 260000, 260300, 260500,
+};
+// Long press, bounce on both edges
+static const uint32_t held[] = {
+    10000, 10100, 10150, 1500000, 1500300, 1500500,
+};
+// 50 us glitch: nothing confirmed
+static const uint32_t glitch[] = { 10000, 10050 };
+// Worn contact: 4 ms bounces for 32 ms, then a clean release
+static const uint32_t worn[] = {
+    10000, 14000, 18000, 22000, 26000, 30000, 34000, 38000, 42000, 300000,
+};
+// Second press just after the double-click window: two clicks
+static const uint32_t late[] = { 10000, 100000, 420000, 420200, 420400, 500000 };
+// Release bounce landing on the settle timer expiry
+static const uint32_t edge_on_timer[] = { 10000, 60000, 80000, 80001 };
+
+static const TEST_TraceTypeDef traces[] = {
+    { "click", click, 10, 1000000, "press@10 release@90 click@390" },
+    { "double", dbl, 12, 1000000, "press@10 release@80 press@200 double@200 release@260" },
+    { "long", held, 6, 2000000, "press@10 long@810 release@1500" },
+    { "glitch", glitch, 2, 500000, "" },
+    { "worn", worn, 10, 800000, "press@10 release@300 click@600" },
+    { "late", late, 6, 1500000, "press@10 release@100 click@400 press@420 release@500 click@800" },
+    { "edge_on_timer", edge_on_timer, 4, 1000000, "press@10 release@60 click@360" },
+};
+
+/**
+ * @brief Replay one trace with a 1 us time step
+ * @param trace: Trace to replay
+ * @param out: Receives the events as text
+ * @param size: Size of out
+ */
+static void TEST_Replay(const TEST_TraceTypeDef *trace, char *out, size_t size)
+{
+    DEB_InputTypeDef in;
+    DEB_QueueTypeDef queue;
+    DEB_EventTypeDef event;
+    uint8_t level = 0, masked = 0, pending = 0;
+    int64_t timer_at = -1;
+    uint32_t e = 0;
+
+    DEB_QueueInit(&queue);
+    CHECK(DEB_Init(&in, &queue, 3, 0) == DEB_OK);
+
+    for (uint32_t t = 0; t <= trace->end_us; t++) {
+        uint32_t ms = t / 1000U;
+
+        while (e < trace->count && trace->edges[e] == t) {
+            level = !level;
+            e++;
+            if (masked) {
+                pending = 1;                // EXTI->PR latches while IMR is clear
+            } else {
+                masked = 1;                 // BTN_EdgeHandler
+                uint32_t delay = DEB_OnEdge(&in, ms);
+                if (delay != 0U) {
+                    timer_at = t + delay * 1000U;
+                }
+            }
+        }
+
+        if (timer_at == (int64_t)t) {      // BTN_TimerHandler
+            uint8_t bounced = pending;
+
+            timer_at = -1;
+            pending = 0;
+            uint32_t delay = DEB_OnTimer(&in, level, bounced, ms);
+            if (!in.settling) {
+                masked = 0;
+            }
+            if (delay != 0U) {
+                timer_at = t + delay * 1000U;
+            }
+        }
+    }
+
+    // Confirmed level matches the trace once it is quiet
+    CHECK(in.pressed == level && !in.settling);
+
+    out[0] = '\0';
+    while (DEB_QueuePop(&queue, &event)) {
+        size_t len = strlen(out);
+
+        CHECK(event.input == 3U);
+        snprintf(out + len, size - len, "%s%s@%lu", len ? " " : "", event_names[event.id],
+                 (unsigned long)event.time);
+    }
+}
+
+int main(void)
+{
+    char out[256];
+
+    for (uint32_t i = 0; i < sizeof(traces) / sizeof(traces[0]); i++) {
+        TEST_Replay(&traces[i], out, sizeof(out));
+        if (!CHECK(strcmp(out, traces[i].expect) == 0)) {
+            printf("  %s: got \"%s\", expected \"%s\"\n", traces[i].name, out, traces[i].expect);
+        }
+    }
+
+    // Queue: full queue drops and counts, order kept across the index wrap
+    DEB_QueueTypeDef queue;
+    DEB_EventTypeDef event = { DEB_EVT_PRESS, 0, 0 };
+
+    DEB_QueueInit(&queue);
+    queue.head = queue.tail = 0xFFFFFFF8UL;
+    for (uint32_t i = 0; i < DEB_QUEUE_SIZE + 2U; i++) {
+        event.time = i;
+        CHECK(DEB_QueuePush(&queue, &event) == (i < DEB_QUEUE_SIZE));
+    }
+    CHECK(queue.dropped == 2U);
+    for (uint32_t i = 0; i < DEB_QUEUE_SIZE; i++) {
+        CHECK(DEB_QueuePop(&queue, &event) && event.time == i);
+    }
+    CHECK(!DEB_QueuePop(&queue, &event));
+
+    // Button held at boot: no long press, its release is not a click
+    DEB_InputTypeDef in;
+    DEB_QueueInit(&queue);
+    DEB_Init(&in, &queue, 0, 1);
+    CHECK(DEB_OnTimer(&in, 1, 0, 5000) == 0U);
+    CHECK(DEB_OnEdge(&in, 6000) == DEB_SETTLE_MS);
+    CHECK(DEB_OnTimer(&in, 0, 0, 6020) == 0U);
+    CHECK(DEB_QueuePop(&queue, &event) && event.id == DEB_EVT_RELEASE && event.time == 6000U);
+    CHECK(!DEB_QueuePop(&queue, &event));
+    CHECK(DEB_Init(NULL, &queue, 0, 0) == DEB_ERROR);
+
+    return HOST_TestResult("debounce");
+}
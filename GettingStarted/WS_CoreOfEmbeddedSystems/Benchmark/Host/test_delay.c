@@ -0,0 +1,102 @@
+/**
+ * @brief Host test of the delay math (Timer project, delay.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -DDELAY_HOST -I../Timer/Core/Inc \
+ *              ../Timer/Core/Src/delay.c Host/test_delay.c \
+ *              -o test_delay && ./test_delay
+ *        Checks the microsecond-to-cycle conversion against the exact
+ *        ceil(us * hz / 1e6) at every core clock the F401 can run from
+ *        (HSI and PLL, every AHB divider, 1..84 MHz in 250 kHz steps),
+ *        and the SysTick span used by DELAY_UsAdaptive across the HAL
+ *        tick wrap
+ */
+#include "host_test.h"
+#include "delay.h"
+
+// Configuration definitions
+#define TEST_RANDOM_US      20000       // Random durations per clock
+
+static unsigned long plus_one;
+
+/**
+ * @brief Check one conversion: never short, at most one cycle long
+ * @param hz: Core clock
+ * @param us: Microseconds
+ */
+static void TEST_Convert(uint32_t hz, uint32_t us)
+{
+    unsigned __int128 exact = ((unsigned __int128)us * hz + DELAY_US_PER_S - 1U) / DELAY_US_PER_S;
+    uint64_t cycles = DELAY_UsToCycles(us, DELAY_FactorQ32(hz));
+
+    CHECK(cycles >= exact && cycles <= exact + 1U);
+    plus_one += (cycles == exact + 1U);
+}
+
+/**
+ * @brief Check one core clock
+ * @param hz: Core clock
+ */
+static void TEST_Clock(uint32_t hz)
+{
+    static const uint32_t us_list[] = {
+        0, 1, 2, 3, 5, 7, 10, 50, 99, 100, 999, 1000, 1001, DELAY_SLEEP_MIN_US,
+        50000, 1000000, 12345678, 0x7FFFFFFFUL, 0xFFFFFFFFUL,
+    };
+
+    for (uint32_t i = 0; i < sizeof(us_list) / sizeof(us_list[0]); i++) {
+        TEST_Convert(hz, us_list[i]);
+    }
+    for (uint32_t i = 0; i < TEST_RANDOM_US; i++) {
+        TEST_Convert(hz, HOST_Random());
+    }
+}
+
+int main(void)
+{
+    static const uint32_t sources[] = { 16000000UL, 84000000UL };      // HSI, PLL (this project)
+
+    // HPRE dividers 1..512 of each SYSCLK source
+    for (uint32_t s = 0; s < 2U; s++) {
+        for (uint32_t div = 1; div <= 512U; div *= 2U) {
+            if (div != 32U) {                                           // No /32 on the AHB
+                TEST_Clock(sources[s] / div);
+            }
+        }
+    }
+    for (uint32_t hz = 1000000UL; hz <= 84000000UL; hz += 250000UL) {
+        TEST_Clock(hz);
+    }
+    TEST_Clock(83999999UL);
+    TEST_Clock(12345678UL);
+
+    // Exact microsecond multiples: no rounding to add
+    CHECK(DELAY_UsToCycles(1, DELAY_FactorQ32(84000000UL)) == 84U);
+    CHECK(DELAY_UsToCycles(1000000UL, DELAY_FactorQ32(16000000UL)) == 16000000U);
+    CHECK(DELAY_UsToCycles(0xFFFFFFFFUL, DELAY_FactorQ32(84000000UL)) == 0xFFFFFFFFULL * 84U);
+    printf("conversions one cycle long: %lu\n", plus_one);
+
+    // SysTick span: 1 kHz tick at 84 MHz (LOAD 83999), down-counter
+    const uint32_t load = 83999;
+
+    CHECK(DELAY_TickSpan(100, 50000, 100, 40000, load, 1) == 10000U);
+    CHECK(DELAY_TickSpan(100, 1000, 101, 83000, load, 1) == 2000U);
+    CHECK(DELAY_TickSpan(100, 0, 105, 0, load, 1) == 5U * 84000U);
+    // Across the HAL tick wrap: the span stays short instead of 2^32 ms long
+    CHECK(DELAY_TickSpan(0xFFFFFFFEUL, 1000, 1, 83000, load, 1) == 2U * 84000U + 2000U);
+    CHECK(DELAY_TickSpan(0xFFFFFFFFUL, 0, 0xFFFFFFFFUL, 0, load, 1) == 0U);
+    // 10 ms tick (uwTickFreq 10): HAL tick advances by 10 per reload
+    CHECK(DELAY_TickSpan(0xFFFFFFF6UL, 500000, 0, 840000, 839999, 10) == 500000U);
+
+    // A 2 s adaptive wait starting 1 s before the wrap ends on time
+    const uint64_t wait = DELAY_UsToCycles(2000000UL, DELAY_FactorQ32(84000000UL));
+    uint32_t tick0 = 0xFFFFFFFFUL - 1000U, val0 = 42000, tick = tick0, val = val0;
+    uint32_t reloads = 0;
+
+    while (DELAY_TickSpan(tick0, val0, tick, val, load, 1) < wait) {
+        tick++;
+        reloads++;
+    }
+    CHECK(reloads == 2000U);
+
+    return HOST_TestResult("delay");
+}
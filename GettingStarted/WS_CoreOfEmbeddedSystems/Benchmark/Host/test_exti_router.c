@@ -0,0 +1,235 @@
+/**
+ * @brief Host test of the EXTI router (UserButton_interrupt project, exti_router.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -IHost/stub -I../UserButton_interrupt/Core/Inc \
+ *              ../UserButton_interrupt/Core/Src/exti_router.c \
+ *              Host/test_exti_router.c -o test_exti_router && ./test_exti_router
+ *        Drives EXTIR_Dispatch against the stub EXTI register block: only
+ *        unmasked lines of the calling interrupt are acknowledged and
+ *        dispatched, highest line first, before their handlers run, and
+ *        masked lines keep their pending bit for drivers that poll it.
+ *        Checks the NVIC setup of EXTIR_Register, then times a dispatch
+ *        with 1 and with 16 routed lines. Host timings only; nothing was
+ *        measured on the board
+ */
+#include "host_test.h"
+#include "exti_router.h"
+#include "stm32f4xx_hal.h"
+#include <time.h>
+
+// Configuration definitions
+#define TEST_ROUNDS         100000
+#define TEST_DISPATCHES     2000000
+#define TEST_REPEATS        5                   // Best of, against host noise
+#define TEST_NOISE          2.0                 // Allowed 16-line / 1-line time ratio
+#define TEST_LINE(n)        (1UL << (n))
+
+// Stub EXTI registers and the pending state they stand for
+EXTI_TypeDef HOST_Exti;
+static uint32_t latched;                // Edges latched in PR
+static uint32_t edges;                  // Edges raised while handlers run
+
+// Stub NVIC
+static uint64_t nvic_enabled;
+static uint32_t nvic_priority[64];
+
+// Handler log
+static uint32_t calls[EXTIR_LINES];
+static uint32_t order[EXTIR_LINES];
+static uint32_t ncalls;
+
+void HAL_NVIC_SetPriority(IRQn_Type irqn, uint32_t preempt_priority, uint32_t sub_priority)
+{
+    (void)sub_priority;
+    nvic_priority[irqn] = preempt_priority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    nvic_enabled |= 1ULL << irqn;
+}
+
+/**
+ * @brief One EXTI interrupt: EXTIR_Dispatch on the latched edges
+ * @note  Applies the write-1-to-clear of EXTI->PR after the call; edges
+ *        raised by the handlers are latched again
+ * @param lines: Lines served by the calling interrupt
+ */
+static void TEST_Dispatch(uint32_t lines)
+{
+    EXTI->PR = latched;
+    edges = 0;
+    EXTIR_Dispatch(lines);
+    latched = (latched & ~EXTI->PR) | edges;
+}
+
+/**
+ * @brief Line handler: check its context and log the call
+ * @param line: EXTI line
+ * @param ctx: Registered context (line + 100)
+ */
+static void TEST_Handler(uint32_t line, void *ctx)
+{
+    CHECK((uintptr_t)ctx == line + 100U);
+    CHECK(((EXTI->PR >> line) & 1U) == 1U);     // Acknowledged before the handler runs
+    calls[line]++;
+    if (ncalls < EXTIR_LINES) {
+        order[ncalls] = line;
+    }
+    ncalls++;
+}
+
+/**
+ * @brief Handler that raises its own line again, as a new edge would
+ * @param line: EXTI line
+ * @param ctx: Unused
+ */
+static void TEST_Retrigger(uint32_t line, void *ctx)
+{
+    (void)ctx;
+    calls[line]++;
+    edges |= 1UL << line;
+}
+
+/**
+ * @brief Handler of the timing runs: count the call
+ * @param line: Unused
+ * @param ctx: Call counter
+ */
+static void TEST_Count(uint32_t line, void *ctx)
+{
+    (void)line;
+    (*(uint32_t *)ctx)++;
+}
+
+/**
+ * @brief Monotonic time
+ * @retval double: Seconds
+ */
+static double TEST_Now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Time the dispatch of the user button line (13)
+ * @param routed: Number of routed lines, line 13 first (1..16)
+ * @retval double: Best time per EXTIR_Dispatch call in ns
+ */
+static double TEST_TimeDispatch(uint32_t routed)
+{
+    uint32_t count = 0;
+    double best = 1e9;
+
+    for (uint32_t line = 0; line < EXTIR_LINES; line++) {
+        EXTIR_Unregister(line);
+    }
+    for (uint32_t i = 0; i < routed; i++) {
+        EXTIR_Register((13U + i) % EXTIR_LINES, TEST_Count, &count);
+    }
+    EXTI->IMR = 0xFFFFU;
+
+    for (uint32_t r = 0; r < TEST_REPEATS; r++) {
+        double t0 = TEST_Now();
+        for (uint32_t i = 0; i < TEST_DISPATCHES; i++) {
+            EXTI->PR = TEST_LINE(13);
+            EXTIR_Dispatch(EXTIR_GROUP_15_10);
+        }
+        double t = (TEST_Now() - t0) / TEST_DISPATCHES * 1e9;
+        best = (t < best) ? t : best;
+    }
+    CHECK(count == TEST_REPEATS * TEST_DISPATCHES);
+
+    return best;
+}
+
+int main(void)
+{
+    static const uint32_t groups[] = {
+        TEST_LINE(0), TEST_LINE(1), TEST_LINE(2), TEST_LINE(3), TEST_LINE(4),
+        EXTIR_GROUP_9_5, EXTIR_GROUP_15_10,
+    };
+    static const IRQn_Type irqn[EXTIR_LINES] = {
+        EXTI0_IRQn, EXTI1_IRQn, EXTI2_IRQn, EXTI3_IRQn, EXTI4_IRQn,
+        EXTI9_5_IRQn, EXTI9_5_IRQn, EXTI9_5_IRQn, EXTI9_5_IRQn, EXTI9_5_IRQn,
+        EXTI15_10_IRQn, EXTI15_10_IRQn, EXTI15_10_IRQn, EXTI15_10_IRQn, EXTI15_10_IRQn, EXTI15_10_IRQn,
+    };
+
+    // Even lines routed, odd lines not; each enables the interrupt serving it
+    for (uint32_t line = 0; line < EXTIR_LINES; line += 2U) {
+        CHECK(EXTIR_Register(line, TEST_Handler, (void *)(uintptr_t)(line + 100U)) == EXTIR_OK);
+        CHECK(((nvic_enabled >> irqn[line]) & 1U) == 1U);
+        CHECK(nvic_priority[irqn[line]] == EXTIR_IRQ_PRIORITY);
+    }
+    CHECK(((nvic_enabled >> EXTI1_IRQn) & 1U) == 0U && ((nvic_enabled >> EXTI3_IRQn) & 1U) == 0U);
+    CHECK(EXTIR_Register(EXTIR_LINES, TEST_Handler, NULL) == EXTIR_ERROR);
+    CHECK(EXTIR_Register(3, NULL, NULL) == EXTIR_ERROR);
+    CHECK(EXTIR_Unregister(EXTIR_LINES) == EXTIR_ERROR);
+
+    // The groups cover lines 0..15 exactly once
+    uint32_t all = 0;
+    for (uint32_t g = 0; g < sizeof(groups) / sizeof(groups[0]); g++) {
+        CHECK((all & groups[g]) == 0U);
+        all |= groups[g];
+    }
+    CHECK(all == 0xFFFFU);
+
+    for (uint32_t round = 0; round < TEST_ROUNDS; round++) {
+        uint32_t lines = groups[round % (sizeof(groups) / sizeof(groups[0]))];
+        uint32_t before[EXTIR_LINES];
+        uint32_t pr = HOST_Random() & 0xFFFFFU;     // Lines 16..19 (PVD, RTC, ...) too
+
+        latched = pr;
+        EXTI->IMR = HOST_Random() & 0xFFFFFU;
+        ncalls = 0;
+        for (uint32_t line = 0; line < EXTIR_LINES; line++) {
+            before[line] = calls[line];
+        }
+
+        TEST_Dispatch(lines);
+
+        // Unmasked lines of this interrupt: cleared, routed ones called once
+        uint32_t served = pr & EXTI->IMR & lines;
+        CHECK(EXTI->PR == served);
+        for (uint32_t line = 0; line < EXTIR_LINES; line++) {
+            uint32_t expect = ((served >> line) & 1U) && (line % 2U == 0U);
+            CHECK(calls[line] - before[line] == expect);
+        }
+        // Masked lines and lines of other interrupts keep their pending bit
+        CHECK(latched == (pr & ~served));
+        // Highest line first
+        for (uint32_t i = 1; i < ncalls && i < EXTIR_LINES; i++) {
+            CHECK(order[i] < order[i - 1U]);
+        }
+    }
+
+    // Unrouted line: cleared and ignored
+    CHECK(EXTIR_Unregister(12) == EXTIR_OK);
+    latched = TEST_LINE(12);
+    EXTI->IMR = 0xFFFFU;
+    ncalls = 0;
+    TEST_Dispatch(EXTIR_GROUP_15_10);
+    CHECK(latched == 0U && ncalls == 0U);
+
+    // An edge during the handler stays pending and raises the interrupt again
+    CHECK(EXTIR_Register(13, TEST_Retrigger, NULL) == EXTIR_OK);
+    latched = TEST_LINE(13);
+    TEST_Dispatch(EXTIR_GROUP_15_10);
+    CHECK(latched == TEST_LINE(13) && calls[13] == 1U);
+
+    // Replacing a handler keeps the new context
+    CHECK(EXTIR_Register(13, TEST_Handler, (void *)(uintptr_t)113U) == EXTIR_OK);
+    TEST_Dispatch(EXTIR_GROUP_15_10);
+    CHECK(latched == 0U && calls[13] == 2U);
+
+    // Dispatch cost with the button line pending: independent of the routed lines
+    double one = TEST_TimeDispatch(1);
+    double sixteen = TEST_TimeDispatch(EXTIR_LINES);
+    CHECK(sixteen <= one * TEST_NOISE);
+    printf("dispatch on this host: %.1f ns with 1 routed line, %.1f ns with 16\n", one, sixteen);
+
+    return HOST_TestResult("exti_router");
+}
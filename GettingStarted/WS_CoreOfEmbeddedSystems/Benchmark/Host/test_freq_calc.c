@@ -0,0 +1,189 @@
+/**
+ * @brief Host test of the capture math (Timer project, freq_calc.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../Timer/Core/Inc ../Timer/Core/Src/freq_calc.c \
+ *              Host/test_freq_calc.c -lm -o test_freq_calc && ./test_freq_calc
+ *        Replays synthetic capture rings through FCALC_AddRing as the DMA
+ *        meter does, across counter wraps and at extreme duty cycles
+ */
+#include "host_test.h"
+#include "freq_calc.h"
+#include <math.h>
+
+// Configuration definitions
+#define TEST_RING_LEN   64              // Capture ring length (freq_meter.c uses a power of 2 too)
+#define TEST_TICK_HZ    84000000UL      // TIM2/TIM5 at 84 MHz, PSC 0
+
+// Synthetic input: ideal square wave sampled by the capture counter
+typedef struct {
+    double period;          // Ticks
+    double duty;            // 0..1
+    double t;               // Time of the next edge (ticks)
+    uint8_t high;           // Level after the next edge is 0 (falling) when set
+    uint32_t mask;          // Counter range - 1
+} TEST_SignalTypeDef;
+
+/**
+ * @brief Produce the next edge
+ * @param s: Signal
+ * @param rising: Set to 1 for a rising edge
+ * @retval uint32_t: Raw capture
+ */
+static uint32_t TEST_NextEdge(TEST_SignalTypeDef *s, uint8_t *rising)
+{
+    uint32_t raw = (uint32_t)(uint64_t)s->t & s->mask;
+
+    *rising = !s->high;
+    s->t += s->high ? s->period * (1.0 - s->duty) : s->period * s->duty;
+    s->high = !s->high;
+
+    return raw;
+}
+
+/**
+ * @brief Capture a signal into rings and consume them in chunks
+ * @param bits: Counter width
+ * @param period: Signal period in ticks
+ * @param duty: Duty cycle
+ * @param start_high: Signal is high at start (first capture is a falling edge)
+ * @param start_t: Counter value at the first edge, e.g. just below a wrap
+ * @param periods: Rising edges to capture
+ * @param chunk: Rising edges between two ring reads
+ * @param result: Filled from the accumulated batch
+ * @retval uint8_t: Fall offset found
+ */
+static uint8_t TEST_Run(uint8_t bits, double period, double duty, uint8_t start_high, double start_t,
+                        uint32_t periods, uint32_t chunk, FCALC_ResultTypeDef *result)
+{
+    static uint32_t rise[TEST_RING_LEN], fall[TEST_RING_LEN];
+    FCALC_AccumTypeDef acc;
+    TEST_SignalTypeDef sig = { period, duty, start_t, start_high, 0 };
+    uint32_t nr = 0, ri = 0, fi = 0, next = 0;
+    uint8_t aligned = 0, offset = 0;
+
+    FCALC_Init(&acc, bits);
+    sig.mask = acc.mask;
+
+    while (nr < periods) {
+        uint8_t rising;
+        uint32_t raw = TEST_NextEdge(&sig, &rising);
+
+        if (rising) {
+            rise[ri] = raw;
+            ri = (ri + 1U) % TEST_RING_LEN;
+            nr++;
+        } else {
+            fall[fi] = raw;
+            fi = (fi + 1U) % TEST_RING_LEN;
+            continue;
+        }
+
+        if (nr % chunk != 0U || nr < 2U) {
+            continue;
+        }
+        if (!aligned) {
+            offset = FCALC_FallOffset(acc.mask, rise[0], rise[1], fall[0]);
+            aligned = 1;
+        }
+        // Every period up to the newest rising edge has its falling edge captured
+        next = FCALC_AddRing(&acc, rise, fall, TEST_RING_LEN, next, ri, offset);
+    }
+
+    FCALC_GetResult(&acc, TEST_TICK_HZ, result);
+    return offset;
+}
+
+/**
+ * @brief Check a run against the ideal signal
+ * @param r: Result
+ * @param period: Period in ticks
+ * @param duty: Duty cycle
+ */
+static void TEST_Expect(const FCALC_ResultTypeDef *r, double period, double duty)
+{
+    double freq = TEST_TICK_HZ / period;
+
+    CHECK(r->errors == 0U);
+    CHECK(r->cycles > 0U);
+    CHECK(fabs(r->freq_mhz / 1000.0 - freq) / freq < 1e-6 + 0.0015 / freq);
+    CHECK(fabs(r->period_ns - period * 1e9 / TEST_TICK_HZ) <= 1.0);
+    // Captures truncate the edge times: at most one tick of the period per cycle
+    CHECK(fabs(r->duty_ppm - duty * 1e6) <= 1e6 / period + 1.0);
+    CHECK(r->jitter_ns <= (uint32_t)(1e9 / TEST_TICK_HZ) + 1U);
+}
+
+int main(void)
+{
+    FCALC_ResultTypeDef r;
+    static const double freqs[] = { 2600.0, 10000.0, 123456.7, 1000000.0 };
+
+    // 16-bit counter: wraps every 780 us at 84 MHz, so every run crosses it;
+    // 2600 Hz is about the lowest, periods must stay under half the range
+    for (uint32_t i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++) {
+        double period = TEST_TICK_HZ / freqs[i];
+
+        for (uint8_t h = 0; h < 2U; h++) {
+            uint8_t offset = TEST_Run(16, period, 0.3 + 0.4 * h, h, 65530.2, 4000, 17, &r);
+
+            CHECK(offset == h);
+            TEST_Expect(&r, period, 0.3 + 0.4 * h);
+        }
+    }
+
+    // 32-bit counter starting just below its wrap
+    TEST_Run(32, 8400.0, 0.5, 0, 4294967295.0 - 20000.0, 2000, 31, &r);
+    TEST_Expect(&r, 8400.0, 0.5);
+
+    // Duty edge cases: one tick high, one tick low
+    TEST_Run(16, 1000.0, 1.0 / 1000.0, 0, 100.5, 500, 7, &r);
+    TEST_Expect(&r, 1000.0, 1.0 / 1000.0);
+    TEST_Run(16, 1000.0, 999.0 / 1000.0, 1, 100.5, 500, 7, &r);
+    TEST_Expect(&r, 1000.0, 999.0 / 1000.0);
+
+    // Longest 16-bit period (just under half the range) across the wrap
+    TEST_Run(16, 32767.0, 0.5, 0, 65535.0, 200, 3, &r);
+    TEST_Expect(&r, 32767.0, 0.5);
+
+    // Fall offset: falling capture inside the first period, or before it
+    CHECK(FCALC_FallOffset(0xFFFF, 65500, 100, 65530) == 0U);
+    CHECK(FCALC_FallOffset(0xFFFF, 65500, 100, 65490) == 1U);
+    CHECK(FCALC_FallOffset(0xFFFF, 10, 110, 110) == 1U);
+
+    // Rejected cycles: no high time, high time not inside the period, zero period
+    FCALC_AccumTypeDef acc;
+    FCALC_Init(&acc, 16);
+    FCALC_AddCycle(&acc, 0, 1000);          // Primes only
+    CHECK(acc.cycles == 0U && acc.errors == 0U);
+    FCALC_AddCycle(&acc, 1000, 2000);       // High 0
+    FCALC_AddCycle(&acc, 3000, 3000);       // High == period
+    FCALC_AddCycle(&acc, 3500, 3000);       // Zero period
+    CHECK(acc.errors == 3U && acc.cycles == 0U);
+    FCALC_AddCycle(&acc, 3250, 4000);       // 1000 ticks, 250 high
+    CHECK(acc.cycles == 1U);
+    FCALC_GetResult(&acc, TEST_TICK_HZ, &r);
+    CHECK(r.freq_mhz == 84000000U && r.duty_ppm == 250000U && r.errors == 3U && r.jitter_ns == 0U);
+
+    // Extended timestamps keep counting across the 16-bit wrap
+    FCALC_Init(&acc, 16);
+    FCALC_AddCycle(&acc, 0, 65000);
+    for (uint32_t k = 1; k <= 100U; k++) {
+        FCALC_AddCycle(&acc, (65000U + 1000U * k - 400U) & 0xFFFFU, (65000U + 1000U * k) & 0xFFFFU);
+    }
+    CHECK(acc.timestamp == 100000U);
+    CHECK(FCALC_Extend(&acc, (65000U + 100000U + 123U) & 0xFFFFU) == 100123U);
+
+    // Restart drops the edge history only; ClearBatch drops the totals only
+    FCALC_Restart(&acc);
+    FCALC_AddCycle(&acc, 0, 5);
+    CHECK(acc.cycles == 100U && acc.timestamp == 100000U && acc.prev_rise == 5U);
+    FCALC_ClearBatch(&acc);
+    FCALC_GetResult(&acc, TEST_TICK_HZ, &r);
+    CHECK(r.freq_mhz == 0U && r.period_ns == 0U && r.cycles == 0U);
+
+    // No tick rate: no result rather than a division by zero
+    FCALC_AddCycle(&acc, 500, 1005);
+    FCALC_GetResult(&acc, 0, &r);
+    CHECK(r.freq_mhz == 0U && r.cycles == 1U);
+
+    return HOST_TestResult("freq_calc");
+}
@@ -0,0 +1,387 @@
+/**
+ * @brief Host harness of the Bluetooth_HC05 command path (hc05_driver.c, cmd.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          BT=../../../AdvancedPulseProjects/WS_AdvancedProjects/Bluetooth_HC05
+ *          gcc -O2 -Wall -pthread -IHost/stub -I$BT/HC05_Driver -I$BT/Core/Inc \
+ *              $BT/HC05_Driver/hc05_driver.c $BT/Core/Src/cmd.c \
+ *              Host/test_hc05_cmd.c -o test_hc05_cmd && ./test_hc05_cmd
+ *        Runs the example's command handling both ways on the same lines:
+ *        the old copy path (the line copied into a 256-byte main loop
+ *        buffer by HC05_ReceiveData, replies formatted on the stack and
+ *        sent with the blocking HAL_UART_Transmit) and the in-place path
+ *        (HC05_GetLine / HC05_ReleaseLine, replies written into the TX
+ *        slots by HC05_TxReserve / HC05_TxCommit). Both must send the
+ *        same bytes. Reports the stack each path uses, painted on a
+ *        thread stack of its own, and the host time per command.
+ *        The stub makes the blocking transmit free, so host time cannot
+ *        show the wire time the old path spent per reply; the target
+ *        cases hc05_rx_copy, hc05_rx_inplace and hc05_tx_queue_16B
+ *        measure it in cycles. The 256-byte memset the old
+ *        HC05_ClearBuffer did is gone from the driver and not reproduced.
+ *        The %lu format warning from hc05_driver.c is host-only
+ */
+#include "host_test.h"
+#include "hc05_driver.h"
+#include "cmd.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+// Configuration definitions
+#define TEST_COMMANDS       200000
+#define TEST_STACK_SIZE     (64UL * 1024U)      // Thread stack painted for the measurement
+#define TEST_STACK_PAINT    0xA5
+#define TEST_LOG_SIZE       4096
+#define RESPONSE_PREFIX     "[STM32]: "         // As Bluetooth_HC05 main.c
+
+static UART_HandleTypeDef huart1;
+static GPIO_TypeDef gpioa;
+static HC05_HandleTypeDef hc05;
+static uint32_t tick;
+static uint8_t led;
+
+// Bytes sent to the module, per path
+static char tx_log[TEST_LOG_SIZE];
+static size_t tx_log_len;
+static uint32_t tx_pending;                 // Interrupt transmission started, not completed
+
+// HAL stand-ins (Host/stub/stm32f4xx_hal.h)
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    (void)port;
+    (void)pin;
+    (void)state;
+}
+
+void HAL_Delay(uint32_t ms)
+{
+    tick += ms;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return tick;
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+    huart->rx_ptr = NULL;
+    huart->RxState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *data, uint16_t size)
+{
+    (void)size;
+    if (huart->RxState != HAL_UART_STATE_READY) {
+        return HAL_BUSY;
+    }
+    huart->rx_ptr = data;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
+{
+    huart->rx_ptr = NULL;
+    huart->RxState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+/**
+ * @brief Keep the bytes sent, for the comparison of the two paths
+ */
+static void TEST_Sent(const uint8_t *data, uint16_t size)
+{
+    if (tx_log_len + size < TEST_LOG_SIZE) {
+        memcpy(tx_log + tx_log_len, data, size);
+        tx_log_len += size;
+    }
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)timeout;
+    if (huart->tx_busy) {
+        return HAL_BUSY;
+    }
+    TEST_Sent(data, size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size)
+{
+    if (huart->tx_busy) {
+        return HAL_BUSY;
+    }
+    huart->tx_busy = 1;
+    tx_pending++;
+    TEST_Sent(data, size);
+    return HAL_OK;
+}
+
+/**
+ * @brief Receive a line: one UART interrupt per byte
+ * @param line: Bytes, line end included
+ */
+static void TEST_Receive(const char *line)
+{
+    for (; *line != '\0'; line++) {
+        *huart1.rx_ptr = (uint8_t)*line;
+        huart1.rx_ptr = NULL;
+        huart1.RxState = HAL_UART_STATE_READY;
+        HC05_IRQHandler(&hc05);
+    }
+}
+
+/**
+ * @brief Complete the interrupt transmissions, one TX complete interrupt each
+ */
+static void TEST_TxDrain(void)
+{
+    while (huart1.tx_busy) {
+        huart1.tx_busy = 0;
+        HC05_TxCpltHandler(&hc05);
+    }
+}
+
+// The example's commands (Bluetooth_HC05 main.c), without the LED pin
+static CMD_StatusTypeDef TEST_LedOn(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    led = 1;
+    CMD_Print(out, RESPONSE_PREFIX "LED ON - User LED activated\r\n");
+    return CMD_OK;
+}
+
+static CMD_StatusTypeDef TEST_LedOff(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    led = 0;
+    CMD_Print(out, RESPONSE_PREFIX "LED OFF - User LED deactivated\r\n");
+    return CMD_OK;
+}
+
+static CMD_StatusTypeDef TEST_Led(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    static const char *const states[] = { "off", "on" };
+    uint8_t state;
+
+    if (CMD_ParseEnum(argv[1], states, 2, &state) != CMD_OK) {
+        return CMD_ERROR;
+    }
+    return state ? TEST_LedOn(out, argc, argv) : TEST_LedOff(out, argc, argv);
+}
+
+static CMD_StatusTypeDef TEST_Boot(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    CMD_Printf(out, RESPONSE_PREFIX "ready %lu ms, first command %lu ms\r\n", 105UL, 205UL);
+    CMD_Printf(out, RESPONSE_PREFIX "HC-05 config %s\r\n", "applied");
+    return CMD_OK;
+}
+
+static const CMD_CommandTypeDef commands[] = {
+    { "ledon",  "",       "Turn ON user LED",  TEST_LedOn,  0, 0 },
+    { "ledoff", "",       "Turn OFF user LED", TEST_LedOff, 0, 0 },
+    { "led",    "on|off", "Set user LED",      TEST_Led,    1, 1 },
+    { "boot",   "",       "Boot timing",       TEST_Boot,   0, 0 },
+};
+static const CMD_TableTypeDef command_table = CMD_TABLE(commands);
+
+/**
+ * @brief Old command output: blocking transmit of every piece
+ */
+static void TEST_OldWrite(void *io, const char *data, size_t len)
+{
+    HAL_UART_Transmit(((HC05_HandleTypeDef *)io)->huart, (const uint8_t *)data, len, HC05_UART_TIMEOUT);
+}
+
+/**
+ * @brief In-place command output: TX queue, slots written directly
+ */
+static void TEST_NewWrite(void *io, const char *data, size_t len)
+{
+    HC05_Write((HC05_HandleTypeDef *)io, data, len);
+}
+
+static char *TEST_NewReserve(void *io, size_t *size)
+{
+    return HC05_TxReserve((HC05_HandleTypeDef *)io, size);
+}
+
+static void TEST_NewCommit(void *io, size_t len)
+{
+    HC05_TxCommit((HC05_HandleTypeDef *)io, len);
+}
+
+static const CMD_OutputTypeDef old_out = { TEST_OldWrite, &hc05, NULL, NULL };
+static const CMD_OutputTypeDef new_out = { TEST_NewWrite, &hc05, TEST_NewReserve, TEST_NewCommit };
+
+/**
+ * @brief ProcessBluetoothCommand of the example
+ */
+static void TEST_Process(char *command, const CMD_OutputTypeDef *out)
+{
+    if (CMD_Execute(&command_table, command, out) == CMD_ERROR) {
+        CMD_Print(out, RESPONSE_PREFIX "Invalid argument. Type 'help' for available commands.\r\n");
+    }
+}
+
+/**
+ * @brief One main loop pass, old copy path (before the in-place driver)
+ */
+static __attribute__((noinline)) void TEST_OldPoll(void)
+{
+    if (HC05_DataAvailable(&hc05)) {
+        char received_data[HC05_BUFFER_SIZE];
+
+        if (HC05_ReceiveData(&hc05, received_data, sizeof(received_data)) == HC05_OK) {
+            TEST_Process(received_data, &old_out);
+        }
+    }
+}
+
+/**
+ * @brief One main loop pass, in-place path (current example)
+ */
+static __attribute__((noinline)) void TEST_NewPoll(void)
+{
+    char *received_line = HC05_GetLine(&hc05);
+
+    if (received_line != NULL) {
+        TEST_Process(received_line, &new_out);
+        HC05_ReleaseLine(&hc05);
+    }
+}
+
+/**
+ * @brief Nothing: the thread's own stack use, subtracted from the paths
+ */
+static __attribute__((noinline)) void TEST_Idle(void)
+{
+}
+
+static uint8_t test_stack[TEST_STACK_SIZE] __attribute__((aligned(64)));
+static void (*test_stack_fn)(void);
+
+static void *TEST_StackThread(void *arg)
+{
+    (void)arg;
+    test_stack_fn();
+    return NULL;
+}
+
+/**
+ * @brief Stack used by a function, painted as mem_usage.c does on the target
+ * @note  Runs it on a thread whose stack is filled with TEST_STACK_PAINT
+ *        and counts the bytes that changed
+ * @param fn: Function to measure
+ * @retval uint32_t: Stack bytes used, thread start included
+ */
+static uint32_t TEST_StackBytes(void (*fn)(void))
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+    uint32_t untouched = 0;
+
+    memset(test_stack, TEST_STACK_PAINT, sizeof(test_stack));
+    test_stack_fn = fn;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, test_stack, sizeof(test_stack));
+    CHECK(pthread_create(&thread, &attr, TEST_StackThread, NULL) == 0);
+    pthread_join(thread, NULL);
+    pthread_attr_destroy(&attr);
+
+    while (untouched < sizeof(test_stack) && test_stack[untouched] == TEST_STACK_PAINT) {
+        untouched++;
+    }
+
+    return (uint32_t)(sizeof(test_stack) - untouched);
+}
+
+/**
+ * @brief Monotonic time
+ * @retval double: Seconds
+ */
+static double TEST_Now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    static const char *const input[] = {
+        "ledon\r\n", "LED off\r\n", "led on\r\n", "boot\r\n", "help\r\n", "led maybe\r\n", "bogus\r\n",
+    };
+    const uint32_t inputs = sizeof(input) / sizeof(input[0]);
+    static char old_log[TEST_LOG_SIZE];
+    void (*const polls[2])(void) = { TEST_OldPoll, TEST_NewPoll };
+    uint32_t stack[2];
+    size_t old_len = 0;
+    uint8_t old_led = 0;
+    double ns[2];
+
+    huart1.Init.BaudRate = 9600;
+    HAL_UART_Init(&huart1);
+    CHECK(HC05_Init(&hc05, &huart1, &gpioa, 0) == HC05_OK);
+
+    // Warm up on the thread: the first calls into the C library resolve
+    // its symbols, on a stack of their own
+    for (uint32_t i = 0; i < inputs; i++) {
+        for (uint32_t path = 0; path < 2U; path++) {
+            TEST_Receive(input[i]);
+            TEST_StackBytes(polls[path]);
+            TEST_TxDrain();
+        }
+    }
+    uint32_t idle = TEST_StackBytes(TEST_Idle);
+
+    // Same lines both ways: the same bytes go out, the same LED state, and
+    // less stack in place (glibc's vsnprintf dominates the CMD_Printf lines)
+    printf("stack per command (host): copy path / in-place path\n");
+    for (uint32_t i = 0; i < inputs; i++) {
+        for (uint32_t path = 0; path < 2U; path++) {
+            tx_log_len = 0;
+            tx_pending = 0;
+            TEST_Receive(input[i]);
+            stack[path] = TEST_StackBytes(polls[path]) - idle;
+            TEST_TxDrain();
+
+            CHECK(!HC05_DataAvailable(&hc05) && tx_log_len > 0U);
+            CHECK(path == 0U ? tx_pending == 0U : tx_pending > 0U);
+            if (path == 0U) {
+                memcpy(old_log, tx_log, tx_log_len);
+                old_len = tx_log_len;
+                old_led = led;
+            } else if (!CHECK(tx_log_len == old_len && memcmp(tx_log, old_log, old_len) == 0 && led == old_led)) {
+                printf("  \"%.*s\" differs\n", (int)strcspn(input[i], "\r"), input[i]);
+            }
+        }
+        CHECK(stack[1] < stack[0]);
+        printf("  %-10.*s %5lu B / %5lu B\n", (int)strcspn(input[i], "\r"), input[i],
+               (unsigned long)stack[0], (unsigned long)stack[1]);
+    }
+
+    // Host time per command, reception and TX completion included
+    for (uint32_t path = 0; path < 2U; path++) {
+        double t0 = TEST_Now();
+
+        for (uint32_t i = 0; i < TEST_COMMANDS; i++) {
+            tx_log_len = 0;
+            TEST_Receive(input[i % inputs]);
+            polls[path]();
+            TEST_TxDrain();
+        }
+        ns[path] = (TEST_Now() - t0) / TEST_COMMANDS * 1e9;
+    }
+    printf("time per command on this host: copy path %.0f ns, in-place path %.0f ns\n", ns[0], ns[1]);
+
+    return HOST_TestResult("hc05_cmd");
+}
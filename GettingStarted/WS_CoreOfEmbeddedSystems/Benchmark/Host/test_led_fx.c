@@ -0,0 +1,117 @@
+/**
+ * @brief Host test of the LED effects (BlinkLed project, led_fx.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../BlinkLed/Core/Inc ../BlinkLed/Core/Src/led_fx.c \
+ *              Host/test_led_fx.c -lm -o test_led_fx && ./test_led_fx
+ *        Checks the compile-time gamma table against the formula and a
+ *        true 2.2 power law, then the sequencing: lengths, ramp endpoints
+ *        and direction, seamless segment chaining and the size limits
+ */
+#include "host_test.h"
+#include "led_fx.h"
+#include <math.h>
+
+// Configuration definitions
+#define TEST_RANDOM_SEGMENTS    100000
+
+
+/**
+ * @brief Count the level changes of a rendered sequence
+ * @param out: Rendered compare values
+ * @param n: Steps
+ * @retval uint32_t: Changes between neighbouring steps
+ */
+static uint32_t TEST_Changes(const uint32_t *out, uint32_t n)
+{
+    uint32_t changes = 0;
+
+    for (uint32_t i = 1; i < n; i++) {
+        changes += (out[i] != out[i - 1U]);
+    }
+
+    return changes;
+}
+
+int main(void)
+{
+    static uint32_t out[LEDFX_MAX_STEPS];
+    double worst = 0.0;
+    uint32_t n;
+
+    // Gamma table: the formula rounded, monotonic, full range, near t^2.2
+    CHECK(LEDFX_Gamma[0] == 0U && LEDFX_Gamma[255] == LEDFX_PWM_TOP);
+    for (uint32_t i = 0; i < 256U; i++) {
+        double t = i / 255.0;
+        double formula = LEDFX_PWM_TOP * (0.7 * t * t + 0.3 * t * t * t);
+
+        CHECK(fabs(LEDFX_Gamma[i] - formula) <= 0.5 + 1e-9);
+        CHECK(i == 0U || LEDFX_Gamma[i] >= LEDFX_Gamma[i - 1U]);
+        worst = fmax(worst, fabs(LEDFX_Gamma[i] - LEDFX_PWM_TOP * pow(t, 2.2)) / LEDFX_PWM_TOP);
+    }
+    CHECK(worst < 0.03);
+    printf("gamma: worst deviation from t^2.2 %.2f %% of full scale\n", worst * 100.0);
+
+    // Breathe: 3 s, rising to full at 1.2 s, held, falling, dark
+    LEDFX_PartTypeDef breathe[] = { { &LEDFX_Breathe, 1 } };
+    n = LEDFX_Render(breathe, 1, out, LEDFX_MAX_STEPS);
+    CHECK(n == 300U && n == LEDFX_Length(breathe, 1));
+    CHECK(out[0] == 0U && out[120] == LEDFX_PWM_TOP && out[139] == LEDFX_PWM_TOP);
+    for (uint32_t i = 1; i < 120U; i++) {
+        CHECK(out[i] >= out[i - 1U]);
+    }
+    for (uint32_t i = 141; i < 260U; i++) {
+        CHECK(out[i] <= out[i - 1U]);
+    }
+    for (uint32_t i = 260; i < 300U; i++) {
+        CHECK(out[i] == 0U);
+    }
+    // Looped: dark at both ends, so the loop has no seam
+    CHECK(out[299] == out[0]);
+
+    // Blink code 3: three 150 ms flashes then a 1.5 s gap, only on and off
+    LEDFX_PartTypeDef code[] = { { &LEDFX_CodeBlink, 3 }, { &LEDFX_CodeGap, 1 } };
+    n = LEDFX_Render(code, 2, out, LEDFX_MAX_STEPS);
+    CHECK(n == 3U * 40U + 150U && n == LEDFX_Length(code, 2));
+    CHECK(TEST_Changes(out, n) == 5U);
+    for (uint32_t i = 0; i < n; i++) {
+        CHECK(out[i] == 0U || out[i] == LEDFX_PWM_TOP);
+    }
+    CHECK(out[0] == LEDFX_PWM_TOP && out[14] == LEDFX_PWM_TOP && out[15] == 0U && out[40] == LEDFX_PWM_TOP);
+
+    // Parts chain in order
+    LEDFX_PartTypeDef mixed[] = { { &LEDFX_Heartbeat, 1 }, { &LEDFX_Off, 2 }, { &LEDFX_On, 1 } };
+    n = LEDFX_Render(mixed, 3, out, LEDFX_MAX_STEPS);
+    CHECK(n == 100U + 20U + 10U);
+    CHECK(out[0] == LEDFX_PWM_TOP && out[119] == 0U && out[120] == LEDFX_PWM_TOP && out[n - 1U] == LEDFX_PWM_TOP);
+    CHECK(out[25] == LEDFX_Gamma[200]);         // Second beat starts at level 200
+
+    // Limits: too long for the buffer, missing effect, zero repeats
+    LEDFX_PartTypeDef twice[] = { { &LEDFX_Breathe, 2 } };
+    CHECK(LEDFX_Length(twice, 1) == 600U);
+    CHECK(LEDFX_Render(twice, 1, out, LEDFX_MAX_STEPS) == 0U);
+    LEDFX_PartTypeDef none[] = { { NULL, 1 } };
+    CHECK(LEDFX_Length(none, 1) == 0U && LEDFX_Render(none, 1, out, LEDFX_MAX_STEPS) == 0U);
+    LEDFX_PartTypeDef zero[] = { { &LEDFX_On, 0 } };
+    CHECK(LEDFX_Render(zero, 1, out, LEDFX_MAX_STEPS) == 0U);
+    CHECK(LEDFX_Render(breathe, 1, NULL, LEDFX_MAX_STEPS) == 0U);
+    CHECK(LEDFX_Length(NULL, 1) == 0U);
+    CHECK(LEDFX_MS(100) == 10U && LEDFX_MS(1) == 1U && LEDFX_MS(0) == 0U);
+
+    // Random ramps: start at 'from', move towards 'to', stop one step short
+    for (uint32_t i = 0; i < TEST_RANDOM_SEGMENTS; i++) {
+        LEDFX_SegmentTypeDef seg = { (uint8_t)HOST_Random(), (uint8_t)HOST_Random(),
+                                     (uint16_t)(1U + HOST_Random() % 200U) };
+        LEDFX_EffectTypeDef effect = { &seg, 1 };
+        LEDFX_PartTypeDef part = { &effect, 1 };
+
+        n = LEDFX_Render(&part, 1, out, LEDFX_MAX_STEPS);
+        CHECK(n == seg.steps && out[0] == LEDFX_Gamma[seg.from]);
+        for (uint32_t k = 1; k < n; k++) {
+            CHECK((seg.to >= seg.from) ? out[k] >= out[k - 1U] : out[k] <= out[k - 1U]);
+        }
+        int32_t last = seg.from + ((int32_t)seg.to - seg.from) * (int32_t)(n - 1U) / (int32_t)n;
+        CHECK(out[n - 1U] == LEDFX_Gamma[last]);
+    }
+
+    return HOST_TestResult("led_fx");
+}
@@ -0,0 +1,250 @@
+/**
+ * @brief Host test and benchmark of the receive line ring (Serial_interrupt project, line_ring.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../Serial_interrupt/Core/Inc \
+ *              ../Serial_interrupt/Core/Src/line_ring.c \
+ *              Host/test_line_ring.c -o test_line_ring && ./test_line_ring
+ *        Checks the documented cases (CR/LF pairs, over-long lines, a
+ *        full ring with and without a line end, a dropped line end), then
+ *        replays a producer/consumer run: bursts of received bytes
+ *        between main loop passes, long enough to fill the ring. Every
+ *        line that comes out, and the dropped and flushed counts, must
+ *        match a plain reference queue. Finally times LRING_Put per byte.
+ *        Host timings only; nothing was measured on the board
+ */
+#include "host_test.h"
+#include "line_ring.h"
+#include <string.h>
+#include <time.h>
+
+// Configuration definitions
+#define TEST_LINE_SIZE      80                  // CMD_LINE_SIZE of the example
+#define TEST_STREAM_SIZE    (1UL << 21)
+#define TEST_MAX_BURST      400                 // Bytes between two main loop passes
+#define TEST_PUT_BYTES      20000000
+#define TEST_BATCH          192                 // Bytes per timed batch, fits the ring
+
+// Reference queue: the bytes the ring accepted, oldest first
+static uint8_t model[LRING_SIZE];
+static uint32_t model_count;
+static uint32_t model_dropped;
+static uint32_t model_flushed;
+
+static uint8_t stream[TEST_STREAM_SIZE];
+
+/**
+ * @brief Reference of LRING_Put
+ * @param byte: Received byte
+ */
+static void TEST_ModelPut(uint8_t byte)
+{
+    if (model_count == LRING_SIZE) {
+        model_dropped++;
+        return;
+    }
+    model[model_count++] = byte;
+}
+
+/**
+ * @brief Reference of LRING_GetLine
+ * @param line: Output, null-terminated
+ * @param size: Capacity of line
+ * @retval int32_t: Length of the line as received, -1 if none
+ */
+static int32_t TEST_ModelGetLine(char *line, size_t size)
+{
+    uint32_t end = 0;
+
+    while (end < model_count && model[end] != '\r' && model[end] != '\n') {
+        end++;
+    }
+    if (end == model_count) {
+        if (model_count == LRING_SIZE) {
+            model_flushed += LRING_SIZE;
+            model_count = 0;
+        }
+        return -1;
+    }
+
+    size_t copy = (end < size - 1U) ? end : size - 1U;
+    memcpy(line, model, copy);
+    line[copy] = '\0';
+    model_count -= end + 1U;
+    memmove(model, model + end + 1U, model_count);
+
+    return (int32_t)end;
+}
+
+/**
+ * @brief Fill the stream with what a terminal or a script would send
+ * @note  Short lines ended by CR, LF or CR LF, lines longer than the
+ *        line buffer, and now and then a run longer than the ring
+ *        without any line end
+ * @retval uint32_t: Stream length in bytes
+ */
+static uint32_t TEST_MakeStream(void)
+{
+    static const char *const ends[] = { "\n", "\r", "\r\n" };
+    uint32_t len = 0;
+
+    while (len + 2U * LRING_SIZE + 2U < TEST_STREAM_SIZE) {
+        uint32_t kind = HOST_Random() % 100U;
+        uint32_t chars = (kind < 80U) ? HOST_Random() % 40U :
+                         (kind < 97U) ? TEST_LINE_SIZE + HOST_Random() % 150U :
+                                        LRING_SIZE + HOST_Random() % LRING_SIZE;
+
+        for (uint32_t i = 0; i < chars; i++) {
+            stream[len++] = (uint8_t)('a' + HOST_Random() % 26U);
+        }
+        const char *end = ends[HOST_Random() % 3U];
+        memcpy(stream + len, end, strlen(end));
+        len += (uint32_t)strlen(end);
+    }
+
+    return len;
+}
+
+/**
+ * @brief Store a string in the ring
+ */
+static void TEST_PutString(LRING_HandleTypeDef *ring, const char *s)
+{
+    while (*s != '\0') {
+        LRING_Put(ring, (uint8_t)*s++);
+    }
+}
+
+/**
+ * @brief Monotonic time
+ * @retval double: Seconds
+ */
+static double TEST_Now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    static LRING_HandleTypeDef ring;
+    char line[TEST_LINE_SIZE];
+    char expect[TEST_LINE_SIZE];
+
+    // CR LF: two line ends, the second gives an empty line
+    LRING_Init(&ring);
+    CHECK(!LRING_HasLine(&ring) && LRING_GetLine(&ring, line, sizeof(line)) == -1);
+    TEST_PutString(&ring, "led on\r\n");
+    CHECK(LRING_HasLine(&ring));
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == 6 && strcmp(line, "led on") == 0);
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == 0 && line[0] == '\0');
+    CHECK(!LRING_HasLine(&ring) && LRING_GetLine(&ring, line, sizeof(line)) == -1);
+
+    // Over-long line: full length returned, the start kept
+    memset(expect, 'x', sizeof(expect));
+    for (uint32_t i = 0; i < 100U; i++) {
+        LRING_Put(&ring, 'x');
+    }
+    LRING_Put(&ring, '\n');
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == 100);
+    CHECK(memcmp(line, expect, sizeof(line) - 1U) == 0 && line[sizeof(line) - 1U] == '\0');
+    TEST_PutString(&ring, "abc\n");
+    CHECK(LRING_GetLine(&ring, line, 1) == 3 && line[0] == '\0');
+
+    // Full ring without a line end: bytes dropped, then flushed
+    for (uint32_t i = 0; i < LRING_SIZE + 5U; i++) {
+        LRING_Put(&ring, 'y');
+    }
+    CHECK(ring.dropped == 5U && !LRING_HasLine(&ring));
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == -1 && ring.flushed == LRING_SIZE);
+    TEST_PutString(&ring, "ok\r");
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == 2 && strcmp(line, "ok") == 0);
+
+    // Full ring ending in a line end: the line comes out, nothing flushed
+    for (uint32_t i = 0; i < LRING_SIZE - 1U; i++) {
+        LRING_Put(&ring, 'z');
+    }
+    LRING_Put(&ring, '\n');
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == (int32_t)LRING_SIZE - 1);
+    CHECK(ring.flushed == LRING_SIZE && ring.dropped == 5U);
+
+    // Dropped line end: that line joins the next one
+    TEST_PutString(&ring, "abc\n");
+    for (uint32_t i = 0; i < LRING_SIZE - 4U; i++) {
+        LRING_Put(&ring, 'q');
+    }
+    LRING_Put(&ring, '\n');                     // Ring full: dropped
+    CHECK(ring.dropped == 6U);
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == 3 && strcmp(line, "abc") == 0);
+    TEST_PutString(&ring, "r\n");
+    CHECK(LRING_GetLine(&ring, line, sizeof(line)) == (int32_t)LRING_SIZE - 3);
+    CHECK(!LRING_HasLine(&ring));
+
+    // Producer/consumer replay against the reference queue
+    uint32_t len = TEST_MakeStream();
+    uint32_t pos = 0, lines = 0, long_lines = 0;
+
+    LRING_Init(&ring);
+    while (pos < len) {
+        uint32_t burst = HOST_Random() % TEST_MAX_BURST;
+
+        // Received while the main loop was busy
+        for (uint32_t i = 0; i < burst && pos < len; i++, pos++) {
+            LRING_Put(&ring, stream[pos]);
+            TEST_ModelPut(stream[pos]);
+        }
+
+        // One main loop pass: drain the complete lines
+        int32_t got, want;
+        do {
+            got = LRING_GetLine(&ring, line, sizeof(line));
+            want = TEST_ModelGetLine(expect, sizeof(expect));
+            CHECK(got == want);
+            if (want >= 0) {
+                CHECK(strcmp(line, expect) == 0);
+                lines++;
+                long_lines += (want >= (int32_t)sizeof(line));
+            }
+        } while (want >= 0);
+        CHECK(!LRING_HasLine(&ring));
+        CHECK(ring.dropped == model_dropped && ring.flushed == model_flushed);
+        CHECK(ring.head - ring.tail == model_count);
+    }
+    CHECK(lines > 0U && long_lines > 0U && model_dropped > 0U && model_flushed > 0U);
+    printf("replay: %lu bytes, %lu lines (%lu too long), %lu dropped, %lu flushed\n",
+           (unsigned long)len, (unsigned long)lines, (unsigned long)long_lines,
+           (unsigned long)model_dropped, (unsigned long)model_flushed);
+
+    // LRING_Put cost: storing bytes of short lines, and dropping into a full ring
+    double put_s = 0.0;
+
+    LRING_Init(&ring);
+    for (uint32_t done = 0; done < TEST_PUT_BYTES; done += TEST_BATCH) {
+        const uint8_t *src = stream + (done % (len - TEST_BATCH));
+        double t0 = TEST_Now();
+
+        for (uint32_t i = 0; i < TEST_BATCH; i++) {
+            LRING_Put(&ring, src[i]);
+        }
+        put_s += TEST_Now() - t0;
+        while (LRING_GetLine(&ring, line, sizeof(line)) >= 0) {
+        }
+    }
+
+    LRING_Init(&ring);
+    for (uint32_t i = 0; i < LRING_SIZE; i++) {
+        LRING_Put(&ring, 'x');
+    }
+    double t0 = TEST_Now();
+    for (uint32_t i = 0; i < TEST_PUT_BYTES; i++) {
+        LRING_Put(&ring, (uint8_t)i);
+    }
+    double drop_s = TEST_Now() - t0;
+    CHECK(ring.dropped == TEST_PUT_BYTES);
+
+    printf("LRING_Put on this host: %.2f ns/byte stored, %.2f ns/byte dropped\n",
+           put_s / TEST_PUT_BYTES * 1e9, drop_s / TEST_PUT_BYTES * 1e9);
+
+    return HOST_TestResult("line_ring");
+}
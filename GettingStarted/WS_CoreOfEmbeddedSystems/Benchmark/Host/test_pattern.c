@@ -0,0 +1,111 @@
+/**
+ * @brief Host test of the pattern compiler (BlinkLed_Toggle project, pattern.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../BlinkLed_Toggle/Core/Inc \
+ *              ../BlinkLed_Toggle/Core/Src/pattern.c Host/test_pattern.c \
+ *              -o test_pattern && ./test_pattern
+ *        Plays the compiled BSRR words into a simulated ODR and checks
+ *        every sample of every listed pin, that other pins never change,
+ *        and the argument checks
+ */
+#include "host_test.h"
+#include "pattern.h"
+
+// Configuration definitions
+#define TEST_ROUNDS         2000
+#define TEST_MAX_LENGTH     8192
+
+
+/**
+ * @brief Apply a BSRR write to an output register, set winning over reset
+ * @param odr: Output register before the write
+ * @param word: BSRR word
+ * @retval uint32_t: Output register after the write
+ */
+static uint32_t TEST_Bsrr(uint32_t odr, uint32_t word)
+{
+    return ((odr & ~(word >> 16U)) | word) & 0xFFFFU;
+}
+
+int main(void)
+{
+    static uint8_t bits[PAT_MAX_PINS][TEST_MAX_LENGTH / 8U];
+    static uint32_t words[TEST_MAX_LENGTH];
+    static uint16_t values[TEST_MAX_LENGTH];
+    PAT_StreamTypeDef streams[PAT_MAX_PINS];
+
+    for (uint32_t round = 0; round < TEST_ROUNDS; round++) {
+        uint32_t length = 1U + HOST_Random() % TEST_MAX_LENGTH;
+        uint32_t count = 1U + HOST_Random() % PAT_MAX_PINS;
+        uint8_t pins[PAT_MAX_PINS];
+        uint32_t mask = 0;
+
+        // Distinct pins in random order
+        for (uint32_t i = 0; i < PAT_MAX_PINS; i++) {
+            pins[i] = (uint8_t)i;
+        }
+        for (uint32_t i = PAT_MAX_PINS - 1U; i > 0U; i--) {
+            uint32_t j = HOST_Random() % (i + 1U);
+            uint8_t t = pins[i];
+            pins[i] = pins[j];
+            pins[j] = t;
+        }
+        for (uint32_t s = 0; s < count; s++) {
+            for (uint32_t b = 0; b < (length + 7U) / 8U; b++) {
+                bits[s][b] = (uint8_t)HOST_Random();
+            }
+            streams[s].pin = pins[s];
+            streams[s].bits = bits[s];
+            mask |= 1UL << pins[s];
+        }
+
+        CHECK(PAT_Compile(streams, count, words, length) == PAT_OK);
+
+        // Every sample complete on its own, other pins untouched
+        uint32_t start = HOST_Random() & 0xFFFFU;
+        uint32_t odr = start;
+        for (uint32_t i = 0; i < length; i++) {
+            odr = TEST_Bsrr(odr, words[i]);
+            CHECK((words[i] & (words[i] >> 16U)) == 0U);
+            CHECK(((words[i] | (words[i] >> 16U)) & 0xFFFFU) == mask);
+            for (uint32_t s = 0; s < count; s++) {
+                CHECK(((odr >> streams[s].pin) & 1U) == ((bits[s][i >> 3] >> (i & 7U)) & 1U));
+            }
+            CHECK((odr & ~mask) == (start & ~mask));
+        }
+
+        // Port values, same checks
+        uint16_t vmask = (uint16_t)(HOST_Random() | 1U);
+        for (uint32_t i = 0; i < length; i++) {
+            values[i] = (uint16_t)HOST_Random();
+        }
+        CHECK(PAT_CompileValues(values, vmask, words, length) == PAT_OK);
+        odr = start;
+        for (uint32_t i = 0; i < length; i++) {
+            odr = TEST_Bsrr(odr, words[i]);
+            CHECK((odr & vmask) == (values[i] & vmask));
+            CHECK((odr & ~(uint32_t)vmask) == (start & ~(uint32_t)vmask));
+        }
+    }
+
+    // PAT_WORD: set and reset halves
+    CHECK(PAT_WORD(0x000F, 0x0005) == 0x000A0005UL);
+    CHECK(PAT_WORD(0x8000, 0xFFFF) == 0x00008000UL);
+
+    // Invalid arguments: duplicate pin, pin out of range, no streams
+    streams[0].pin = 3;
+    streams[1].pin = 3;
+    streams[0].bits = streams[1].bits = bits[0];
+    CHECK(PAT_Compile(streams, 2, words, 8) == PAT_ERROR);
+    streams[0].pin = PAT_MAX_PINS;
+    CHECK(PAT_Compile(streams, 1, words, 8) == PAT_ERROR);
+    streams[0].pin = 0;
+    streams[0].bits = NULL;
+    CHECK(PAT_Compile(streams, 1, words, 8) == PAT_ERROR);
+    CHECK(PAT_Compile(streams, 0, words, 8) == PAT_ERROR);
+    CHECK(PAT_Compile(streams, PAT_MAX_PINS + 1U, words, 8) == PAT_ERROR);
+    CHECK(PAT_CompileValues(values, 0, words, 8) == PAT_ERROR);
+    CHECK(PAT_CompileValues(NULL, 1, words, 8) == PAT_ERROR);
+
+    return HOST_TestResult("pattern");
+}
@@ -0,0 +1,113 @@
+/**
+ * @brief Host test of the PWM timer settings (PWM project, pwm_calc.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../PWM/Core/Inc ../PWM/Core/Src/pwm_calc.c \
+ *              Host/test_pwm_calc.c -lm -o test_pwm_calc && ./test_pwm_calc
+ *        Sweeps 1 Hz .. fTIM/2 on 16-bit and 32-bit auto-reload timers at
+ *        the F401 timer clocks and checks range, accuracy and reporting
+ */
+#include "host_test.h"
+#include "pwm_calc.h"
+#include <math.h>
+
+/**
+ * @brief Check one frequency
+ * @note  Rounding the period to the nearest count bounds the relative error
+ *        by half a count of the chosen period
+ * @param clk: Timer clock in Hz
+ * @param freq: Requested frequency in Hz
+ * @param arr_max: Largest ARR
+ * @param worst: Largest relative error so far, updated
+ * @retval PWMCALC_StatusTypeDef: Status of PWMCALC_Compute
+ */
+static PWMCALC_StatusTypeDef TEST_Frequency(uint32_t clk, uint32_t freq, uint32_t arr_max, double *worst)
+{
+    PWMCALC_TimingTypeDef t;
+    PWMCALC_StatusTypeDef status = PWMCALC_Compute(clk, freq, arr_max, &t);
+
+    if (status != PWMCALC_OK) {
+        return status;
+    }
+
+    CHECK(t.prescaler <= PWMCALC_PSC_MAX);
+    CHECK(t.period >= 1U && t.period <= arr_max);
+
+    double ticks = ((double)t.prescaler + 1.0) * ((double)t.period + 1.0);
+    double actual = (double)clk / ticks;
+    double error = fabs(actual - freq) / freq;
+
+    CHECK(error <= 0.5 / ((double)t.period + 1.0) * 1.0001);
+    CHECK(fabs(error * 1e6 - fabs((double)t.error_ppm)) <= 1.01);
+    CHECK(fabs((double)t.actual_hz - actual) <= 0.5 + 1e-9);
+
+    // Finest resolution: one prescaler step less would overflow ARR
+    if (t.prescaler > 0U) {
+        CHECK((double)clk / ((double)t.prescaler * freq) > (double)arr_max + 1.0 - 0.5);
+    }
+
+    if (error > *worst) {
+        *worst = error;
+    }
+
+    return PWMCALC_OK;
+}
+
+int main(void)
+{
+    static const uint32_t clocks[] = { 16000000UL, 42000000UL, 84000000UL };
+    static const uint32_t arr_max[] = { PWMCALC_ARR_MAX_16B, PWMCALC_ARR_MAX_32B };
+
+    for (uint32_t c = 0; c < sizeof(clocks) / sizeof(clocks[0]); c++) {
+        for (uint32_t a = 0; a < 2U; a++) {
+            double worst = 0.0, coarse = 0.0;
+            uint32_t too_low = 0, too_high = 0;
+
+            for (uint64_t f = 1; f <= clocks[c] / 2U; f = (f < 2000U) ? f + 1U : f + f / 997U + 1U) {
+                PWMCALC_StatusTypeDef status = TEST_Frequency(clocks[c], (uint32_t)f, arr_max[a],
+                                                              (f <= clocks[c] / 1000U) ? &worst : &coarse);
+
+                too_low += (status == PWMCALC_TOO_LOW);
+                too_high += (status == PWMCALC_TOO_HIGH);
+                CHECK(status != PWMCALC_ERROR);
+            }
+
+            // PSC x ARR spans clk / 2^32 .. clk / 2: every step is reachable
+            CHECK(too_low == 0U && too_high == 0U);
+            // At least 1000 counts per period: within 500 ppm
+            CHECK(worst <= 500e-6);
+            printf("clk %lu arr 0x%lx: worst error up to clk/1000 %.3g ppm\n", (unsigned long)clocks[c],
+                   (unsigned long)arr_max[a], worst * 1e6);
+        }
+
+        double worst = 0.0;
+        CHECK(TEST_Frequency(clocks[c], clocks[c] / 2U, PWMCALC_ARR_MAX_16B, &worst) == PWMCALC_OK);
+        CHECK(TEST_Frequency(clocks[c], clocks[c] / 2U + clocks[c] / 4U, PWMCALC_ARR_MAX_16B, &worst) == PWMCALC_TOO_HIGH);
+    }
+
+    // Limits and invalid arguments
+    PWMCALC_TimingTypeDef t;
+    CHECK(PWMCALC_Compute(84000000UL, 1, PWMCALC_ARR_MAX_16B, &t) == PWMCALC_OK);
+    CHECK(PWMCALC_Compute(84000000UL, 0, PWMCALC_ARR_MAX_16B, &t) == PWMCALC_ERROR);
+    CHECK(PWMCALC_Compute(0, 1000, PWMCALC_ARR_MAX_16B, &t) == PWMCALC_ERROR);
+    CHECK(PWMCALC_Compute(84000000UL, 1000, PWMCALC_ARR_MAX_16B, NULL) == PWMCALC_ERROR);
+    CHECK(PWMCALC_Compute(168000000UL, 1, PWMCALC_ARR_MAX_16B, &t) == PWMCALC_OK);
+    CHECK(PWMCALC_Compute(84000000UL, 84000000UL, PWMCALC_ARR_MAX_16B, &t) == PWMCALC_TOO_HIGH);
+
+    // 1 Hz at 84 MHz: PSC 1281 and 65523 counts (84e6 / 1282 = 65522.6), -6 ppm
+    CHECK(PWMCALC_Compute(84000000UL, 1, PWMCALC_ARR_MAX_16B, &t) == PWMCALC_OK &&
+          t.prescaler == 1281U && t.period == 65522U && t.actual_hz == 1U && t.error_ppm == -6);
+
+    // Duty conversion
+    CHECK(PWMCALC_PulseFromPermille(19999, 0) == 0U);
+    CHECK(PWMCALC_PulseFromPermille(19999, 500) == 10000U);
+    CHECK(PWMCALC_PulseFromPermille(19999, 1000) == 20000U);
+    CHECK(PWMCALC_PulseFromPermille(19999, 1500) == 20000U);
+    CHECK(PWMCALC_PulseFromQ16(0xFFFFFFFFUL, PWMCALC_DUTY_Q16_ONE) == 0xFFFFFFFFUL);
+    CHECK(PWMCALC_PulseFromQ16(99, PWMCALC_DUTY_Q16_ONE * 2U) == 100U);
+    CHECK(PWMCALC_PermilleToQ16(1000) == PWMCALC_DUTY_Q16_ONE);
+    for (uint16_t p = 0; p <= 1000U; p++) {
+        CHECK(PWMCALC_PulseFromPermille(999, p) == p);
+    }
+
+    return HOST_TestResult("pwm_calc");
+}
@@ -0,0 +1,276 @@
+/**
+ * @brief Host harness of the polled shell (Serial_polling project, shell.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../Serial_polling/Core/Inc \
+ *              ../Serial_polling/Core/Src/shell.c ../Serial_polling/Core/Src/cmd.c \
+ *              Host/test_shell.c -o test_shell && ./test_shell
+ *        Checks the line editor, then runs the example's main loop against
+ *        a simulated 115200 baud UART, with a periodic 5 ms stall of the
+ *        loop so input piles up. Every SHELL_Poll advances the virtual
+ *        clock by a modelled target cost (per call, input byte, command
+ *        and output byte; assumed figures, not measured). A pasted script
+ *        must never make one SHELL_Poll take more than SHELL_POLL_BYTES
+ *        bytes, one command or TEST_POLL_BUDGET_US, the blink must toggle
+ *        no later than with an idle line plus one such poll, and the shell
+ *        must keep up with the line rate. The "stats" command of the
+ *        example reports the measured longest SHELL_Poll on the board
+ */
+#include "host_test.h"
+#include "shell.h"
+#include <string.h>
+
+// Configuration definitions
+#define TEST_BAUD_BYTES_PER_S   11520       // 115200 baud, 8N1
+#define TEST_LOOP_US            20          // Virtual duration of one main loop pass
+#define TEST_STALL_US           5000        // Every TEST_STALL_EVERY passes the loop stalls
+#define TEST_STALL_EVERY        1000        // (e.g. a flash write), letting input pile up
+#define TEST_RUN_MS             10000
+#define TEST_POLL_NS            500         // Modelled target cost of SHELL_Poll: per call,
+#define TEST_BYTE_NS            1000        // per input byte (echo and editing),
+#define TEST_COMMAND_NS         40000       // per command (tokenize, dispatch, reply)
+#define TEST_OUT_BYTE_NS        100         // and per output byte queued for DMA
+#define TEST_POLL_BUDGET_US     100         // Longest SHELL_Poll allowed
+#define TEST_OUT_SIZE           (1UL << 20)
+
+// Simulated transport
+static const char *rx_data;
+static size_t rx_len;
+static size_t rx_arrived;                   // Bytes the UART has received so far
+static size_t rx_pos;                       // Bytes the shell has read
+static char tx[TEST_OUT_SIZE];
+static size_t tx_len;
+
+// Command log
+static char log_lines[8][64];
+static uint32_t log_count;
+static uint32_t blink_ms;
+
+/**
+ * @brief Shell input: bytes received so far
+ */
+static size_t TEST_Read(void *io, uint8_t *data, size_t max)
+{
+    size_t n = 0;
+
+    (void)io;
+    while (n < max && rx_pos < rx_arrived) {
+        data[n++] = (uint8_t)rx_data[rx_pos++];
+    }
+
+    return n;
+}
+
+/**
+ * @brief Shell output: kept for inspection, dropped when full
+ */
+static void TEST_Write(void *io, const char *data, size_t len)
+{
+    (void)io;
+    if (tx_len + len < TEST_OUT_SIZE) {
+        memcpy(tx + tx_len, data, len);
+        tx_len += len;
+        tx[tx_len] = '\0';
+    }
+}
+
+/**
+ * @brief Log a command and its arguments as "[argv0][argv1]..."
+ */
+static CMD_StatusTypeDef TEST_Log(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    char *line = log_lines[log_count++ % 8U];
+
+    (void)out;
+    line[0] = '\0';
+    for (int i = 0; i < argc; i++) {
+        strcat(line, "[");
+        strncat(line, argv[i], 20);
+        strcat(line, "]");
+    }
+
+    return CMD_OK;
+}
+
+/**
+ * @brief "blink <ms>" as in the example
+ */
+static CMD_StatusTypeDef TEST_Blink(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+    (void)out;
+    (void)argc;
+    log_count++;
+
+    return CMD_ParseUint(argv[1], &blink_ms);
+}
+
+static const CMD_CommandTypeDef commands[] = {
+    { "led",   "<x>",  "Log",   TEST_Log,   0, 3 },
+    { "blink", "<ms>", "Blink", TEST_Blink, 1, 1 },
+};
+static const CMD_TableTypeDef table = CMD_TABLE(commands);
+
+/**
+ * @brief Deliver a whole input at once and poll until it is consumed
+ * @param sh: Shell
+ * @param text: Input
+ */
+static void TEST_Type(SHELL_HandleTypeDef *sh, const char *text)
+{
+    rx_data = text;
+    rx_len = rx_arrived = strlen(text);
+    rx_pos = 0;
+    while (SHELL_Poll(sh) != 0U) {
+    }
+}
+
+/**
+ * @brief Check the last logged command
+ * @param expect: "[argv0][argv1]..."
+ */
+static void TEST_Last(const char *expect)
+{
+    const char *got = log_lines[(log_count - 1U) % 8U];
+
+    if (!CHECK(log_count > 0U && strcmp(got, expect) == 0)) {
+        printf("  got \"%s\", expected \"%s\"\n", got, expect);
+    }
+}
+
+// Result of one main-loop run
+typedef struct {
+    uint32_t toggle_count;                  // Blink toggles
+    uint32_t max_bytes;                     // Most bytes taken by one SHELL_Poll
+    uint32_t max_commands;                  // Most commands run by one SHELL_Poll
+    uint32_t max_backlog;                   // Most bytes waiting in the UART
+    uint32_t worst_ns;                      // Longest modelled SHELL_Poll
+    uint32_t max_late_ms;                   // Most a toggle came after its due tick
+} TEST_LoopTypeDef;
+
+/**
+ * @brief Run the example's main loop in virtual time
+ * @param sh: Shell
+ * @param input: Bytes arriving at the line rate from t = 0 (may be empty)
+ * @param r: Results
+ */
+static void TEST_MainLoop(SHELL_HandleTypeDef *sh, const char *input, TEST_LoopTypeDef *r)
+{
+    uint32_t blink_last = 0;
+    uint8_t led = 0;
+
+    memset(r, 0, sizeof(*r));
+    rx_data = input;
+    rx_len = strlen(input);
+    rx_arrived = rx_pos = 0;
+    blink_ms = 100;
+
+    for (uint64_t ns = 0, pass = 0; ns < TEST_RUN_MS * 1000000ULL; pass++) {
+        uint32_t commands_before = log_count;
+
+        rx_arrived = (size_t)(ns * TEST_BAUD_BYTES_PER_S / 1000000000U);
+        rx_arrived = (rx_arrived < rx_len) ? rx_arrived : rx_len;
+        r->max_backlog = (rx_arrived - rx_pos > r->max_backlog) ? (uint32_t)(rx_arrived - rx_pos) : r->max_backlog;
+
+        tx_len = 0;
+        uint32_t n = SHELL_Poll(sh);
+        uint32_t commands = log_count - commands_before;
+        uint32_t cost = TEST_POLL_NS + n * TEST_BYTE_NS + commands * TEST_COMMAND_NS +
+                        (uint32_t)tx_len * TEST_OUT_BYTE_NS;
+
+        r->worst_ns = (cost > r->worst_ns) ? cost : r->worst_ns;
+        r->max_bytes = (n > r->max_bytes) ? n : r->max_bytes;
+        r->max_commands = (commands > r->max_commands) ? commands : r->max_commands;
+        ns += cost;
+        uint32_t tick = (uint32_t)(ns / 1000000U);
+
+        // The example's blink: toggles off the tick, whatever the shell does
+        if (blink_ms != 0U && tick - blink_last >= blink_ms) {
+            uint32_t late = tick - blink_last - blink_ms;
+
+            r->max_late_ms = (late > r->max_late_ms) ? late : r->max_late_ms;
+            blink_last += blink_ms;
+            led = !led;
+            r->toggle_count++;
+        }
+
+        ns += (TEST_LOOP_US + ((pass % TEST_STALL_EVERY == TEST_STALL_EVERY - 1U) ? TEST_STALL_US : 0U)) * 1000ULL;
+    }
+    (void)led;
+}
+
+int main(void)
+{
+    SHELL_HandleTypeDef sh;
+
+    CHECK(SHELL_Init(&sh, &table, TEST_Read, TEST_Write, NULL) == SHELL_OK);
+    CHECK(strcmp(tx, SHELL_PROMPT) == 0);
+
+    // Line editing
+    TEST_Type(&sh, "LED on\r\n");
+    TEST_Last("[LED][on]");
+    TEST_Type(&sh, "led  \"a b\"  c\n");
+    TEST_Last("[led][a b][c]");
+    TEST_Type(&sh, "led ofx\bf\r");
+    TEST_Last("[led][off]");
+    TEST_Type(&sh, "\x1B[A\r");                         // Up: previous line again
+    TEST_Last("[led][off]");
+    TEST_Type(&sh, "\x1B[A\x1B[A\x1B[B\r");             // Up, up, down
+    TEST_Last("[led][off]");
+    TEST_Type(&sh, "\x1B[A\x1B[A\r");                   // Two back, duplicates stored once
+    TEST_Last("[led][a b][c]");
+    TEST_Type(&sh, "led junk\x03led ok\r");              // Ctrl-C drops the line
+    TEST_Last("[led][ok]");
+    TEST_Type(&sh, "led gone\x15led kept\r");            // Ctrl-U clears it
+    TEST_Last("[led][kept]");
+    uint32_t before = log_count;
+    tx_len = 0;
+    TEST_Type(&sh, "zzz\r\r\n");
+    CHECK(log_count == before && strstr(tx, "unknown command: zzz") != NULL);
+    TEST_Type(&sh, "led 1 2 3 4\r");
+    CHECK(log_count == before && strstr(tx, "usage: led <x>") != NULL);
+
+    // Typing past the end of the line is dropped, the line still runs
+    char longline[200] = "led ";
+    memset(longline + 4, 'x', 150);
+    strcat(longline, "\r");
+    TEST_Type(&sh, longline);
+    CHECK(log_count == before + 1U && strlen(log_lines[(log_count - 1U) % 8U]) == 20U + 7U);
+    CHECK(sh.len == 0U);
+
+    // Main loop: idle line, then a 10 s script pasted at full line rate
+    static char paste[TEST_RUN_MS * TEST_BAUD_BYTES_PER_S / 1000U + 1U];
+    static const char *const script[] = { "led on\r", "led off\r", "blink 100\r", "help\r", "led 1 2 3\r" };
+    size_t len = 0;
+    for (uint32_t i = 0; len + 16U < sizeof(paste); i++) {
+        const char *s = script[i % 5U];
+        memcpy(paste + len, s, strlen(s));
+        len += strlen(s);
+    }
+    paste[len] = '\0';
+
+    TEST_LoopTypeDef idle, busy;
+    TEST_MainLoop(&sh, "", &idle);
+    TEST_MainLoop(&sh, paste, &busy);
+
+    CHECK(idle.max_bytes == 0U && idle.toggle_count >= TEST_RUN_MS / 100U - 1U);
+    CHECK(busy.max_bytes <= SHELL_POLL_BYTES && busy.max_commands <= 1U);
+    CHECK(busy.worst_ns <= TEST_POLL_BUDGET_US * 1000U);
+    // The blink only slips by the stall and the poll in progress
+    CHECK(busy.toggle_count == idle.toggle_count);
+    CHECK(idle.max_late_ms <= (TEST_STALL_US + TEST_LOOP_US) / 1000U + 1U);
+    CHECK(busy.max_late_ms <= idle.max_late_ms + TEST_POLL_BUDGET_US / 1000U + 1U);
+    // A stall lets about 58 bytes pile up; they drain a line at a time and
+    // the backlog never grows past one stall, so the shell keeps up
+    uint32_t stall_bytes = (TEST_STALL_US + TEST_LOOP_US) * TEST_BAUD_BYTES_PER_S / 1000000U + 1U;
+    CHECK(busy.max_bytes > 1U);
+    CHECK(busy.max_backlog <= stall_bytes && rx_len - rx_pos <= stall_bytes);
+    printf("paste of %lu bytes: max %lu bytes and %lu command per poll, backlog %lu bytes\n",
+           (unsigned long)len, (unsigned long)busy.max_bytes, (unsigned long)busy.max_commands,
+           (unsigned long)busy.max_backlog);
+    printf("modelled longest SHELL_Poll %lu ns, blink late by up to %lu ms (idle %lu ms)\n",
+           (unsigned long)busy.worst_ns, (unsigned long)busy.max_late_ms, (unsigned long)idle.max_late_ms);
+
+    CHECK(SHELL_Init(NULL, &table, TEST_Read, TEST_Write, NULL) == SHELL_ERROR);
+    CHECK(SHELL_Init(&sh, &table, NULL, TEST_Write, NULL) == SHELL_ERROR);
+
+    return HOST_TestResult("shell");
+}
@@ -0,0 +1,175 @@
+/**
+ * @brief Host test of the timer wheel (BlinkLed_Toggle project, sw_timer.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../BlinkLed_Toggle/Core/Inc \
+ *              ../BlinkLed_Toggle/Core/Src/sw_timer.c Host/test_sw_timer.c \
+ *              -o test_sw_timer && ./test_sw_timer
+ *        Drives the wheel with a virtual tick counter: thousands of one-shot
+ *        and periodic timers, restarted and stopped from their callbacks,
+ *        must fire on their exact tick across the 32-bit tick wrap, and a
+ *        late SWTIM_Process must catch up without drift. Then times idle
+ *        ticks with 100 to 100000 armed timers to show the per-tick cost
+ *        does not grow
+ */
+#include "host_test.h"
+#include "sw_timer.h"
+#include <time.h>
+
+// Configuration definitions
+#define TEST_TIMERS         5000
+#define TEST_TICKS          3000000UL
+#define TEST_IDLE_TICKS     1000000UL
+#define TEST_IDLE_MAX       100000
+
+static SWTIM_WheelTypeDef wheel;
+static SWTIM_TimerTypeDef timers[TEST_TIMERS];
+static uint32_t due[TEST_TIMERS];       // Expected expiry tick
+static uint32_t period[TEST_TIMERS];
+static uint8_t armed[TEST_TIMERS];
+static uint32_t now;                    // Virtual HAL_GetTick()
+static uint32_t fired;
+
+/**
+ * @brief Expiry callback: check the tick, then stir the wheel
+ * @param arg: Timer index
+ */
+static void TEST_Callback(void *arg)
+{
+    uint32_t i = (uint32_t)(uintptr_t)arg;
+
+    CHECK(armed[i]);
+    CHECK(due[i] == now);
+    fired++;
+
+    if (period[i] != 0U) {
+        due[i] += period[i];
+    } else {
+        armed[i] = 0;
+    }
+
+    // Callbacks may stop themselves or (re)start any timer
+    if (HOST_Random() % 50U == 0U) {
+        SWTIM_Stop(&timers[i]);
+        armed[i] = 0;
+    }
+    if (HOST_Random() % 40U == 0U) {
+        uint32_t j = HOST_Random() % TEST_TIMERS;
+        uint32_t delay = 1U + HOST_Random() % 100000U;
+
+        SWTIM_Start(&wheel, &timers[j], delay, 0);
+        due[j] = now + delay;
+        period[j] = 0;
+        armed[j] = 1;
+    }
+}
+
+/**
+ * @brief Counting callback
+ * @param arg: Pointer to the counter
+ */
+static void TEST_Count(void *arg)
+{
+    (*(uint32_t *)arg)++;
+}
+
+/**
+ * @brief Idle callback of the timing run, never expected to fire
+ * @param arg: Unused
+ */
+static void TEST_Never(void *arg)
+{
+    (void)arg;
+    CHECK(0);
+}
+
+/**
+ * @brief Monotonic time
+ * @retval double: Nanoseconds
+ */
+static double TEST_Ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void)
+{
+    static const uint32_t spans[] = { 200, 50000, 300000, 50000000 };
+
+    // Exact expiry with every wheel level in use, starting just before the tick wrap
+    now = 0xFFFF0000UL;
+    SWTIM_InitWheel(&wheel, now);
+    for (uint32_t i = 0; i < TEST_TIMERS; i++) {
+        uint32_t delay = 1U + HOST_Random() % spans[i % 4U];
+
+        period[i] = (i % 2U) ? 1U + HOST_Random() % 70000U : 0U;
+        due[i] = now + delay;
+        armed[i] = 1;
+        SWTIM_Init(&timers[i], TEST_Callback, (void *)(uintptr_t)i);
+        CHECK(SWTIM_Start(&wheel, &timers[i], delay, period[i]) == SWTIM_OK);
+    }
+
+    for (uint32_t k = 0; k < TEST_TICKS; k++) {
+        now++;
+        SWTIM_Process(&wheel, now);
+    }
+
+    // Nothing due was missed, and every armed timer is still in the wheel
+    for (uint32_t i = 0; i < TEST_TIMERS; i++) {
+        CHECK(!armed[i] || (int32_t)(due[i] - now) > 0);
+        CHECK(SWTIM_IsActive(&timers[i]) == armed[i]);
+    }
+    printf("exact expiry: %lu callbacks over %lu ticks\n", (unsigned long)fired, (unsigned long)TEST_TICKS);
+
+    // Late processing: one call catches up on every missed tick and the
+    // periodic phase does not drift (the callback checks are off here)
+    static SWTIM_TimerTypeDef late;
+    uint32_t start = now, late_fired = 0;
+
+    SWTIM_InitWheel(&wheel, now);
+    SWTIM_Init(&late, TEST_Count, &late_fired);
+    SWTIM_Start(&wheel, &late, 3, 7);
+    for (uint32_t k = 0; k < 1000U; k++) {
+        now += 1U + HOST_Random() % 40U;
+        SWTIM_Process(&wheel, now);
+    }
+    CHECK(late_fired == (now - start - 3U) / 7U + 1U);
+    CHECK(late.expires == start + 3U + 7U * late_fired);
+
+    // Per-tick cost: idle ticks with n timers parked far ahead
+    static SWTIM_TimerTypeDef idle[TEST_IDLE_MAX];
+    double first = 0.0, worst = 0.0;
+
+    for (uint32_t n = 100; n <= TEST_IDLE_MAX; n *= 10U) {
+        now = 0;
+        SWTIM_InitWheel(&wheel, now);
+        for (uint32_t i = 0; i < n; i++) {
+            SWTIM_Init(&idle[i], TEST_Never, NULL);
+            SWTIM_Start(&wheel, &idle[i], 100000000UL + i, 0);
+        }
+
+        double t0 = TEST_Ns();
+        for (uint32_t k = 0; k < TEST_IDLE_TICKS; k++) {
+            now++;
+            SWTIM_Process(&wheel, now);
+        }
+        double per_tick = (TEST_Ns() - t0) / TEST_IDLE_TICKS;
+
+        printf("%6lu timers: %.1f ns/tick\n", (unsigned long)n, per_tick);
+        first = (n == 100U) ? per_tick : first;
+        worst = (per_tick > worst) ? per_tick : worst;
+    }
+    // 1000x the timers: same cost within host timing noise
+    CHECK(worst < 3.0 * first + 5.0);
+
+    // Invalid arguments
+    CHECK(SWTIM_InitWheel(NULL, 0) == SWTIM_ERROR);
+    CHECK(SWTIM_Init(&timers[0], NULL, NULL) == SWTIM_ERROR);
+    CHECK(SWTIM_Start(NULL, &timers[0], 1, 0) == SWTIM_ERROR);
+    CHECK(SWTIM_Stop(NULL) == SWTIM_ERROR);
+    CHECK(SWTIM_Process(NULL, 0) == 0U);
+
+    return HOST_TestResult("sw_timer");
+}
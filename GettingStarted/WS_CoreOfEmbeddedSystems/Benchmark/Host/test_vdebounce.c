@@ -0,0 +1,121 @@
+/**
+ * @brief Host check of the vertical-counter debouncer (UserButton_polling project, vdebounce.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -I../UserButton_polling/Core/Inc \
+ *              ../UserButton_polling/Core/Src/vdebounce.c \
+ *              Host/test_vdebounce.c -o test_vdebounce && ./test_vdebounce
+ *        Feeds synthetic inputs on all 32 lines (random toggles at different
+ *        rates, bounce bursts) and compares every sample against a plain
+ *        per-line counter, then checks the pulse-length threshold
+ */
+#include "host_test.h"
+#include "vdebounce.h"
+
+// Configuration definitions
+#define TEST_SAMPLES        5000000UL
+
+
+// Reference: one ordinary counter per line
+typedef struct {
+    uint32_t state;
+    uint8_t count[VDEB_LINES];
+} TEST_RefTypeDef;
+
+/**
+ * @brief Feed one sample to the reference
+ * @param ref: Reference debouncer
+ * @param sample: Raw levels
+ * @retval uint32_t: Lines that flipped
+ */
+static uint32_t TEST_RefUpdate(TEST_RefTypeDef *ref, uint32_t sample)
+{
+    uint32_t flipped = 0;
+
+    for (uint32_t line = 0; line < VDEB_LINES; line++) {
+        if (((sample ^ ref->state) >> line) & 1U) {
+            if (++ref->count[line] == VDEB_STABLE_SAMPLES) {
+                flipped |= 1UL << line;
+                ref->count[line] = 0;
+            }
+        } else {
+            ref->count[line] = 0;
+        }
+    }
+    ref->state ^= flipped;
+
+    return flipped;
+}
+
+/**
+ * @brief Count the flips caused by a pulse of a given length
+ * @param length: Samples at the active level
+ * @retval uint32_t: Flips of line 0 seen during and after the pulse
+ */
+static uint32_t TEST_Pulse(uint32_t length)
+{
+    VDEB_TypeDef db;
+    uint32_t flips = 0;
+
+    VDEB_Init(&db, 0);
+    for (uint32_t i = 0; i < length; i++) {
+        flips += VDEB_Update(&db, 1) & 1U;
+    }
+    for (uint32_t i = 0; i < 2U * VDEB_STABLE_SAMPLES; i++) {
+        flips += VDEB_Update(&db, 0) & 1U;
+    }
+
+    return flips;
+}
+
+int main(void)
+{
+    VDEB_TypeDef db;
+    TEST_RefTypeDef ref = {0};
+    uint32_t sample = 0, flips = 0;
+
+    // Lines toggle at 1..4 per 1000 samples; lines 8..15 bounce in bursts
+    VDEB_Init(&db, 0);
+    for (uint32_t t = 0; t < TEST_SAMPLES; t++) {
+        for (uint32_t line = 0; line < VDEB_LINES; line++) {
+            uint32_t rate = (line >= 8U && line < 16U && (t / 5000U) % 3U == 0U) ? 300U : line % 4U + 1U;
+
+            if (HOST_Random() % 1000U < rate) {
+                sample ^= 1UL << line;
+            }
+        }
+
+        uint32_t flipped = VDEB_Update(&db, sample);
+
+        CHECK(flipped == TEST_RefUpdate(&ref, sample));
+        CHECK(db.state == ref.state);
+        flips += (uint32_t)__builtin_popcount(flipped);
+    }
+    printf("%lu samples x %u lines: %lu flips\n", (unsigned long)TEST_SAMPLES, VDEB_LINES, (unsigned long)flips);
+
+    // One sample short of the threshold is ignored; the threshold flips once
+    // and the release takes as long
+    CHECK(TEST_Pulse(VDEB_STABLE_SAMPLES - 1U) == 0U);
+    CHECK(TEST_Pulse(VDEB_STABLE_SAMPLES) == 2U);
+    CHECK(TEST_Pulse(100) == 2U);
+
+    // A single agreeing sample restarts the count
+    VDEB_Init(&db, 0);
+    for (uint32_t i = 0; i < VDEB_STABLE_SAMPLES - 1U; i++) {
+        CHECK(VDEB_Update(&db, 1) == 0U);
+    }
+    CHECK(VDEB_Update(&db, 0) == 0U);
+    for (uint32_t i = 0; i < VDEB_STABLE_SAMPLES - 1U; i++) {
+        CHECK(VDEB_Update(&db, 1) == 0U);
+    }
+    CHECK(VDEB_Update(&db, 1) == 1U && db.state == 1U);
+
+    // Initial levels are taken as debounced; all lines at once
+    VDEB_Init(&db, 0xFFFFFFFFUL);
+    for (uint32_t i = 0; i < VDEB_STABLE_SAMPLES - 1U; i++) {
+        CHECK(VDEB_Update(&db, 0) == 0U);
+    }
+    CHECK(VDEB_Update(&db, 0) == 0xFFFFFFFFUL && db.state == 0U);
+    CHECK(db.c0 == 0U && db.c1 == 0U && db.c2 == 0U);
+
+    return HOST_TestResult("vdebounce");
+}
@@ -0,0 +1,121 @@
+/**
+ * @brief Host test of the waveform generator (PWM project, wavegen.c)
+ * @note  Build and run from the Benchmark project directory:
+ *          gcc -O2 -Wall -fsanitize=undefined -fno-sanitize-recover \
+ *              -I../PWM/Core/Inc ../PWM/Core/Src/wavegen.c \
+ *              ../PWM/Core/Src/wave_tables.c Host/test_wavegen.c -lm \
+ *              -o test_wavegen && ./test_wavegen
+ *        Checks the generated sine table, the sample-timing math, the
+ *        table interpolation (full-scale steps included) and the compare
+ *        values written for the DMA buffer
+ */
+#include "host_test.h"
+#include "wavegen.h"
+#include "wave_tables.h"
+#include <math.h>
+
+// Full-scale steps between neighbours, as in the PWM example's heartbeat table
+static const int16_t step_table[16] = {
+    -32767, -32767, 32767, -8000, 20000, -32767, 32767, -32767,
+    32767, 32767, -32767, 0, 32767, -32767, -32767, -32767,
+};
+
+/**
+ * @brief Check linear interpolation over a custom table
+ * @param gen: Generator with the table attached
+ * @param table: The same table
+ * @param bits: log2 of its length
+ */
+static void TEST_Interpolation(const WAVE_GeneratorTypeDef *gen, const int16_t *table, uint8_t bits)
+{
+    uint32_t size = 1UL << bits;
+
+    for (uint32_t idx = 0; idx < size; idx++) {
+        double a = table[idx];
+        double b = table[(idx + 1U) & (size - 1U)];
+
+        for (uint32_t frac = 0; frac < 65536U; frac += 97U) {
+            uint32_t phase = (idx << (32U - bits)) | (frac << (16U - bits));
+            int32_t y = WAVE_Sample(gen, phase);
+            double expect = a + (b - a) * frac / 65536.0;
+
+            CHECK(y >= -32767 && y <= 32767);
+            CHECK(fabs(y - expect) <= 1.0);
+        }
+    }
+}
+
+int main(void)
+{
+    WAVE_GeneratorTypeDef gen;
+
+    // Generated table: round(32767 sin(2 pi i / N)), as Tools/gen_wave_tables.py
+    for (uint32_t i = 0; i < WAVE_SINE_TABLE_SIZE; i++) {
+        CHECK(WAVE_SineTable[i] == (int16_t)lround(32767.0 * sin(2.0 * M_PI * i / WAVE_SINE_TABLE_SIZE)));
+    }
+
+    // Sample timing: 84 MHz / 840 = 100 kHz carrier, one sample per period
+    uint32_t rate = WAVE_SampleRate(84000000UL, 0, 839);
+    CHECK(rate == 100000U);
+    CHECK(WAVE_SampleRate(84000000UL, 8399, 19999) == 1U);
+    CHECK(WAVE_PhaseStep(rate, 0) == 0U);
+    CHECK(WAVE_PhaseStep(rate, rate) == 0U);
+    CHECK(WAVE_PhaseStep(0, 1) == 0U);
+    CHECK(WAVE_PhaseStep(rate, rate / 4U) == 0x40000000UL);
+    for (uint32_t f = 1; f < rate / 2U; f = f * 3U + 1U) {
+        uint32_t step = WAVE_PhaseStep(rate, f);
+        double actual = WAVE_ActualMilliHz(rate, step) / 1000.0;
+
+        // Step rounding: half a step of rate / 2^32, plus the mHz rounding
+        CHECK(fabs(actual - f) <= rate / 4294967296.0 + 0.0011);
+    }
+
+    // Sine: interpolated table against sin()
+    WAVE_Init(&gen, WAVE_SINE, rate, 50, WAVE_AMPLITUDE_ONE, 0);
+    double worst = 0.0;
+    for (uint32_t p = 0; p < 0xFFFF0000UL; p += 0x10001UL) {
+        double e = fabs(WAVE_Sample(&gen, p) / 32767.0 - sin(p / 4294967296.0 * 2.0 * M_PI));
+        worst = (e > worst) ? e : worst;
+    }
+    CHECK(worst < 1.5e-4);      // 256 entries: 7.5e-5 interpolation + table rounding
+    printf("sine: worst error %.2e of full scale\n", worst);
+
+    // Computed shapes stay in -32767..32767 and hit their corners
+    static const WAVE_ShapeTypeDef shapes[] = { WAVE_TRIANGLE, WAVE_SAWTOOTH, WAVE_SQUARE };
+    for (uint32_t s = 0; s < 3U; s++) {
+        int32_t lo = 0, hi = 0;
+
+        WAVE_Init(&gen, shapes[s], rate, 1, WAVE_AMPLITUDE_ONE, 0);
+        for (uint64_t p = 0; p <= 0xFFFFFFFFULL; p += 0x1000U) {
+            int32_t y = WAVE_Sample(&gen, (uint32_t)p);
+
+            lo = (y < lo) ? y : lo;
+            hi = (y > hi) ? y : hi;
+        }
+        CHECK(lo == -32767 && hi == 32767);
+    }
+
+    // Custom tables: full-scale steps must not overflow (UBSan) nor leave Q15
+    WAVE_Init(&gen, WAVE_CUSTOM, rate, 1, WAVE_AMPLITUDE_ONE, 0);
+    WAVE_SetCustomTable(&gen, step_table, 4);
+    TEST_Interpolation(&gen, step_table, 4);
+    WAVE_SetCustomTable(&gen, WAVE_SineTable, WAVE_SINE_TABLE_BITS);
+    TEST_Interpolation(&gen, WAVE_SineTable, WAVE_SINE_TABLE_BITS);
+
+    // Fill: compare values within 0..ARR+1, gain and phase applied, phase advanced
+    uint32_t buf[64];
+    WAVE_Init(&gen, WAVE_CUSTOM, rate, rate / 16U, WAVE_AMPLITUDE_ONE, 0);
+    WAVE_SetCustomTable(&gen, step_table, 4);
+    WAVE_Fill(&gen, buf, 64, 839);
+    for (uint32_t i = 0; i < 64U; i++) {
+        CHECK(buf[i] <= 840U);
+    }
+    CHECK(buf[0] == 0U && buf[2] == 840U);
+    CHECK(gen.phase == 64U * gen.phase_step);
+
+    WAVE_Init(&gen, WAVE_SQUARE, rate, rate / 8U, WAVE_AMPLITUDE_ONE / 2, WAVE_PHASE_DEG(180));
+    WAVE_Fill(&gen, buf, 8, 839);
+    CHECK(buf[0] == 210U && buf[4] == 630U);
+
+    return HOST_TestResult("wavegen");
+}
@@ -0,0 +1,53 @@
+#ifndef LED_FX_H
+#define LED_FX_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define LEDFX_PWM_TOP       4095                        // PWM full scale (12 bits)
+#define LEDFX_STEP_HZ       100                         // Brightness steps per second
+#define LEDFX_MAX_STEPS     512                         // Longest rendered sequence (5.12 s)
+#define LEDFX_MS(ms)        ((uint16_t)(((ms) * LEDFX_STEP_HZ + 999UL) / 1000UL))
+
+// Perceived brightness (0..255) to PWM compare value, gamma ~2.2 as
+// 0.7 t^2 + 0.3 t^3 (t = level / 255): integer only, so it is a constant
+// expression and the table below is computed by the compiler
+#define LEDFX_GAMMA(level) \
+    ((uint16_t)(((uint64_t)LEDFX_PWM_TOP * (7ULL * 255U * (level) * (level) + \
+                 3ULL * (level) * (level) * (level)) + 5ULL * 255U * 255U * 255U) / \
+                (10ULL * 255U * 255U * 255U)))
+
+// Effect segment: brightness ramps linearly (in perceived brightness)
+// from 'from' to 'to' over 'steps' steps; from == to holds a level
+typedef struct {
+    uint8_t from;               // Level of the first step (0..255)
+    uint8_t to;                 // Level reached at the end of the segment
+    uint16_t steps;             // Duration in steps (LEDFX_MS converts)
+} LEDFX_SegmentTypeDef;
+
+// Effect: segments played in order
+typedef struct {
+    const LEDFX_SegmentTypeDef *segments;
+    uint8_t count;
+} LEDFX_EffectTypeDef;
+
+// Sequence part: an effect played 'repeat' times; sequences are arrays of parts
+typedef struct {
+    const LEDFX_EffectTypeDef *effect;
+    uint16_t repeat;
+} LEDFX_PartTypeDef;
+
+// Effects library
+extern const uint16_t LEDFX_Gamma[256];
+extern const LEDFX_EffectTypeDef LEDFX_Off;          // 100 ms dark
+extern const LEDFX_EffectTypeDef LEDFX_On;           // 100 ms full
+extern const LEDFX_EffectTypeDef LEDFX_Breathe;      // 3 s inhale, exhale and rest
+extern const LEDFX_EffectTypeDef LEDFX_Heartbeat;    // Double beat, 1 s
+extern const LEDFX_EffectTypeDef LEDFX_CodeBlink;    // One blink of a blink code, 400 ms
+extern const LEDFX_EffectTypeDef LEDFX_CodeGap;      // Pause closing a blink code, 1.5 s
+
+// Function prototypes
+uint32_t LEDFX_Length(const LEDFX_PartTypeDef *parts, uint32_t count);
+uint32_t LEDFX_Render(const LEDFX_PartTypeDef *parts, uint32_t count, uint32_t *out, uint32_t size);
+
+#endif /* LED_FX_H */
@@ -0,0 +1,33 @@
+#ifndef LED_PWM_H
+#define LED_PWM_H
+
+#include "stm32f4xx_hal.h"
+#include "led_fx.h"
+
+// Configuration definitions
+#define LEDPWM_TIM          TIM2                        // PWM carrier, CH1 on PA5 (GREEN_LED)
+#define LEDPWM_GPIO_AF      GPIO_AF1_TIM2
+#define LEDPWM_STEP_TIM     TIM5                        // Update event paces the brightness steps
+#define LEDPWM_DMA_STREAM   DMA1_Stream0                // TIM5_UP request
+#define LEDPWM_DMA_CHANNEL  DMA_CHANNEL_6
+
+// Status LED structure
+typedef struct {
+    DMA_HandleTypeDef hdma;                             // Steps to TIM2->CCR1, circular
+    uint32_t steps[2][LEDFX_MAX_STEPS];                 // Playing and spare sequence
+    uint8_t active;                                     // Index of the playing buffer
+    uint32_t length;                                    // Steps of the playing sequence
+} LEDPWM_HandleTypeDef;
+
+// Status LED states
+typedef enum {
+    LEDPWM_OK = 0,      // Operation successful
+    LEDPWM_ERROR = 1    // Operation failed
+} LEDPWM_StatusTypeDef;
+
+// Function prototypes
+LEDPWM_StatusTypeDef LEDPWM_Init(LEDPWM_HandleTypeDef *led, GPIO_TypeDef *port, uint16_t pin);
+LEDPWM_StatusTypeDef LEDPWM_Play(LEDPWM_HandleTypeDef *led, const LEDFX_PartTypeDef *parts, uint32_t count);
+LEDPWM_StatusTypeDef LEDPWM_Set(LEDPWM_HandleTypeDef *led, uint8_t level);
+
+#endif /* LED_PWM_H */
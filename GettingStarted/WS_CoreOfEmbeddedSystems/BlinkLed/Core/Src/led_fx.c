@@ -0,0 +1,128 @@
+#include "led_fx.h"
+#include <stddef.h>
+
+#define LEDFX_G4(i)     LEDFX_GAMMA(i), LEDFX_GAMMA((i) + 1U), LEDFX_GAMMA((i) + 2U), LEDFX_GAMMA((i) + 3U)
+#define LEDFX_G16(i)    LEDFX_G4(i), LEDFX_G4((i) + 4U), LEDFX_G4((i) + 8U), LEDFX_G4((i) + 12U)
+#define LEDFX_G64(i)    LEDFX_G16(i), LEDFX_G16((i) + 16U), LEDFX_G16((i) + 32U), LEDFX_G16((i) + 48U)
+
+// Gamma table, evaluated at compile time and kept in flash
+const uint16_t LEDFX_Gamma[256] = {
+    LEDFX_G64(0U), LEDFX_G64(64U), LEDFX_G64(128U), LEDFX_G64(192U)
+};
+
+static const LEDFX_SegmentTypeDef ledfx_off[] = {
+    { 0, 0, LEDFX_MS(100) },
+};
+static const LEDFX_SegmentTypeDef ledfx_on[] = {
+    { 255, 255, LEDFX_MS(100) },
+};
+static const LEDFX_SegmentTypeDef ledfx_breathe[] = {
+    { 0, 255, LEDFX_MS(1200) },
+    { 255, 255, LEDFX_MS(200) },
+    { 255, 0, LEDFX_MS(1200) },
+    { 0, 0, LEDFX_MS(400) },
+};
+static const LEDFX_SegmentTypeDef ledfx_heartbeat[] = {
+    { 255, 60, LEDFX_MS(150) },
+    { 60, 0, LEDFX_MS(100) },
+    { 200, 40, LEDFX_MS(150) },
+    { 40, 0, LEDFX_MS(100) },
+    { 0, 0, LEDFX_MS(500) },
+};
+static const LEDFX_SegmentTypeDef ledfx_code_blink[] = {
+    { 255, 255, LEDFX_MS(150) },
+    { 0, 0, LEDFX_MS(250) },
+};
+static const LEDFX_SegmentTypeDef ledfx_code_gap[] = {
+    { 0, 0, LEDFX_MS(1500) },
+};
+
+#define LEDFX_EFFECT(segs)  { (segs), (uint8_t)(sizeof(segs) / sizeof((segs)[0])) }
+
+const LEDFX_EffectTypeDef LEDFX_Off = LEDFX_EFFECT(ledfx_off);
+const LEDFX_EffectTypeDef LEDFX_On = LEDFX_EFFECT(ledfx_on);
+const LEDFX_EffectTypeDef LEDFX_Breathe = LEDFX_EFFECT(ledfx_breathe);
+const LEDFX_EffectTypeDef LEDFX_Heartbeat = LEDFX_EFFECT(ledfx_heartbeat);
+const LEDFX_EffectTypeDef LEDFX_CodeBlink = LEDFX_EFFECT(ledfx_code_blink);
+const LEDFX_EffectTypeDef LEDFX_CodeGap = LEDFX_EFFECT(ledfx_code_gap);
+
+/**
+ * @brief Get the duration of one pass of an effect
+ * @param effect: Effect
+ * @retval uint32_t: Steps
+ */
+static uint32_t LEDFX_EffectLength(const LEDFX_EffectTypeDef *effect)
+{
+    uint32_t steps = 0;
+
+    for (uint32_t i = 0; i < effect->count; i++) {
+        steps += effect->segments[i].steps;
+    }
+
+    return steps;
+}
+
+/**
+ * @brief Get the duration of a sequence
+ * @param parts: Sequence parts, played in order
+ * @param count: Number of parts
+ * @retval uint32_t: Steps, 0 if a part has no effect
+ */
+uint32_t LEDFX_Length(const LEDFX_PartTypeDef *parts, uint32_t count)
+{
+    uint32_t steps = 0;
+
+    if (parts == NULL) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (parts[i].effect == NULL) {
+            return 0;
+        }
+        steps += LEDFX_EffectLength(parts[i].effect) * parts[i].repeat;
+    }
+
+    return steps;
+}
+
+/**
+ * @brief Render a sequence into PWM compare values, one per step
+ * @note  Each ramp starts at its 'from' level and stops one step short of
+ *        'to', so segments chain without a repeated level and a sequence
+ *        played in a loop has no seam
+ * @param parts: Sequence parts, played in order
+ * @param count: Number of parts
+ * @param out: Output, gamma-corrected compare values (0..LEDFX_PWM_TOP);
+ *             words, so a DMA can copy them straight into a 32-bit CCR
+ * @param size: Capacity of 'out' in steps
+ * @retval uint32_t: Steps written, 0 if the sequence is empty or does not fit
+ */
+uint32_t LEDFX_Render(const LEDFX_PartTypeDef *parts, uint32_t count, uint32_t *out, uint32_t size)
+{
+    uint32_t length = LEDFX_Length(parts, count);
+    uint32_t n = 0;
+
+    if (out == NULL || length == 0U || length > size) {
+        return 0;
+    }
+
+    for (uint32_t p = 0; p < count; p++) {
+        const LEDFX_EffectTypeDef *effect = parts[p].effect;
+
+        for (uint32_t r = 0; r < parts[p].repeat; r++) {
+            for (uint32_t s = 0; s < effect->count; s++) {
+                const LEDFX_SegmentTypeDef *seg = &effect->segments[s];
+                int32_t delta = (int32_t)seg->to - (int32_t)seg->from;
+
+                for (uint32_t k = 0; k < seg->steps; k++) {
+                    int32_t level = seg->from + delta * (int32_t)k / (int32_t)seg->steps;
+
+                    out[n++] = LEDFX_Gamma[level];
+                }
+            }
+        }
+    }
+
+    return n;
+}
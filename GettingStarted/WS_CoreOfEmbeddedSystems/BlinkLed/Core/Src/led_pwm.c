@@ -0,0 +1,158 @@
+#include "led_pwm.h"
+
+/**
+ * @brief Get the clock of the APB1 timers
+ * @note  APB1 timers run at twice the bus clock when the APB prescaler is not 1
+ * @retval uint32_t: Timer input clock in Hz
+ */
+static uint32_t LEDPWM_TimerClock(void)
+{
+    uint32_t clk = HAL_RCC_GetPCLK1Freq();
+
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        clk *= 2U;
+    }
+
+    return clk;
+}
+
+/**
+ * @brief Stop stepping; the LED keeps its current brightness
+ * @param led: Pointer to LEDPWM_HandleTypeDef structure
+ */
+static void LEDPWM_Halt(LEDPWM_HandleTypeDef *led)
+{
+    LEDPWM_STEP_TIM->CR1 &= ~TIM_CR1_CEN;
+    if (HAL_DMA_GetState(&led->hdma) == HAL_DMA_STATE_BUSY) {
+        HAL_DMA_Abort(&led->hdma);
+    }
+    led->length = 0;
+}
+
+/**
+ * @brief Initialize the status LED: PWM output, step timer and DMA
+ * @note  The LED starts dark. Registers only for the timers: the TIM HAL
+ *        module is not part of this project
+ * @param led: Pointer to LEDPWM_HandleTypeDef structure
+ * @param port: Port of a TIM2_CH1 pin (PA5 drives GREEN_LED)
+ * @param pin: TIM2_CH1 pin
+ * @retval LEDPWM_StatusTypeDef: Operation status
+ */
+LEDPWM_StatusTypeDef LEDPWM_Init(LEDPWM_HandleTypeDef *led, GPIO_TypeDef *port, uint16_t pin)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    if (led == NULL || port == NULL) {
+        return LEDPWM_ERROR;
+    }
+
+    led->active = 0;
+    led->length = 0;
+
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    __HAL_RCC_TIM5_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    // PWM carrier: 84 MHz / 4095 = 20.5 kHz, well above visible flicker.
+    // A compare of LEDFX_PWM_TOP is past the reload, i.e. fully on. CCR1
+    // is preloaded, so a new step takes effect at the next period and
+    // never cuts a pulse short
+    LEDPWM_TIM->CR1 = TIM_CR1_ARPE;
+    LEDPWM_TIM->PSC = 0;
+    LEDPWM_TIM->ARR = LEDFX_PWM_TOP - 1U;
+    LEDPWM_TIM->CCR1 = 0;
+    LEDPWM_TIM->CCMR1 = TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;     // PWM mode 1
+    LEDPWM_TIM->CCER = TIM_CCER_CC1E;
+    LEDPWM_TIM->EGR = TIM_EGR_UG;
+    LEDPWM_TIM->CR1 |= TIM_CR1_CEN;
+
+    gpio.Pin = pin;
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    gpio.Alternate = LEDPWM_GPIO_AF;
+    HAL_GPIO_Init(port, &gpio);
+
+    // Step clock: each update requests one DMA write of the next step into CCR1
+    LEDPWM_STEP_TIM->CR1 = TIM_CR1_URS | TIM_CR1_ARPE;
+    LEDPWM_STEP_TIM->PSC = 0;
+    LEDPWM_STEP_TIM->ARR = LEDPWM_TimerClock() / LEDFX_STEP_HZ - 1U;   // 32-bit timer
+    LEDPWM_STEP_TIM->EGR = TIM_EGR_UG;
+    LEDPWM_STEP_TIM->SR = 0;
+    LEDPWM_STEP_TIM->DIER = TIM_DIER_UDE;
+
+    // Words in direct mode: TIM2 registers are 32 bits wide
+    led->hdma.Instance = LEDPWM_DMA_STREAM;
+    led->hdma.Init.Channel = LEDPWM_DMA_CHANNEL;
+    led->hdma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    led->hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+    led->hdma.Init.MemInc = DMA_MINC_ENABLE;
+    led->hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    led->hdma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    led->hdma.Init.Mode = DMA_CIRCULAR;
+    led->hdma.Init.Priority = DMA_PRIORITY_LOW;
+    led->hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&led->hdma) != HAL_OK) {
+        return LEDPWM_ERROR;
+    }
+
+    return LEDPWM_OK;
+}
+
+/**
+ * @brief Switch to a new sequence, played in a loop
+ * @note  The sequence is rendered into the spare buffer while the current
+ *        one keeps playing, then the DMA is pointed at it. After that the
+ *        CPU is not involved at all: no interrupt, no polling
+ * @param led: Pointer to LEDPWM_HandleTypeDef structure
+ * @param parts: Sequence parts (see led_fx.h)
+ * @param count: Number of parts
+ * @retval LEDPWM_StatusTypeDef: Operation status; the current sequence keeps
+ *         playing if the new one is empty or longer than LEDFX_MAX_STEPS
+ */
+LEDPWM_StatusTypeDef LEDPWM_Play(LEDPWM_HandleTypeDef *led, const LEDFX_PartTypeDef *parts, uint32_t count)
+{
+    uint8_t spare;
+    uint32_t length;
+
+    if (led == NULL) {
+        return LEDPWM_ERROR;
+    }
+
+    spare = led->active ^ 1U;
+    length = LEDFX_Render(parts, count, led->steps[spare], LEDFX_MAX_STEPS);
+    if (length == 0U) {
+        return LEDPWM_ERROR;
+    }
+
+    LEDPWM_Halt(led);
+    if (HAL_DMA_Start(&led->hdma, (uint32_t)led->steps[spare], (uint32_t)&LEDPWM_TIM->CCR1, length) != HAL_OK) {
+        return LEDPWM_ERROR;
+    }
+    led->active = spare;
+    led->length = length;
+
+    // Counter at the top: the first step is written one tick from now
+    LEDPWM_STEP_TIM->CNT = LEDPWM_STEP_TIM->ARR;
+    LEDPWM_STEP_TIM->CR1 |= TIM_CR1_CEN;
+
+    return LEDPWM_OK;
+}
+
+/**
+ * @brief Stop any sequence and hold a fixed brightness
+ * @param led: Pointer to LEDPWM_HandleTypeDef structure
+ * @param level: Perceived brightness (0..255)
+ * @retval LEDPWM_StatusTypeDef: Operation status
+ */
+LEDPWM_StatusTypeDef LEDPWM_Set(LEDPWM_HandleTypeDef *led, uint8_t level)
+{
+    if (led == NULL) {
+        return LEDPWM_ERROR;
+    }
+
+    LEDPWM_Halt(led);
+    LEDPWM_TIM->CCR1 = LEDFX_Gamma[level];
+
+    return LEDPWM_OK;
+}
@@ -21,6 +21,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "led_pwm.h"
 
 /* USER CODE END Includes */
 
@@ -31,6 +32,7 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define EFFECT_PERIOD_MS  15000   // Time on each demo sequence
 
 /* USER CODE END PD */
 
@@ -43,6 +45,27 @@
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+LEDPWM_HandleTypeDef status_led;
+
+// Demo sequences, built from the effects in led_fx.c
+static const LEDFX_PartTypeDef seq_breathe[] = {
+  { &LEDFX_Breathe, 1 },
+};
+static const LEDFX_PartTypeDef seq_heartbeat[] = {
+  { &LEDFX_Heartbeat, 1 },
+};
+static const LEDFX_PartTypeDef seq_code3[] = {
+  { &LEDFX_CodeBlink, 3 },
+  { &LEDFX_CodeGap, 1 },
+};
+static const struct {
+  const LEDFX_PartTypeDef *parts;
+  uint32_t count;
+} demo[] = {
+  { seq_breathe, sizeof(seq_breathe) / sizeof(seq_breathe[0]) },
+  { seq_heartbeat, sizeof(seq_heartbeat) / sizeof(seq_heartbeat[0]) },
+  { seq_code3, sizeof(seq_code3) / sizeof(seq_code3[0]) },
+};
 
 /* USER CODE END PV */
 
@@ -90,6 +113,14 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  uint32_t effect = 0;
+  uint32_t switched = HAL_GetTick();
+
+  if (LEDPWM_Init(&status_led, GREEN_LED_GPIO_Port, GREEN_LED_Pin) != LEDPWM_OK ||
+      LEDPWM_Play(&status_led, demo[0].parts, demo[0].count) != LEDPWM_OK)
+  {
+    Error_Handler();
+  }
 
   /* USER CODE END 2 */
 
@@ -97,10 +128,15 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-    HAL_GPIO_WritePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin, GPIO_PIN_RESET);
-    HAL_Delay(500);
-    HAL_GPIO_WritePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin, GPIO_PIN_SET);
-    HAL_Delay(500);
+    // The LED runs on TIM2/TIM5/DMA1 by itself; the core only wakes on
+    // SysTick to pick the next demo sequence
+    __WFI();
+    if (HAL_GetTick() - switched >= EFFECT_PERIOD_MS)
+    {
+      switched = HAL_GetTick();
+      effect = (effect + 1U) % (sizeof(demo) / sizeof(demo[0]));
+      LEDPWM_Play(&status_led, demo[effect].parts, demo[effect].count);
+    }
 	  /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -0,0 +1,32 @@
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define PAT_MAX_PINS        16                  // Pins of one GPIO port
+
+// BSRR word driving the pins in 'mask' to the matching bits of 'value'
+// (bits 0..15 set, bits 16..31 reset; pins outside 'mask' are untouched)
+#define PAT_WORD(mask, value) \
+    ((((uint32_t)(mask) & ~(uint32_t)(value)) << 16U) | ((uint32_t)(mask) & (uint32_t)(value)))
+
+// One pin's waveform: sample i is bit (i % 8) of bits[i / 8], LSB first
+typedef struct {
+    uint8_t pin;                // Pin number in the port (0..15)
+    const uint8_t *bits;        // Packed samples, at least (length + 7) / 8 bytes
+} PAT_StreamTypeDef;
+
+// Pattern compiler states
+typedef enum {
+    PAT_OK = 0,         // Operation successful
+    PAT_ERROR = 1       // Operation failed
+} PAT_StatusTypeDef;
+
+// Function prototypes
+PAT_StatusTypeDef PAT_Compile(const PAT_StreamTypeDef *streams, uint32_t count,
+                              uint32_t *words, uint32_t length);
+PAT_StatusTypeDef PAT_CompileValues(const uint16_t *values, uint16_t mask,
+                                    uint32_t *words, uint32_t length);
+
+#endif /* PATTERN_H */
@@ -0,0 +1,48 @@
+#ifndef PATTERN_DMA_H
+#define PATTERN_DMA_H
+
+#include "stm32f4xx_hal.h"
+#include "pattern.h"
+
+// Configuration definitions
+#define PDMA_TIM            TIM1                        // Update event paces the samples
+#define PDMA_DMA_STREAM     DMA2_Stream5                // TIM1_UP request (only DMA2 reaches the GPIO ports)
+#define PDMA_DMA_CHANNEL    DMA_CHANNEL_6
+#define PDMA_DMA_IRQn       DMA2_Stream5_IRQn
+#define PDMA_IRQ_PRIORITY   1
+#define PDMA_MIN_TICKS      16                          // Timer clocks per sample: 5.25 MHz at 84 MHz
+#define PDMA_MAX_WORDS      65535                       // DMA transfer counter is 16 bits
+
+// Playback modes
+typedef enum {
+    PDMA_ONESHOT = 0,   // Play once, pins keep the last sample
+    PDMA_CIRCULAR = 1   // Repeat until PDMA_Stop
+} PDMA_ModeTypeDef;
+
+// Pattern engine structure
+typedef struct {
+    DMA_HandleTypeDef hdma;         // Memory to BSRR stream
+    GPIO_TypeDef *port;             // Port written by the pattern
+    volatile uint8_t busy;          // Playing
+    volatile uint8_t error;         // Last playback ended on a DMA error
+    volatile uint32_t passes;       // Completed passes since PDMA_Start (one-shot only)
+    uint32_t length;                // Samples per pass
+} PDMA_HandleTypeDef;
+
+// Pattern engine states
+typedef enum {
+    PDMA_OK = 0,        // Operation successful
+    PDMA_ERROR = 1      // Operation failed
+} PDMA_StatusTypeDef;
+
+// Function prototypes
+PDMA_StatusTypeDef PDMA_Init(PDMA_HandleTypeDef *eng, GPIO_TypeDef *port);
+PDMA_StatusTypeDef PDMA_Start(PDMA_HandleTypeDef *eng, const uint32_t *words, uint32_t length,
+                              uint32_t rate_hz, PDMA_ModeTypeDef mode);
+PDMA_StatusTypeDef PDMA_Stop(PDMA_HandleTypeDef *eng);
+uint8_t PDMA_IsBusy(const PDMA_HandleTypeDef *eng);
+uint32_t PDMA_GetRate(void);
+uint32_t PDMA_GetPosition(const PDMA_HandleTypeDef *eng);
+void PDMA_IRQHandler(PDMA_HandleTypeDef *eng);
+
+#endif /* PATTERN_DMA_H */
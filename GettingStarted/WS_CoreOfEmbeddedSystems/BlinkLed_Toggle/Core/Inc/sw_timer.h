@@ -0,0 +1,51 @@
+#ifndef SW_TIMER_H
+#define SW_TIMER_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define SWTIM_SLOT_BITS     6                           // 64 slots per level
+#define SWTIM_SLOTS         (1U << SWTIM_SLOT_BITS)
+#define SWTIM_LEVELS        4                           // 4 x 6 bits: 2^24 ticks (4.6 h at 1 kHz)
+#define SWTIM_MAX_DELAY     0x7FFFFFFFUL                // Longer waits are clamped
+
+// Intrusive doubly-linked list node; a slot is an empty node (sentinel)
+typedef struct SWTIM_ListStruct {
+    struct SWTIM_ListStruct *next;
+    struct SWTIM_ListStruct *prev;
+} SWTIM_ListTypeDef;
+
+// Expiry callback, runs in the context that calls SWTIM_Process
+typedef void (*SWTIM_CallbackTypeDef)(void *arg);
+
+// Software timer structure (node must stay the first member)
+typedef struct {
+    SWTIM_ListTypeDef node;             // Wheel slot link, self-linked when stopped
+    uint32_t expires;                   // Absolute expiry tick
+    uint32_t period;                    // Reload in ticks, 0 = one-shot
+    SWTIM_CallbackTypeDef callback;     // Called on expiry
+    void *arg;                          // Passed to the callback
+} SWTIM_TimerTypeDef;
+
+// Timer wheel structure
+typedef struct {
+    SWTIM_ListTypeDef slots[SWTIM_LEVELS][SWTIM_SLOTS];    // Level 0 = finest
+    uint32_t base;                      // Next tick to process
+} SWTIM_WheelTypeDef;
+
+// Software timer states
+typedef enum {
+    SWTIM_OK = 0,       // Operation successful
+    SWTIM_ERROR = 1     // Operation failed
+} SWTIM_StatusTypeDef;
+
+// Function prototypes
+SWTIM_StatusTypeDef SWTIM_InitWheel(SWTIM_WheelTypeDef *wheel, uint32_t now);
+SWTIM_StatusTypeDef SWTIM_Init(SWTIM_TimerTypeDef *timer, SWTIM_CallbackTypeDef callback, void *arg);
+SWTIM_StatusTypeDef SWTIM_Start(SWTIM_WheelTypeDef *wheel, SWTIM_TimerTypeDef *timer,
+                                uint32_t delay, uint32_t period);
+SWTIM_StatusTypeDef SWTIM_Stop(SWTIM_TimerTypeDef *timer);
+uint8_t SWTIM_IsActive(const SWTIM_TimerTypeDef *timer);
+uint32_t SWTIM_Process(SWTIM_WheelTypeDef *wheel, uint32_t now);
+
+#endif /* SW_TIMER_H */
@@ -21,6 +21,10 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "sw_timer.h"
+#include "pattern_dma.h"
+#include <stdio.h>
+#include <string.h>
 
 /* USER CODE END Includes */
 
@@ -31,6 +35,12 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define BLINK_PERIOD_MS   1000    // LED toggle period
+#define REPORT_PERIOD_MS  5000    // Uptime report period
+#define PATTERN_PORT      GPIOC     // PC0..PC3 (CN7 pins 38, 36, 35, 37)
+#define PATTERN_PINS      (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+#define PATTERN_RATE_HZ   1000000   // Samples per second
+#define PATTERN_LENGTH    16        // Samples per pass
 
 /* USER CODE END PD */
 
@@ -43,6 +53,24 @@
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+SWTIM_WheelTypeDef timers;
+SWTIM_TimerTypeDef blink_timer;
+SWTIM_TimerTypeDef report_timer;
+PDMA_HandleTypeDef pattern;
+uint32_t pattern_words[PATTERN_LENGTH];
+
+// 4-bit counter as per-pin bitstreams (sample i = bit i, LSB first):
+// PC0 toggles every sample, PC1 every 2, PC2 every 4, PC3 every 8
+static const uint8_t pattern_bit0[] = { 0xAA, 0xAA };
+static const uint8_t pattern_bit1[] = { 0xCC, 0xCC };
+static const uint8_t pattern_bit2[] = { 0xF0, 0xF0 };
+static const uint8_t pattern_bit3[] = { 0x00, 0xFF };
+static const PAT_StreamTypeDef pattern_streams[] = {
+  { 0, pattern_bit0 },
+  { 1, pattern_bit1 },
+  { 2, pattern_bit2 },
+  { 3, pattern_bit3 },
+};
 
 /* USER CODE END PV */
 
@@ -51,6 +79,9 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
+static void BlinkLed(void *arg);
+static void ReportUptime(void *arg);
+static void StartPattern(void);
 
 /* USER CODE END PFP */
 
@@ -90,6 +121,12 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  SWTIM_InitWheel(&timers, HAL_GetTick());
+  SWTIM_Init(&blink_timer, BlinkLed, NULL);
+  SWTIM_Init(&report_timer, ReportUptime, NULL);
+  SWTIM_Start(&timers, &blink_timer, BLINK_PERIOD_MS, BLINK_PERIOD_MS);
+  SWTIM_Start(&timers, &report_timer, REPORT_PERIOD_MS, REPORT_PERIOD_MS);
+  StartPattern();
 
   /* USER CODE END 2 */
 
@@ -97,8 +134,8 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-    HAL_GPIO_TogglePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin);
-    HAL_Delay(1000);
+    // HAL_GetTick advances in SysTick_Handler; callbacks run here, not in the interrupt
+    SWTIM_Process(&timers, HAL_GetTick());
 
 	/* USER CODE END WHILE */
 
@@ -226,7 +263,53 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Toggle the green LED (blink_timer callback)
+  * @param  arg: Unused
+  * @retval None
+  */
+static void BlinkLed(void *arg)
+{
+  HAL_GPIO_TogglePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin);
+}
 
+/**
+  * @brief  Print the uptime over USART2 (report_timer callback)
+  * @param  arg: Unused
+  * @retval None
+  */
+static void ReportUptime(void *arg)
+{
+  char msg[80];
+
+  sprintf(msg, "Uptime: %lu ms, pattern: %lu Hz, at sample %lu%s\r\n", HAL_GetTick(),
+          PDMA_GetRate(), PDMA_GetPosition(&pattern), pattern.error ? " (DMA error)" : "");
+  HAL_UART_Transmit(&huart2, (uint8_t*)msg, strlen(msg), HAL_MAX_DELAY);
+}
+
+/**
+  * @brief  Compile the demo pattern and play it on PC0..PC3 in a loop
+  * @note   Runs on DMA2 paced by TIM1: no CPU time per sample
+  * @retval None
+  */
+static void StartPattern(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  GPIO_InitStruct.Pin = PATTERN_PINS;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  HAL_GPIO_Init(PATTERN_PORT, &GPIO_InitStruct);
+
+  if (PAT_Compile(pattern_streams, sizeof(pattern_streams) / sizeof(pattern_streams[0]),
+                  pattern_words, PATTERN_LENGTH) != PAT_OK ||
+      PDMA_Init(&pattern, PATTERN_PORT) != PDMA_OK ||
+      PDMA_Start(&pattern, pattern_words, PATTERN_LENGTH, PATTERN_RATE_HZ, PDMA_CIRCULAR) != PDMA_OK)
+  {
+    Error_Handler();
+  }
+}
 /* USER CODE END 4 */
 
 /**
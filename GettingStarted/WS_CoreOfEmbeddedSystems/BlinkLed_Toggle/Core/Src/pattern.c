@@ -0,0 +1,73 @@
+#include "pattern.h"
+#include <stddef.h>
+
+/**
+ * @brief Compile per-pin bitstreams into BSRR words
+ * @note  Every word drives every listed pin, so each sample is complete on
+ *        its own: a circular pattern can be entered anywhere and a stray
+ *        write to the port is overwritten by the next sample. Pins not
+ *        listed are never touched
+ * @param streams: One entry per pin, pins must be distinct
+ * @param count: Number of streams (1..PAT_MAX_PINS)
+ * @param words: Output, one BSRR word per sample
+ * @param length: Number of samples
+ * @retval PAT_StatusTypeDef: Operation status
+ */
+PAT_StatusTypeDef PAT_Compile(const PAT_StreamTypeDef *streams, uint32_t count,
+                              uint32_t *words, uint32_t length)
+{
+    uint32_t used = 0;
+
+    if (streams == NULL || words == NULL || count == 0U || count > PAT_MAX_PINS) {
+        return PAT_ERROR;
+    }
+
+    for (uint32_t s = 0; s < count; s++) {
+        if (streams[s].pin >= PAT_MAX_PINS || streams[s].bits == NULL ||
+            (used & (1UL << streams[s].pin)) != 0U) {
+            return PAT_ERROR;
+        }
+        used |= 1UL << streams[s].pin;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        words[i] = 0;
+    }
+
+    // One pass per pin, adding its set or reset bit to every word
+    for (uint32_t s = 0; s < count; s++) {
+        uint32_t set = 1UL << streams[s].pin;
+        uint32_t reset = set << 16U;
+        const uint8_t *bits = streams[s].bits;
+
+        for (uint32_t i = 0; i < length; i++) {
+            words[i] |= ((bits[i >> 3] >> (i & 7U)) & 1U) ? set : reset;
+        }
+    }
+
+    return PAT_OK;
+}
+
+/**
+ * @brief Compile whole-port samples into BSRR words
+ * @note  For patterns that are easier to write as port values (counters,
+ *        bus cycles) than as per-pin streams
+ * @param values: Port value per sample (bit n = pin n)
+ * @param mask: Pins driven by the pattern; other bits of 'values' are ignored
+ * @param words: Output, one BSRR word per sample
+ * @param length: Number of samples
+ * @retval PAT_StatusTypeDef: Operation status
+ */
+PAT_StatusTypeDef PAT_CompileValues(const uint16_t *values, uint16_t mask,
+                                    uint32_t *words, uint32_t length)
+{
+    if (values == NULL || words == NULL || mask == 0U) {
+        return PAT_ERROR;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        words[i] = PAT_WORD(mask, values[i]);
+    }
+
+    return PAT_OK;
+}
@@ -0,0 +1,246 @@
+#include "pattern_dma.h"
+
+/**
+ * @brief Get the clock of the pacing timer
+ * @note  APB2 timers run at twice the bus clock when the APB prescaler is not 1
+ * @retval uint32_t: Timer input clock in Hz
+ */
+static uint32_t PDMA_TimerClock(void)
+{
+    uint32_t clk = HAL_RCC_GetPCLK2Freq();
+
+    if ((RCC->CFGR & RCC_CFGR_PPRE2) != RCC_CFGR_PPRE2_DIV1) {
+        clk *= 2U;
+    }
+
+    return clk;
+}
+
+/**
+ * @brief Stop the pacing timer and its DMA requests
+ */
+static inline void PDMA_TimerStop(void)
+{
+    PDMA_TIM->CR1 &= ~TIM_CR1_CEN;
+    PDMA_TIM->DIER = 0;
+}
+
+/**
+ * @brief DMA transfer complete: end of a one-shot pass
+ * @param hdma: DMA handle of the engine
+ */
+static void PDMA_TransferComplete(DMA_HandleTypeDef *hdma)
+{
+    PDMA_HandleTypeDef *eng = (PDMA_HandleTypeDef *)hdma->Parent;
+
+    eng->passes++;
+    if (hdma->Init.Mode != DMA_CIRCULAR) {
+        PDMA_TimerStop();
+        eng->busy = 0;
+    }
+}
+
+/**
+ * @brief DMA transfer error: playback is stopped
+ * @param hdma: DMA handle of the engine
+ */
+static void PDMA_TransferError(DMA_HandleTypeDef *hdma)
+{
+    PDMA_HandleTypeDef *eng = (PDMA_HandleTypeDef *)hdma->Parent;
+
+    PDMA_TimerStop();
+    eng->error = 1;
+    eng->busy = 0;
+}
+
+/**
+ * @brief Initialize the pattern engine
+ * @note  The pins are configured by the caller (push-pull outputs, speed to
+ *        match the sample rate); the engine only writes the port's BSRR
+ * @param eng: Pointer to PDMA_HandleTypeDef structure
+ * @param port: GPIO port the patterns are written to
+ * @retval PDMA_StatusTypeDef: Operation status
+ */
+PDMA_StatusTypeDef PDMA_Init(PDMA_HandleTypeDef *eng, GPIO_TypeDef *port)
+{
+    if (eng == NULL || port == NULL) {
+        return PDMA_ERROR;
+    }
+
+    eng->port = port;
+    eng->busy = 0;
+    eng->error = 0;
+    eng->passes = 0;
+    eng->length = 0;
+
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    __HAL_RCC_TIM1_CLK_ENABLE();
+
+    // Registers only: the TIM HAL module is not part of this project
+    PDMA_TimerStop();
+    PDMA_TIM->CR1 = TIM_CR1_URS | TIM_CR1_ARPE;
+    PDMA_TIM->RCR = 0;
+
+    eng->hdma.Instance = PDMA_DMA_STREAM;
+    eng->hdma.Init.Channel = PDMA_DMA_CHANNEL;
+    eng->hdma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    eng->hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+    eng->hdma.Init.MemInc = DMA_MINC_ENABLE;
+    eng->hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    eng->hdma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    eng->hdma.Init.Mode = DMA_NORMAL;
+    eng->hdma.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+    eng->hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;     // One word per request, no batching
+    eng->hdma.Parent = eng;
+    if (HAL_DMA_Init(&eng->hdma) != HAL_OK) {
+        return PDMA_ERROR;
+    }
+    eng->hdma.XferCpltCallback = PDMA_TransferComplete;
+    eng->hdma.XferHalfCpltCallback = NULL;
+    eng->hdma.XferErrorCallback = PDMA_TransferError;
+
+    HAL_NVIC_SetPriority(PDMA_DMA_IRQn, PDMA_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(PDMA_DMA_IRQn);
+
+    return PDMA_OK;
+}
+
+/**
+ * @brief Start playing a compiled pattern
+ * @note  The first sample is written one timer clock after the call, the
+ *        following ones exactly one period apart. The CPU is not involved
+ *        until the end of a one-shot pass, so the rate is set by the timer
+ *        alone, up to PDMA_MIN_TICKS timer clocks per sample. Circular
+ *        playback takes no interrupt at all (a short pattern at a high rate
+ *        would otherwise interrupt every few microseconds): only DMA errors
+ *        are reported, and PDMA_GetPosition tells where it is. The words
+ *        must stay valid (and unchanged, unless double buffering on
+ *        purpose) while playing
+ * @param eng: Pointer to PDMA_HandleTypeDef structure
+ * @param words: BSRR words from PAT_Compile or PAT_CompileValues
+ * @param length: Number of samples (1..PDMA_MAX_WORDS)
+ * @param rate_hz: Sample rate; the nearest rate the timer can make is used
+ * @param mode: PDMA_ONESHOT or PDMA_CIRCULAR
+ * @retval PDMA_StatusTypeDef: Operation status
+ */
+PDMA_StatusTypeDef PDMA_Start(PDMA_HandleTypeDef *eng, const uint32_t *words, uint32_t length,
+                              uint32_t rate_hz, PDMA_ModeTypeDef mode)
+{
+    uint32_t ticks;
+    uint32_t psc;
+
+    if (eng == NULL || words == NULL || length == 0U || length > PDMA_MAX_WORDS ||
+        rate_hz == 0U || eng->busy) {
+        return PDMA_ERROR;
+    }
+
+    ticks = (PDMA_TimerClock() + rate_hz / 2U) / rate_hz;
+    if (ticks < PDMA_MIN_TICKS) {
+        return PDMA_ERROR;
+    }
+
+    // Smallest prescaler that fits the 16-bit counter keeps the finest rate step
+    psc = (ticks - 1U) >> 16;
+    if (psc > 0xFFFFU) {
+        return PDMA_ERROR;
+    }
+
+    PDMA_TimerStop();
+    PDMA_TIM->PSC = psc;
+    PDMA_TIM->ARR = ticks / (psc + 1U) - 1U;
+    PDMA_TIM->EGR = TIM_EGR_UG;         // Load PSC and ARR; URS keeps the request quiet
+    PDMA_TIM->SR = 0;
+
+    eng->hdma.Init.Mode = (mode == PDMA_CIRCULAR) ? DMA_CIRCULAR : DMA_NORMAL;
+    if (HAL_DMA_Init(&eng->hdma) != HAL_OK) {
+        return PDMA_ERROR;
+    }
+
+    eng->error = 0;
+    eng->passes = 0;
+    eng->length = length;
+    eng->busy = 1;
+    if (HAL_DMA_Start_IT(&eng->hdma, (uint32_t)words, (uint32_t)&eng->port->BSRR, length) != HAL_OK) {
+        eng->busy = 0;
+        return PDMA_ERROR;
+    }
+    if (mode == PDMA_CIRCULAR) {
+        // Keep the error interrupts only; no request has been made yet
+        __HAL_DMA_DISABLE_IT(&eng->hdma, DMA_IT_TC);
+    }
+
+    // Counter at the top: the first update, and sample 0, comes one tick later
+    PDMA_TIM->CNT = PDMA_TIM->ARR;
+    PDMA_TIM->DIER = TIM_DIER_UDE;
+    PDMA_TIM->CR1 |= TIM_CR1_CEN;
+
+    return PDMA_OK;
+}
+
+/**
+ * @brief Stop playing
+ * @note  Pins keep the last sample written
+ * @param eng: Pointer to PDMA_HandleTypeDef structure
+ * @retval PDMA_StatusTypeDef: Operation status
+ */
+PDMA_StatusTypeDef PDMA_Stop(PDMA_HandleTypeDef *eng)
+{
+    if (eng == NULL) {
+        return PDMA_ERROR;
+    }
+
+    PDMA_TimerStop();
+    if (HAL_DMA_GetState(&eng->hdma) == HAL_DMA_STATE_BUSY) {
+        HAL_DMA_Abort(&eng->hdma);
+    }
+    eng->busy = 0;
+
+    return PDMA_OK;
+}
+
+/**
+ * @brief Check whether a pattern is playing
+ * @param eng: Pointer to PDMA_HandleTypeDef structure
+ * @retval uint8_t: 1 while playing
+ */
+uint8_t PDMA_IsBusy(const PDMA_HandleTypeDef *eng)
+{
+    return eng->busy;
+}
+
+/**
+ * @brief Get the sample rate actually programmed by the last PDMA_Start
+ * @retval uint32_t: Samples per second
+ */
+uint32_t PDMA_GetRate(void)
+{
+    return PDMA_TimerClock() / ((PDMA_TIM->PSC + 1U) * (PDMA_TIM->ARR + 1U));
+}
+
+/**
+ * @brief Get the sample the engine writes next
+ * @note  Read from the DMA transfer counter, so it costs no interrupt
+ * @param eng: Pointer to PDMA_HandleTypeDef structure
+ * @retval uint32_t: Sample index (0..length-1); 0 once a one-shot pass ended
+ */
+uint32_t PDMA_GetPosition(const PDMA_HandleTypeDef *eng)
+{
+    uint32_t left = __HAL_DMA_GET_COUNTER(&eng->hdma);
+
+    if (eng->length == 0U || left == 0U) {
+        return 0;
+    }
+
+    return eng->length - left;
+}
+
+/**
+ * @brief DMA interrupt of the engine
+ * @note  Call from DMA2_Stream5_IRQHandler. Runs at the end of a one-shot
+ *        pass and on DMA errors, never per sample
+ * @param eng: Pointer to PDMA_HandleTypeDef structure
+ */
+void PDMA_IRQHandler(PDMA_HandleTypeDef *eng)
+{
+    HAL_DMA_IRQHandler(&eng->hdma);
+}
@@ -22,6 +22,7 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "pattern_dma.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,6 +58,7 @@
 /* External variables --------------------------------------------------------*/
 
 /* USER CODE BEGIN EV */
+extern PDMA_HandleTypeDef pattern;
 
 /* USER CODE END EV */
 
@@ -199,5 +201,12 @@ void SysTick_Handler(void)
 /******************************************************************************/
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles DMA2 stream5 global interrupt (pattern engine).
+  */
+void DMA2_Stream5_IRQHandler(void)
+{
+  PDMA_IRQHandler(&pattern);
+}
 
 /* USER CODE END 1 */
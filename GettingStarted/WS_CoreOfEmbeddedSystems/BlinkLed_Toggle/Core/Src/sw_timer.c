@@ -0,0 +1,269 @@
+#include "sw_timer.h"
+#include <stddef.h>
+
+#define SWTIM_SLOT_MASK     (SWTIM_SLOTS - 1U)
+#define SWTIM_RANGE         (1UL << (SWTIM_SLOT_BITS * SWTIM_LEVELS))
+
+/**
+ * @brief Make a list empty (or a node unlinked)
+ * @param list: List head or node
+ */
+static inline void SWTIM_ListInit(SWTIM_ListTypeDef *list)
+{
+    list->next = list;
+    list->prev = list;
+}
+
+/**
+ * @brief Append a node at the tail of a list
+ * @param list: List head
+ * @param node: Unlinked node
+ */
+static inline void SWTIM_ListAppend(SWTIM_ListTypeDef *list, SWTIM_ListTypeDef *node)
+{
+    node->next = list;
+    node->prev = list->prev;
+    list->prev->next = node;
+    list->prev = node;
+}
+
+/**
+ * @brief Unlink a node from its list and leave it self-linked
+ * @param node: Linked or unlinked node
+ */
+static inline void SWTIM_ListRemove(SWTIM_ListTypeDef *node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    SWTIM_ListInit(node);
+}
+
+/**
+ * @brief Move every node of a list to an empty list head
+ * @param from: Source list, left empty
+ * @param to: Destination head (its previous content is dropped)
+ */
+static inline void SWTIM_ListTake(SWTIM_ListTypeDef *from, SWTIM_ListTypeDef *to)
+{
+    if (from->next == from) {
+        SWTIM_ListInit(to);
+        return;
+    }
+
+    to->next = from->next;
+    to->prev = from->prev;
+    to->next->prev = to;
+    to->prev->next = to;
+    SWTIM_ListInit(from);
+}
+
+/**
+ * @brief Link a timer into the slot matching its expiry
+ * @note  The level is chosen by the distance to the next processed tick and
+ *        the slot by the expiry bits of that level, so a timer cascades down
+ *        exactly when its coarse slot comes round. Expiries already due go
+ *        to the current slot; expiries beyond the wheel range park in the
+ *        farthest top-level slot and are re-filed when it cascades
+ * @param wheel: Pointer to SWTIM_WheelTypeDef structure
+ * @param timer: Stopped timer with expires set
+ */
+static void SWTIM_Insert(SWTIM_WheelTypeDef *wheel, SWTIM_TimerTypeDef *timer)
+{
+    uint32_t expires = timer->expires;
+    uint32_t delta = expires - wheel->base;
+    uint32_t level;
+
+    if ((int32_t)delta < 0) {
+        expires = wheel->base;
+        delta = 0;
+    } else if (delta >= SWTIM_RANGE) {
+        delta = SWTIM_RANGE - 1U;
+        expires = wheel->base + delta;
+    }
+
+    for (level = 0; level < SWTIM_LEVELS - 1U; level++) {
+        if (delta < (1UL << (SWTIM_SLOT_BITS * (level + 1U)))) {
+            break;
+        }
+    }
+
+    SWTIM_ListAppend(&wheel->slots[level][(expires >> (SWTIM_SLOT_BITS * level)) & SWTIM_SLOT_MASK],
+                     &timer->node);
+}
+
+/**
+ * @brief Re-file the timers of one coarse slot into finer levels
+ * @param wheel: Pointer to SWTIM_WheelTypeDef structure
+ * @param level: Level to cascade (1..SWTIM_LEVELS-1)
+ * @retval uint32_t: Slot index that was cascaded (0 = the next level is due too)
+ */
+static uint32_t SWTIM_Cascade(SWTIM_WheelTypeDef *wheel, uint32_t level)
+{
+    uint32_t index = (wheel->base >> (SWTIM_SLOT_BITS * level)) & SWTIM_SLOT_MASK;
+    SWTIM_ListTypeDef pending;
+
+    SWTIM_ListTake(&wheel->slots[level][index], &pending);
+
+    while (pending.next != &pending) {
+        SWTIM_TimerTypeDef *timer = (SWTIM_TimerTypeDef *)pending.next;
+
+        SWTIM_ListRemove(&timer->node);
+        SWTIM_Insert(wheel, timer);
+    }
+
+    return index;
+}
+
+/**
+ * @brief Initialize a timer wheel
+ * @param wheel: Pointer to SWTIM_WheelTypeDef structure
+ * @param now: Current tick (e.g. HAL_GetTick()), taken as already processed
+ * @retval SWTIM_StatusTypeDef: Operation status
+ */
+SWTIM_StatusTypeDef SWTIM_InitWheel(SWTIM_WheelTypeDef *wheel, uint32_t now)
+{
+    if (wheel == NULL) {
+        return SWTIM_ERROR;
+    }
+
+    for (uint32_t level = 0; level < SWTIM_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < SWTIM_SLOTS; slot++) {
+            SWTIM_ListInit(&wheel->slots[level][slot]);
+        }
+    }
+    wheel->base = now + 1U;
+
+    return SWTIM_OK;
+}
+
+/**
+ * @brief Initialize a timer, stopped
+ * @param timer: Pointer to SWTIM_TimerTypeDef structure
+ * @param callback: Function called on expiry
+ * @param arg: Passed to the callback
+ * @retval SWTIM_StatusTypeDef: Operation status
+ */
+SWTIM_StatusTypeDef SWTIM_Init(SWTIM_TimerTypeDef *timer, SWTIM_CallbackTypeDef callback, void *arg)
+{
+    if (timer == NULL || callback == NULL) {
+        return SWTIM_ERROR;
+    }
+
+    SWTIM_ListInit(&timer->node);
+    timer->expires = 0;
+    timer->period = 0;
+    timer->callback = callback;
+    timer->arg = arg;
+
+    return SWTIM_OK;
+}
+
+/**
+ * @brief Start or restart a timer, O(1)
+ * @note  The delay counts from the last processed tick. A periodic timer
+ *        reloads from its previous expiry, so its phase does not drift
+ *        when SWTIM_Process runs late
+ * @param wheel: Pointer to SWTIM_WheelTypeDef structure
+ * @param timer: Pointer to SWTIM_TimerTypeDef structure
+ * @param delay: Ticks until the first expiry (0 is treated as 1)
+ * @param period: Ticks between later expiries, 0 = one-shot
+ * @retval SWTIM_StatusTypeDef: Operation status
+ */
+SWTIM_StatusTypeDef SWTIM_Start(SWTIM_WheelTypeDef *wheel, SWTIM_TimerTypeDef *timer,
+                                uint32_t delay, uint32_t period)
+{
+    if (wheel == NULL || timer == NULL || timer->callback == NULL) {
+        return SWTIM_ERROR;
+    }
+
+    if (delay == 0U) {
+        delay = 1;
+    } else if (delay > SWTIM_MAX_DELAY) {
+        delay = SWTIM_MAX_DELAY;
+    }
+    if (period > SWTIM_MAX_DELAY) {
+        period = SWTIM_MAX_DELAY;
+    }
+
+    SWTIM_ListRemove(&timer->node);
+    timer->expires = wheel->base - 1U + delay;
+    timer->period = period;
+    SWTIM_Insert(wheel, timer);
+
+    return SWTIM_OK;
+}
+
+/**
+ * @brief Stop a timer, O(1); stopping a stopped timer is harmless
+ * @param timer: Pointer to SWTIM_TimerTypeDef structure
+ * @retval SWTIM_StatusTypeDef: Operation status
+ */
+SWTIM_StatusTypeDef SWTIM_Stop(SWTIM_TimerTypeDef *timer)
+{
+    if (timer == NULL) {
+        return SWTIM_ERROR;
+    }
+
+    SWTIM_ListRemove(&timer->node);
+
+    return SWTIM_OK;
+}
+
+/**
+ * @brief Check whether a timer is running
+ * @param timer: Pointer to SWTIM_TimerTypeDef structure
+ * @retval uint8_t: 1 if started and not yet expired (or periodic), 0 otherwise
+ */
+uint8_t SWTIM_IsActive(const SWTIM_TimerTypeDef *timer)
+{
+    return (timer != NULL && timer->node.next != &timer->node) ? 1U : 0U;
+}
+
+/**
+ * @brief Advance the wheel up to 'now' and run the expired callbacks
+ * @note  Call from the main loop, never from an interrupt: the wheel is not
+ *        locked. Each tick costs one slot visit whatever the number of
+ *        timers, plus a cascade every SWTIM_SLOTS ticks. Callbacks may start
+ *        or stop any timer, including their own
+ * @param wheel: Pointer to SWTIM_WheelTypeDef structure
+ * @param now: Current tick (e.g. HAL_GetTick(), updated by HAL_IncTick in SysTick_Handler)
+ * @retval uint32_t: Number of callbacks run
+ */
+uint32_t SWTIM_Process(SWTIM_WheelTypeDef *wheel, uint32_t now)
+{
+    uint32_t fired = 0;
+
+    if (wheel == NULL) {
+        return 0;
+    }
+
+    while ((int32_t)(now - wheel->base) >= 0) {
+        uint32_t index = wheel->base & SWTIM_SLOT_MASK;
+        SWTIM_ListTypeDef expired;
+
+        if (index == 0U) {
+            for (uint32_t level = 1; level < SWTIM_LEVELS; level++) {
+                if (SWTIM_Cascade(wheel, level) != 0U) {
+                    break;
+                }
+            }
+        }
+
+        SWTIM_ListTake(&wheel->slots[0][index], &expired);
+        wheel->base++;
+
+        while (expired.next != &expired) {
+            SWTIM_TimerTypeDef *timer = (SWTIM_TimerTypeDef *)expired.next;
+
+            SWTIM_ListRemove(&timer->node);
+            if (timer->period != 0U) {
+                timer->expires += timer->period;
+                SWTIM_Insert(wheel, timer);
+            }
+            timer->callback(timer->arg);
+            fired++;
+        }
+    }
+
+    return fired;
+}
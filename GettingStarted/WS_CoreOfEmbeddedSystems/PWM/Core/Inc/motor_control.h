@@ -0,0 +1,58 @@
+#ifndef MOTOR_CONTROL_H
+#define MOTOR_CONTROL_H
+
+#include "stm32f4xx_hal.h"
+#include "pwm_control.h"
+#include "pid_q16.h"
+
+// Configuration definitions
+#define MOTOR_ENC_TIM         TIM3                // Quadrature encoder: PA6 = A (CH1), PA7 = B (CH2)
+#define MOTOR_ENC_PORT        GPIOA
+#define MOTOR_ENC_PINS        (GPIO_PIN_6 | GPIO_PIN_7)
+#define MOTOR_ENC_AF          GPIO_AF2_TIM3
+#define MOTOR_ENC_FILTER      6                   // Input filter (fDTS/4, N=6): rejects < ~0.3 us glitches
+#define MOTOR_PWM_TIM         TIM4                // Driver PWM: PB6 (CH1)
+#define MOTOR_PWM_CHANNEL     TIM_CHANNEL_1
+#define MOTOR_PWM_PORT        GPIOB
+#define MOTOR_PWM_PIN         GPIO_PIN_6
+#define MOTOR_PWM_AF          GPIO_AF2_TIM4
+#define MOTOR_PWM_HZ          20000               // Above audible range, fine for H-bridge drivers
+#define MOTOR_DIR_PORT        GPIOB               // Driver direction input
+#define MOTOR_DIR_PIN         GPIO_PIN_5
+#define MOTOR_LOOP_TIM        TIM10               // Control loop tick
+#define MOTOR_LOOP_IRQn       TIM1_UP_TIM10_IRQn
+#define MOTOR_LOOP_HZ         10000
+#define MOTOR_IRQ_PRIORITY    0                   // Highest: keeps the sample period jitter-free
+#define MOTOR_SPEED_TAPS      64                  // Speed window in loop periods (power of 2), 1 count = LOOP_HZ/TAPS counts/s
+
+// Motor speed controller structure
+typedef struct {
+    TIM_HandleTypeDef htim_enc;         // Encoder timer
+    TIM_HandleTypeDef htim_pwm;         // Driver PWM timer
+    TIM_HandleTypeDef htim_loop;        // Control loop timer
+    PWM_HandleTypeDef pwm;              // Duty cycle output
+    PIDQ16_HandleTypeDef pid;           // Speed controller (counts/s in, Q16 duty out)
+    uint16_t count_hist[MOTOR_SPEED_TAPS]; // Encoder counts of the last loop periods
+    uint8_t hist_pos;                   // Oldest entry of count_hist
+    int32_t counts_per_rev;             // Encoder counts per revolution (4x line count)
+    volatile int32_t setpoint_cps;      // Requested speed in counts/s
+    volatile int32_t speed_cps;         // Measured speed in counts/s
+    volatile int32_t duty_q16;          // Signed duty applied (-1..1 in Q16)
+    volatile uint32_t ticks;            // Control loop iterations
+} MOTOR_HandleTypeDef;
+
+// Motor controller states
+typedef enum {
+    MOTOR_OK = 0,       // Operation successful
+    MOTOR_ERROR = 1     // Operation failed
+} MOTOR_StatusTypeDef;
+
+// Function prototypes
+MOTOR_StatusTypeDef MOTOR_Init(MOTOR_HandleTypeDef *motor, int32_t counts_per_rev);
+MOTOR_StatusTypeDef MOTOR_Start(MOTOR_HandleTypeDef *motor);
+MOTOR_StatusTypeDef MOTOR_Stop(MOTOR_HandleTypeDef *motor);
+void MOTOR_SetSpeedRpm(MOTOR_HandleTypeDef *motor, int32_t rpm);
+int32_t MOTOR_GetSpeedRpm(const MOTOR_HandleTypeDef *motor);
+void MOTOR_IRQHandler(MOTOR_HandleTypeDef *motor);
+
+#endif /* MOTOR_CONTROL_H */
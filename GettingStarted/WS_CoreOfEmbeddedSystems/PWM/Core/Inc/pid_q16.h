@@ -0,0 +1,49 @@
+#ifndef PID_Q16_H
+#define PID_Q16_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define PIDQ16_ONE          65536L      // 1.0 in Q16
+#define PIDQ16_TWO_PI       411775L     // 2*pi in Q16
+
+// Convert a constant gain to Q16 at compile time (no float at run time)
+#define PIDQ16_GAIN(x)      ((int32_t)((x) * 65536.0 + (((x) < 0) ? -0.5 : 0.5)))
+
+// Fixed-point PID controller structure
+// Gains are Q16 and convert input units (setpoint/measurement) to output
+// units; ki and kd are stored per sample, see PIDQ16_SetGains
+typedef struct {
+    int32_t kp;             // Proportional gain (Q16)
+    int32_t ki;             // Integral gain per sample (Q16)
+    int32_t kd;             // Derivative gain per sample (Q16)
+    int32_t kff;            // Setpoint feed-forward gain (Q16)
+    int32_t ff_offset;      // Feed-forward offset in output units, signed like the setpoint
+    int32_t d_alpha;        // Derivative low-pass coefficient (Q16, PIDQ16_ONE = no filter)
+    int32_t out_min;        // Lowest output
+    int32_t out_max;        // Highest output
+    int64_t integ;          // Integrator in output units (Q16)
+    int64_t d_filt;         // Filtered derivative term in output units (Q16)
+    int32_t prev_meas;      // Measurement of the previous sample
+    int32_t output;         // Last output
+    uint8_t saturated;      // Last output was clamped
+    uint8_t primed;         // prev_meas holds a real sample
+} PIDQ16_HandleTypeDef;
+
+// PID status
+typedef enum {
+    PIDQ16_OK = 0,          // Operation successful
+    PIDQ16_ERROR = 1        // Invalid parameter
+} PIDQ16_StatusTypeDef;
+
+// Function prototypes
+PIDQ16_StatusTypeDef PIDQ16_Init(PIDQ16_HandleTypeDef *pid, int32_t out_min, int32_t out_max);
+PIDQ16_StatusTypeDef PIDQ16_SetGains(PIDQ16_HandleTypeDef *pid, int32_t kp, int32_t ki,
+                                     int32_t kd, uint32_t rate_hz);
+PIDQ16_StatusTypeDef PIDQ16_SetFeedForward(PIDQ16_HandleTypeDef *pid, int32_t kff, int32_t offset);
+PIDQ16_StatusTypeDef PIDQ16_SetDerivativeFilter(PIDQ16_HandleTypeDef *pid, uint32_t cutoff_hz,
+                                                uint32_t rate_hz);
+void PIDQ16_Reset(PIDQ16_HandleTypeDef *pid);
+int32_t PIDQ16_Update(PIDQ16_HandleTypeDef *pid, int32_t setpoint, int32_t measurement);
+
+#endif /* PID_Q16_H */
@@ -0,0 +1,35 @@
+#ifndef PWM_CALC_H
+#define PWM_CALC_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define PWMCALC_PSC_MAX       0xFFFFUL      // 16-bit prescaler on every STM32F4 timer
+#define PWMCALC_ARR_MAX_16B   0xFFFFUL      // TIM1, TIM3, TIM4, TIM9..TIM11
+#define PWMCALC_ARR_MAX_32B   0xFFFFFFFFUL  // TIM2, TIM5
+#define PWMCALC_DUTY_Q16_ONE  0x10000UL     // 100 % duty in Q16
+
+// Timer settings for a requested PWM frequency
+typedef struct {
+    uint32_t prescaler;     // Value for TIMx->PSC (divider - 1)
+    uint32_t period;        // Value for TIMx->ARR (counts - 1)
+    uint32_t actual_hz;     // Resulting frequency, rounded to nearest Hz
+    int32_t error_ppm;      // (actual - requested) / requested, in ppm
+} PWMCALC_TimingTypeDef;
+
+// PWM calculation status
+typedef enum {
+    PWMCALC_OK = 0,         // Settings computed
+    PWMCALC_ERROR = 1,      // Invalid parameter
+    PWMCALC_TOO_LOW = 2,    // Frequency below timer range
+    PWMCALC_TOO_HIGH = 3    // Frequency above timer range (fewer than 2 counts)
+} PWMCALC_StatusTypeDef;
+
+// Function prototypes
+PWMCALC_StatusTypeDef PWMCALC_Compute(uint32_t timer_clk_hz, uint32_t freq_hz,
+                                      uint32_t arr_max, PWMCALC_TimingTypeDef *timing);
+uint32_t PWMCALC_PulseFromPermille(uint32_t period, uint16_t permille);
+uint32_t PWMCALC_PulseFromQ16(uint32_t period, uint32_t duty_q16);
+uint32_t PWMCALC_PermilleToQ16(uint16_t permille);
+
+#endif /* PWM_CALC_H */
@@ -0,0 +1,33 @@
+#ifndef PWM_CONTROL_H
+#define PWM_CONTROL_H
+
+#include "stm32f4xx_hal.h"
+#include "pwm_calc.h"
+
+// PWM output structure
+typedef struct {
+    TIM_HandleTypeDef *htim;        // Timer handle pointer
+    uint32_t channel;               // TIM_CHANNEL_x
+    uint32_t timer_clk_hz;          // Timer kernel clock
+    uint32_t arr_max;               // Largest ARR of this timer
+    uint32_t freq_hz;               // Requested frequency
+    uint32_t duty_q16;              // Requested duty cycle (Q16)
+    PWMCALC_TimingTypeDef timing;   // Settings currently programmed
+} PWM_HandleTypeDef;
+
+// PWM output states
+typedef enum {
+    PWM_OK = 0,         // Operation successful
+    PWM_ERROR = 1,      // Invalid parameter
+    PWM_RANGE = 2       // Frequency not reachable with this timer clock
+} PWM_StatusTypeDef;
+
+// Function prototypes
+PWM_StatusTypeDef PWM_Init(PWM_HandleTypeDef *pwm, TIM_HandleTypeDef *htim, uint32_t channel);
+PWM_StatusTypeDef PWM_Set(PWM_HandleTypeDef *pwm, uint32_t freq_hz, uint32_t duty_q16);
+PWM_StatusTypeDef PWM_SetFrequency(PWM_HandleTypeDef *pwm, uint32_t freq_hz);
+PWM_StatusTypeDef PWM_SetDutyQ16(PWM_HandleTypeDef *pwm, uint32_t duty_q16);
+PWM_StatusTypeDef PWM_SetDutyPermille(PWM_HandleTypeDef *pwm, uint16_t permille);
+uint32_t PWM_GetTimerClock(TIM_HandleTypeDef *htim);
+
+#endif /* PWM_CONTROL_H */
@@ -0,0 +1,25 @@
+#ifndef RAM_FUNC_H
+#define RAM_FUNC_H
+
+// RAM-resident code
+// RAM_FUNC places a function in the .RamFunc input section, which the
+// FLASH linker script collects into .data: the startup copies it to SRAM
+// with the initialized data and it then runs without flash wait states.
+// Calls between flash and SRAM are out of BL range; the linker inserts
+// the long-branch veneers, so callers need no annotation.
+//
+// Build flags:
+//   default         arm-none-eabi-gcc: code in SRAM
+//   RAM_FUNC_FLASH  keep annotated code in flash (A/B comparison)
+//   host compilers  RAM_FUNC expands to nothing
+//
+// Keep annotated functions small and self-contained: every byte is paid
+// in SRAM (the running copy) and in flash (the load image). The linker
+// script checks the total against _Max_RamFunc_Size.
+#if defined(__GNUC__) && defined(__arm__) && !defined(RAM_FUNC_FLASH)
+#define RAM_FUNC    __attribute__((section(".RamFunc"), noinline))
+#else
+#define RAM_FUNC
+#endif
+
+#endif /* RAM_FUNC_H */
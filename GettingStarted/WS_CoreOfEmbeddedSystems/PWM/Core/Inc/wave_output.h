@@ -0,0 +1,42 @@
+#ifndef WAVE_OUTPUT_H
+#define WAVE_OUTPUT_H
+
+#include "stm32f4xx_hal.h"
+#include "wavegen.h"
+
+// Configuration definitions
+#define WAVEOUT_BUFFER_LEN    256                 // Circular DMA buffer (two halves)
+#define WAVEOUT_HALF_LEN      (WAVEOUT_BUFFER_LEN / 2U)
+#define WAVEOUT_DMA_STREAM    DMA1_Stream5        // TIM2_CH1 request (RM0368 DMA1 mapping)
+#define WAVEOUT_DMA_CHANNEL   DMA_CHANNEL_3
+#define WAVEOUT_DMA_IRQn      DMA1_Stream5_IRQn
+#define WAVEOUT_IRQ_PRIORITY  1
+
+// Waveform output structure
+typedef struct {
+    TIM_HandleTypeDef *htim;            // PWM timer handle (channel 1)
+    DMA_HandleTypeDef hdma;             // DMA stream feeding CCR1
+    uint32_t buffer[WAVEOUT_BUFFER_LEN];// Compare values, refilled half by half
+    WAVE_GeneratorTypeDef active;       // Generator producing samples
+    WAVE_GeneratorTypeDef pending;      // Generator waiting for the next half
+    volatile uint8_t pending_valid;     // Pending generator is ready to swap in
+    uint32_t period;                    // ARR of the PWM carrier
+    uint32_t sample_rate_hz;            // One sample per PWM period
+} WAVEOUT_HandleTypeDef;
+
+// Waveform output states
+typedef enum {
+    WAVEOUT_OK = 0,     // Operation successful
+    WAVEOUT_ERROR = 1   // Operation failed
+} WAVEOUT_StatusTypeDef;
+
+// Function prototypes
+WAVEOUT_StatusTypeDef WAVEOUT_Init(WAVEOUT_HandleTypeDef *wave, TIM_HandleTypeDef *htim,
+                                   uint32_t timer_clk_hz);
+WAVEOUT_StatusTypeDef WAVEOUT_Start(WAVEOUT_HandleTypeDef *wave, const WAVE_GeneratorTypeDef *gen);
+WAVEOUT_StatusTypeDef WAVEOUT_Stop(WAVEOUT_HandleTypeDef *wave);
+void WAVEOUT_Queue(WAVEOUT_HandleTypeDef *wave, const WAVE_GeneratorTypeDef *gen);
+void WAVEOUT_HalfCpltHandler(WAVEOUT_HandleTypeDef *wave);
+void WAVEOUT_CpltHandler(WAVEOUT_HandleTypeDef *wave);
+
+#endif /* WAVE_OUTPUT_H */
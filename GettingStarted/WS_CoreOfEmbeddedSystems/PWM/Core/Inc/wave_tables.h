@@ -0,0 +1,13 @@
+#ifndef WAVE_TABLES_H
+#define WAVE_TABLES_H
+
+#include <stdint.h>
+
+// Table geometry (must match Tools/gen_wave_tables.py)
+#define WAVE_SINE_TABLE_BITS 8
+#define WAVE_SINE_TABLE_SIZE (1U << WAVE_SINE_TABLE_BITS)
+
+// One Q15 sine period (wave_tables.c is generated)
+extern const int16_t WAVE_SineTable[WAVE_SINE_TABLE_SIZE];
+
+#endif /* WAVE_TABLES_H */
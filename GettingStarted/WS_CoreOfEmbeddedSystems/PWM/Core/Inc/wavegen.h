@@ -0,0 +1,42 @@
+#ifndef WAVEGEN_H
+#define WAVEGEN_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define WAVE_AMPLITUDE_ONE   32768L     // Amplitude 1.0 in Q15
+
+// Phase as a fraction of a period (Q32 turns) from degrees
+#define WAVE_PHASE_DEG(deg)  ((uint32_t)(((uint64_t)(deg) << 32) / 360U))
+
+// Waveform shapes
+typedef enum {
+    WAVE_SINE = 0,      // Generated sine table, interpolated
+    WAVE_TRIANGLE,      // Computed from the phase
+    WAVE_SAWTOOTH,      // Computed from the phase
+    WAVE_SQUARE,        // Computed from the phase
+    WAVE_CUSTOM         // User Q15 table, interpolated
+} WAVE_ShapeTypeDef;
+
+// Direct digital synthesis generator
+typedef struct {
+    WAVE_ShapeTypeDef shape;    // Waveform shape
+    const int16_t *table;       // Q15 table for WAVE_CUSTOM (2^table_bits entries)
+    uint8_t table_bits;         // log2 of the custom table length
+    uint32_t phase;             // Phase accumulator (Q32 turns)
+    uint32_t phase_step;        // Phase increment per output sample
+    int32_t amplitude;          // Q15 gain, 0..WAVE_AMPLITUDE_ONE
+    int32_t offset;             // Q15 DC offset added after scaling
+} WAVE_GeneratorTypeDef;
+
+// Function prototypes
+void WAVE_Init(WAVE_GeneratorTypeDef *gen, WAVE_ShapeTypeDef shape, uint32_t sample_rate_hz,
+               uint32_t freq_hz, int32_t amplitude, uint32_t phase);
+void WAVE_SetCustomTable(WAVE_GeneratorTypeDef *gen, const int16_t *table, uint8_t table_bits);
+uint32_t WAVE_SampleRate(uint32_t timer_clk_hz, uint32_t prescaler, uint32_t period);
+uint32_t WAVE_PhaseStep(uint32_t sample_rate_hz, uint32_t freq_hz);
+uint32_t WAVE_ActualMilliHz(uint32_t sample_rate_hz, uint32_t phase_step);
+int32_t WAVE_Sample(const WAVE_GeneratorTypeDef *gen, uint32_t phase);
+void WAVE_Fill(WAVE_GeneratorTypeDef *gen, uint32_t *dst, uint32_t count, uint32_t period);
+
+#endif /* WAVEGEN_H */
@@ -21,7 +21,11 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "pwm_control.h"
+#include "wave_output.h"
+#include "motor_control.h"
+#include <stdio.h>
+#include <string.h>
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -31,7 +35,11 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-
+#define STEP_DURATION_MS  3000    // Time spent on each demo waveform
+#define CARRIER_HZ        100000  // PWM carrier = DMA sample rate (RC filter well below)
+#define WAVE_HZ           1       // Slow enough to see on LD2
+#define MOTOR_COUNTS_PER_REV  4000    // 1000-line encoder, 4x decoding
+#define MOTOR_FULL_SPEED_CPS  200000  // Speed at 100 % duty (3000 rpm), used for feed-forward
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -45,7 +53,18 @@ TIM_HandleTypeDef htim2;
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
-
+PWM_HandleTypeDef pwm_led;      // LD2 (PA5) on TIM2 channel 1
+WAVEOUT_HandleTypeDef wave_out;  // DMA-fed compare values for the same channel
+MOTOR_HandleTypeDef motor;       // Encoder on TIM3, driver PWM on TIM4, loop on TIM10
+
+// Motor speed set with each demo waveform (rpm)
+static const int32_t motor_steps[4] = { 600, 1800, -900, 0 };
+
+// Custom waveform: heartbeat-like double pulse, 16 Q15 entries
+static const int16_t heartbeat_table[16] = {
+  -32767, -32767, 32767, -8000, 20000, -32767, -32767, -32767,
+  -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+};
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -54,7 +73,7 @@ static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_TIM2_Init(void);
 /* USER CODE BEGIN PFP */
-
+static void ReportMotor(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -94,13 +113,49 @@ int main(void)
   MX_USART2_UART_Init();
   MX_TIM2_Init();
   /* USER CODE BEGIN 2 */
-  HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_1);
+  PWM_Init(&pwm_led, &htim2, TIM_CHANNEL_1);
+  PWM_Set(&pwm_led, CARRIER_HZ, PWMCALC_DUTY_Q16_ONE / 2U);
+  WAVEOUT_Init(&wave_out, &htim2, pwm_led.timer_clk_hz);
+
+  WAVE_GeneratorTypeDef gen;
+  WAVE_Init(&gen, WAVE_SINE, wave_out.sample_rate_hz, WAVE_HZ, WAVE_AMPLITUDE_ONE, WAVE_PHASE_DEG(270));
+  WAVEOUT_Start(&wave_out, &gen);
+
+  // Speed loop: gains tuned on a first-order model (tau = 50 ms, full speed 3000 rpm)
+  MOTOR_Init(&motor, MOTOR_COUNTS_PER_REV);
+  PIDQ16_SetGains(&motor.pid, PIDQ16_GAIN(0.5), PIDQ16_GAIN(10.0), PIDQ16_GAIN(0.0005), MOTOR_LOOP_HZ);
+  PIDQ16_SetDerivativeFilter(&motor.pid, 200, MOTOR_LOOP_HZ);
+  PIDQ16_SetFeedForward(&motor.pid, (int32_t)((PWMCALC_DUTY_Q16_ONE << 16) / MOTOR_FULL_SPEED_CPS), 2000);
+  MOTOR_SetSpeedRpm(&motor, motor_steps[0]);
+  MOTOR_Start(&motor);
+  uint32_t step = 0;
   /* USER CODE END 2 */
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   while (1)
   {
+    // New waveforms swap in at the next half-buffer boundary, without a gap
+    HAL_Delay(STEP_DURATION_MS);
+    ReportMotor();
+    step = (step + 1U) % 4U;
+    MOTOR_SetSpeedRpm(&motor, motor_steps[step]);
+    switch (step) {
+      case 0:
+        WAVE_Init(&gen, WAVE_SINE, wave_out.sample_rate_hz, WAVE_HZ, WAVE_AMPLITUDE_ONE, WAVE_PHASE_DEG(270));
+        break;
+      case 1:
+        WAVE_Init(&gen, WAVE_TRIANGLE, wave_out.sample_rate_hz, WAVE_HZ, WAVE_AMPLITUDE_ONE / 2, 0);
+        break;
+      case 2:
+        WAVE_Init(&gen, WAVE_CUSTOM, wave_out.sample_rate_hz, WAVE_HZ, WAVE_AMPLITUDE_ONE, 0);
+        WAVE_SetCustomTable(&gen, heartbeat_table, 4);
+        break;
+      default:
+        WAVE_Init(&gen, WAVE_SAWTOOTH, wave_out.sample_rate_hz, 2 * WAVE_HZ, WAVE_AMPLITUDE_ONE, 0);
+        break;
+    }
+    WAVEOUT_Queue(&wave_out, &gen);
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -276,7 +331,44 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Print the motor setpoint, measured speed and duty over USART2
+  * @retval None
+  */
+static void ReportMotor(void)
+{
+  char msg[80];
+  int32_t setpoint_rpm = (int32_t)(((int64_t)motor.setpoint_cps * 60) / motor.counts_per_rev);
+  int32_t duty_permille = (int32_t)(((int64_t)motor.duty_q16 * 1000) / (int32_t)PWMCALC_DUTY_Q16_ONE);
+
+  snprintf(msg, sizeof(msg), "Motor: set %ld rpm, speed %ld rpm, duty %ld/1000\r\n",
+           (long)setpoint_rpm, (long)MOTOR_GetSpeedRpm(&motor), (long)duty_permille);
+  HAL_UART_Transmit(&huart2, (uint8_t*)msg, strlen(msg), HAL_MAX_DELAY);
+}
 
+/**
+  * @brief  DMA half-transfer on a PWM channel: refill the played half
+  * @param  htim: TIM handle
+  * @retval None
+  */
+void HAL_TIM_PWM_PulseFinishedHalfCpltCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM2) {
+    WAVEOUT_HalfCpltHandler(&wave_out);
+  }
+}
+
+/**
+  * @brief  DMA transfer complete on a PWM channel: refill the played half
+  * @param  htim: TIM handle
+  * @retval None
+  */
+void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM2) {
+    WAVEOUT_CpltHandler(&wave_out);
+  }
+}
 /* USER CODE END 4 */
 
 /**
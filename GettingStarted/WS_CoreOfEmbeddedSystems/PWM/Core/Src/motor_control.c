@@ -0,0 +1,248 @@
+#include "motor_control.h"
+#include "ram_func.h"
+#include <string.h>
+
+/**
+ * @brief Configure the encoder, driver PWM and direction pins
+ */
+static void MOTOR_GpioInit(void)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+
+    // Encoder outputs are often open collector
+    gpio.Pin = MOTOR_ENC_PINS;
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_PULLUP;
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    gpio.Alternate = MOTOR_ENC_AF;
+    HAL_GPIO_Init(MOTOR_ENC_PORT, &gpio);
+
+    gpio.Pin = MOTOR_PWM_PIN;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Alternate = MOTOR_PWM_AF;
+    HAL_GPIO_Init(MOTOR_PWM_PORT, &gpio);
+
+    HAL_GPIO_WritePin(MOTOR_DIR_PORT, MOTOR_DIR_PIN, GPIO_PIN_RESET);
+    gpio.Pin = MOTOR_DIR_PIN;
+    gpio.Mode = GPIO_MODE_OUTPUT_PP;
+    gpio.Alternate = 0;
+    HAL_GPIO_Init(MOTOR_DIR_PORT, &gpio);
+}
+
+/**
+ * @brief Configure the three timers used by the controller
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ * @retval MOTOR_StatusTypeDef: Operation status
+ */
+static MOTOR_StatusTypeDef MOTOR_TimerInit(MOTOR_HandleTypeDef *motor)
+{
+    TIM_Encoder_InitTypeDef enc = {0};
+    TIM_OC_InitTypeDef oc = {0};
+
+    __HAL_RCC_TIM3_CLK_ENABLE();
+    __HAL_RCC_TIM4_CLK_ENABLE();
+    __HAL_RCC_TIM10_CLK_ENABLE();
+
+    // Encoder: 4x quadrature decoding on a free-running 16-bit counter
+    motor->htim_enc.Instance = MOTOR_ENC_TIM;
+    motor->htim_enc.Init.Prescaler = 0;
+    motor->htim_enc.Init.CounterMode = TIM_COUNTERMODE_UP;
+    motor->htim_enc.Init.Period = 0xFFFF;
+    motor->htim_enc.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    enc.EncoderMode = TIM_ENCODERMODE_TI12;
+    enc.IC1Polarity = TIM_ICPOLARITY_RISING;
+    enc.IC1Selection = TIM_ICSELECTION_DIRECTTI;
+    enc.IC1Filter = MOTOR_ENC_FILTER;
+    enc.IC2Polarity = TIM_ICPOLARITY_RISING;
+    enc.IC2Selection = TIM_ICSELECTION_DIRECTTI;
+    enc.IC2Filter = MOTOR_ENC_FILTER;
+    if (HAL_TIM_Encoder_Init(&motor->htim_enc, &enc) != HAL_OK) {
+        return MOTOR_ERROR;
+    }
+
+    // Driver PWM: frequency is set through the PWM control module afterwards
+    motor->htim_pwm.Instance = MOTOR_PWM_TIM;
+    motor->htim_pwm.Init.Prescaler = 0;
+    motor->htim_pwm.Init.CounterMode = TIM_COUNTERMODE_UP;
+    motor->htim_pwm.Init.Period = 0xFFFF;
+    motor->htim_pwm.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    motor->htim_pwm.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    if (HAL_TIM_PWM_Init(&motor->htim_pwm) != HAL_OK) {
+        return MOTOR_ERROR;
+    }
+    oc.OCMode = TIM_OCMODE_PWM1;
+    oc.Pulse = 0;
+    oc.OCPolarity = TIM_OCPOLARITY_HIGH;
+    oc.OCFastMode = TIM_OCFAST_DISABLE;
+    if (HAL_TIM_PWM_ConfigChannel(&motor->htim_pwm, &oc, MOTOR_PWM_CHANNEL) != HAL_OK) {
+        return MOTOR_ERROR;
+    }
+
+    // Control loop: one update event per sample period
+    motor->htim_loop.Instance = MOTOR_LOOP_TIM;
+    motor->htim_loop.Init.Prescaler = 0;
+    motor->htim_loop.Init.CounterMode = TIM_COUNTERMODE_UP;
+    motor->htim_loop.Init.Period = PWM_GetTimerClock(&motor->htim_loop) / MOTOR_LOOP_HZ - 1U;
+    motor->htim_loop.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    motor->htim_loop.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    if (HAL_TIM_Base_Init(&motor->htim_loop) != HAL_OK) {
+        return MOTOR_ERROR;
+    }
+
+    return MOTOR_OK;
+}
+
+/**
+ * @brief Initialize the speed controller hardware
+ * @note  The PID gains are left at zero: configure motor->pid with
+ *        PIDQ16_SetGains and friends (rate MOTOR_LOOP_HZ) before starting.
+ *        PID input is counts/s, output is the signed duty in Q16
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ * @param counts_per_rev: Encoder counts per revolution (4x the line count)
+ * @retval MOTOR_StatusTypeDef: Operation status
+ */
+MOTOR_StatusTypeDef MOTOR_Init(MOTOR_HandleTypeDef *motor, int32_t counts_per_rev)
+{
+    if (motor == NULL || counts_per_rev <= 0) {
+        return MOTOR_ERROR;
+    }
+
+    memset(motor, 0, sizeof(*motor));
+    motor->counts_per_rev = counts_per_rev;
+
+    MOTOR_GpioInit();
+    if (MOTOR_TimerInit(motor) != MOTOR_OK) {
+        return MOTOR_ERROR;
+    }
+
+    if (PWM_Init(&motor->pwm, &motor->htim_pwm, MOTOR_PWM_CHANNEL) != PWM_OK ||
+        PWM_Set(&motor->pwm, MOTOR_PWM_HZ, 0) != PWM_OK) {
+        return MOTOR_ERROR;
+    }
+
+    PIDQ16_Init(&motor->pid, -(int32_t)PWMCALC_DUTY_Q16_ONE, (int32_t)PWMCALC_DUTY_Q16_ONE);
+
+    HAL_NVIC_SetPriority(MOTOR_LOOP_IRQn, MOTOR_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(MOTOR_LOOP_IRQn);
+
+    return MOTOR_OK;
+}
+
+/**
+ * @brief Start the encoder, the driver PWM and the control loop
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ * @retval MOTOR_StatusTypeDef: Operation status
+ */
+MOTOR_StatusTypeDef MOTOR_Start(MOTOR_HandleTypeDef *motor)
+{
+    if (motor == NULL) {
+        return MOTOR_ERROR;
+    }
+
+    if (HAL_TIM_Encoder_Start(&motor->htim_enc, TIM_CHANNEL_ALL) != HAL_OK ||
+        HAL_TIM_PWM_Start(&motor->htim_pwm, MOTOR_PWM_CHANNEL) != HAL_OK) {
+        return MOTOR_ERROR;
+    }
+
+    // Start from a standing speed estimate
+    uint16_t count = (uint16_t)__HAL_TIM_GET_COUNTER(&motor->htim_enc);
+    for (uint32_t i = 0; i < MOTOR_SPEED_TAPS; i++) {
+        motor->count_hist[i] = count;
+    }
+    motor->hist_pos = 0;
+    PIDQ16_Reset(&motor->pid);
+
+    if (HAL_TIM_Base_Start_IT(&motor->htim_loop) != HAL_OK) {
+        return MOTOR_ERROR;
+    }
+
+    return MOTOR_OK;
+}
+
+/**
+ * @brief Stop the control loop and switch the driver off
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ * @retval MOTOR_StatusTypeDef: Operation status
+ */
+MOTOR_StatusTypeDef MOTOR_Stop(MOTOR_HandleTypeDef *motor)
+{
+    if (motor == NULL) {
+        return MOTOR_ERROR;
+    }
+
+    HAL_TIM_Base_Stop_IT(&motor->htim_loop);
+    PWM_SetDutyQ16(&motor->pwm, 0);
+    motor->duty_q16 = 0;
+    motor->setpoint_cps = 0;
+
+    return MOTOR_OK;
+}
+
+/**
+ * @brief Set the requested speed
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ * @param rpm: Speed in revolutions per minute (negative = reverse)
+ */
+void MOTOR_SetSpeedRpm(MOTOR_HandleTypeDef *motor, int32_t rpm)
+{
+    if (motor == NULL) {
+        return;
+    }
+
+    // A single aligned word store: safe against the control interrupt
+    motor->setpoint_cps = (int32_t)(((int64_t)rpm * motor->counts_per_rev) / 60);
+}
+
+/**
+ * @brief Get the measured speed
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ * @retval int32_t: Speed in revolutions per minute
+ */
+int32_t MOTOR_GetSpeedRpm(const MOTOR_HandleTypeDef *motor)
+{
+    if (motor == NULL) {
+        return 0;
+    }
+
+    return (int32_t)(((int64_t)motor->speed_cps * 60) / motor->counts_per_rev);
+}
+
+/**
+ * @brief Control loop interrupt: measure, run the PID, update the duty
+ * @note  Call from TIM1_UP_TIM10_IRQHandler. Integer only. The 16-bit
+ *        count difference is exact across counter wraps as long as the
+ *        motor moves less than 32768 counts per speed window
+ * @param motor: Pointer to MOTOR_HandleTypeDef structure
+ */
+RAM_FUNC void MOTOR_IRQHandler(MOTOR_HandleTypeDef *motor)
+{
+    if (__HAL_TIM_GET_FLAG(&motor->htim_loop, TIM_FLAG_UPDATE) == RESET) {
+        return;
+    }
+    __HAL_TIM_CLEAR_FLAG(&motor->htim_loop, TIM_FLAG_UPDATE);
+
+    uint16_t count = (uint16_t)motor->htim_enc.Instance->CNT;
+    uint16_t oldest = motor->count_hist[motor->hist_pos];
+    motor->count_hist[motor->hist_pos] = count;
+    motor->hist_pos = (motor->hist_pos + 1U) & (MOTOR_SPEED_TAPS - 1U);
+
+    int32_t delta = (int16_t)(uint16_t)(count - oldest);
+    int32_t speed = delta * MOTOR_LOOP_HZ / MOTOR_SPEED_TAPS;
+    int32_t duty = PIDQ16_Update(&motor->pid, motor->setpoint_cps, speed);
+
+    // Sign selects the bridge direction, magnitude the PWM duty
+    if (duty < 0) {
+        MOTOR_DIR_PORT->BSRR = MOTOR_DIR_PIN;
+        PWM_SetDutyQ16(&motor->pwm, (uint32_t)(-duty));
+    } else {
+        MOTOR_DIR_PORT->BSRR = (uint32_t)MOTOR_DIR_PIN << 16;
+        PWM_SetDutyQ16(&motor->pwm, (uint32_t)duty);
+    }
+
+    motor->speed_cps = speed;
+    motor->duty_q16 = duty;
+    motor->ticks++;
+}
@@ -0,0 +1,213 @@
+#include "pid_q16.h"
+#include "ram_func.h"
+#include <stddef.h>
+
+/**
+ * @brief Clamp a 64-bit value to the int32_t range
+ * @param x: Value to clamp
+ * @retval int32_t: Saturated value
+ */
+static inline int32_t PIDQ16_Sat32(int64_t x)
+{
+    if (x > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (x < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)x;
+}
+
+/**
+ * @brief Initialize a PID controller with zero gains and no derivative filter
+ * @param pid: Pointer to PIDQ16_HandleTypeDef structure
+ * @param out_min: Lowest output value
+ * @param out_max: Highest output value
+ * @retval PIDQ16_StatusTypeDef: Operation status
+ */
+PIDQ16_StatusTypeDef PIDQ16_Init(PIDQ16_HandleTypeDef *pid, int32_t out_min, int32_t out_max)
+{
+    if (pid == NULL || out_min >= out_max) {
+        return PIDQ16_ERROR;
+    }
+
+    pid->kp = 0;
+    pid->ki = 0;
+    pid->kd = 0;
+    pid->kff = 0;
+    pid->ff_offset = 0;
+    pid->d_alpha = PIDQ16_ONE;
+    pid->out_min = out_min;
+    pid->out_max = out_max;
+
+    PIDQ16_Reset(pid);
+
+    return PIDQ16_OK;
+}
+
+/**
+ * @brief Set the PID gains in continuous-time form
+ * @note  Converted once here to per-sample gains (ki * Ts, kd / Ts) so the
+ *        update itself needs no division
+ * @param pid: Pointer to PIDQ16_HandleTypeDef structure
+ * @param kp: Proportional gain (Q16)
+ * @param ki: Integral gain in 1/s (Q16)
+ * @param kd: Derivative gain in s (Q16)
+ * @param rate_hz: Rate at which PIDQ16_Update is called
+ * @retval PIDQ16_StatusTypeDef: Operation status
+ */
+PIDQ16_StatusTypeDef PIDQ16_SetGains(PIDQ16_HandleTypeDef *pid, int32_t kp, int32_t ki,
+                                     int32_t kd, uint32_t rate_hz)
+{
+    if (pid == NULL || rate_hz == 0U) {
+        return PIDQ16_ERROR;
+    }
+
+    int64_t ki_step = (int64_t)ki / (int64_t)rate_hz;
+
+    // Keep a non-zero integral gain from rounding to nothing at high rates
+    if (ki_step == 0 && ki != 0) {
+        ki_step = (ki > 0) ? 1 : -1;
+    }
+
+    pid->kp = kp;
+    pid->ki = (int32_t)ki_step;
+    pid->kd = PIDQ16_Sat32((int64_t)kd * (int64_t)rate_hz);
+
+    return PIDQ16_OK;
+}
+
+/**
+ * @brief Set the feed-forward path
+ * @note  The output gets kff * setpoint plus the offset (e.g. the duty that
+ *        overcomes static friction), signed like the setpoint
+ * @param pid: Pointer to PIDQ16_HandleTypeDef structure
+ * @param kff: Setpoint feed-forward gain (Q16)
+ * @param offset: Offset in output units, applied for a non-zero setpoint
+ * @retval PIDQ16_StatusTypeDef: Operation status
+ */
+PIDQ16_StatusTypeDef PIDQ16_SetFeedForward(PIDQ16_HandleTypeDef *pid, int32_t kff, int32_t offset)
+{
+    if (pid == NULL || offset < 0) {
+        return PIDQ16_ERROR;
+    }
+
+    pid->kff = kff;
+    pid->ff_offset = offset;
+
+    return PIDQ16_OK;
+}
+
+/**
+ * @brief Set the first-order low-pass filter of the derivative term
+ * @note  alpha = w / (fs + w) with w = 2*pi*fc, computed in integers;
+ *        a cutoff of 0 disables the filter
+ * @param pid: Pointer to PIDQ16_HandleTypeDef structure
+ * @param cutoff_hz: Filter cutoff frequency in Hz
+ * @param rate_hz: Rate at which PIDQ16_Update is called
+ * @retval PIDQ16_StatusTypeDef: Operation status
+ */
+PIDQ16_StatusTypeDef PIDQ16_SetDerivativeFilter(PIDQ16_HandleTypeDef *pid, uint32_t cutoff_hz,
+                                                uint32_t rate_hz)
+{
+    if (pid == NULL || rate_hz == 0U) {
+        return PIDQ16_ERROR;
+    }
+
+    if (cutoff_hz == 0U) {
+        pid->d_alpha = PIDQ16_ONE;
+        return PIDQ16_OK;
+    }
+
+    uint64_t w = (uint64_t)cutoff_hz * PIDQ16_TWO_PI;          // rad/s in Q16
+    uint64_t fs = (uint64_t)rate_hz << 16;                      // Hz in Q16
+    uint64_t alpha = (w << 16) / (fs + w);
+
+    pid->d_alpha = (alpha == 0U) ? 1 : (int32_t)alpha;
+
+    return PIDQ16_OK;
+}
+
+/**
+ * @brief Clear the controller state, keeping gains and limits
+ * @param pid: Pointer to PIDQ16_HandleTypeDef structure
+ */
+void PIDQ16_Reset(PIDQ16_HandleTypeDef *pid)
+{
+    if (pid == NULL) {
+        return;
+    }
+
+    pid->integ = 0;
+    pid->d_filt = 0;
+    pid->prev_meas = 0;
+    pid->output = 0;
+    pid->saturated = 0;
+    pid->primed = 0;
+}
+
+/**
+ * @brief Run one controller sample
+ * @note  Integer only, constant time: safe for high-rate control interrupts.
+ *        The derivative acts on the measurement (no kick on setpoint steps)
+ *        and is low-pass filtered. Anti-windup: the integrator stops while
+ *        the output is saturated in the direction of the error and is
+ *        itself bounded by the output limits. Runs from SRAM (RAM_FUNC)
+ * @param pid: Pointer to PIDQ16_HandleTypeDef structure
+ * @param setpoint: Requested value (input units)
+ * @param measurement: Measured value (input units)
+ * @retval int32_t: Output, clamped to [out_min, out_max]
+ */
+RAM_FUNC int32_t PIDQ16_Update(PIDQ16_HandleTypeDef *pid, int32_t setpoint, int32_t measurement)
+{
+    const int64_t hi = (int64_t)pid->out_max << 16;
+    const int64_t lo = (int64_t)pid->out_min << 16;
+    int64_t err = (int64_t)setpoint - measurement;
+
+    if (!pid->primed) {
+        pid->prev_meas = measurement;
+        pid->primed = 1;
+    }
+
+    // Proportional and feed-forward terms (Q16 output units)
+    int64_t p = (int64_t)pid->kp * err;
+    int64_t ff = (int64_t)pid->kff * setpoint;
+    if (setpoint > 0) {
+        ff += (int64_t)pid->ff_offset << 16;
+    } else if (setpoint < 0) {
+        ff -= (int64_t)pid->ff_offset << 16;
+    }
+
+    // Filtered derivative on measurement
+    int64_t d_raw = -(int64_t)pid->kd * ((int64_t)measurement - pid->prev_meas);
+    pid->d_filt += ((d_raw - pid->d_filt) * pid->d_alpha) >> 16;
+    pid->prev_meas = measurement;
+
+    // Conditional integration
+    int64_t integ = pid->integ + (int64_t)pid->ki * err;
+    if (integ > hi) {
+        integ = hi;
+    } else if (integ < lo) {
+        integ = lo;
+    }
+
+    int64_t u = p + integ + pid->d_filt + ff;
+    if ((u > hi && err > 0) || (u < lo && err < 0)) {
+        integ = pid->integ;
+        u = p + integ + pid->d_filt + ff;
+    }
+    pid->integ = integ;
+
+    pid->saturated = 1;
+    if (u > hi) {
+        u = hi;
+    } else if (u < lo) {
+        u = lo;
+    } else {
+        pid->saturated = 0;
+    }
+
+    pid->output = (int32_t)((u + 0x8000) >> 16);
+
+    return pid->output;
+}
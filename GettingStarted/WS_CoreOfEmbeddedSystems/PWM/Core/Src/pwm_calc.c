@@ -0,0 +1,107 @@
+#include "pwm_calc.h"
+#include <stddef.h>
+
+/**
+ * @brief Compute the prescaler/auto-reload pair for a PWM frequency
+ * @note  The smallest prescaler that fits the period in ARR is chosen, which
+ *        gives the finest duty resolution; the period is then rounded to the
+ *        nearest count so the frequency error is at most half a count
+ * @param timer_clk_hz: Timer kernel clock in Hz
+ * @param freq_hz: Requested PWM frequency in Hz
+ * @param arr_max: Largest auto-reload value of the timer
+ * @param timing: Pointer to the settings to fill
+ * @retval PWMCALC_StatusTypeDef: Computation status
+ */
+PWMCALC_StatusTypeDef PWMCALC_Compute(uint32_t timer_clk_hz, uint32_t freq_hz,
+                                      uint32_t arr_max, PWMCALC_TimingTypeDef *timing)
+{
+    if (timing == NULL || timer_clk_hz == 0U || freq_hz == 0U || arr_max == 0U) {
+        return PWMCALC_ERROR;
+    }
+
+    uint64_t counts_max = (uint64_t)arr_max + 1U;
+    uint64_t total = ((uint64_t)timer_clk_hz + freq_hz / 2U) / freq_hz;
+
+    if (total < 2U) {
+        return PWMCALC_TOO_HIGH;
+    }
+
+    // Smallest divider that keeps the period inside ARR
+    uint64_t div = (total + counts_max - 1U) / counts_max;
+    uint64_t counts;
+
+    for (;;) {
+        if (div > PWMCALC_PSC_MAX + 1U) {
+            return PWMCALC_TOO_LOW;
+        }
+
+        uint64_t step = div * freq_hz;
+        counts = ((uint64_t)timer_clk_hz + step / 2U) / step;
+
+        // Rounding up can overflow ARR by one count: use the next divider
+        if (counts <= counts_max) {
+            break;
+        }
+        div++;
+    }
+
+    if (counts < 2U) {
+        return PWMCALC_TOO_HIGH;
+    }
+
+    uint64_t ticks = div * counts;
+
+    timing->prescaler = (uint32_t)(div - 1U);
+    timing->period = (uint32_t)(counts - 1U);
+    timing->actual_hz = (uint32_t)(((uint64_t)timer_clk_hz + ticks / 2U) / ticks);
+    timing->error_ppm = (int32_t)(((int64_t)timer_clk_hz * 1000000 / (int64_t)ticks
+                                   - (int64_t)freq_hz * 1000000) / (int64_t)freq_hz);
+
+    return PWMCALC_OK;
+}
+
+/**
+ * @brief Compute the compare value for a duty cycle in per-mille
+ * @param period: Auto-reload value (ARR)
+ * @param permille: Duty cycle, 0..1000 (values above 1000 saturate)
+ * @retval uint32_t: Compare value for TIMx->CCRy
+ */
+uint32_t PWMCALC_PulseFromPermille(uint32_t period, uint16_t permille)
+{
+    return PWMCALC_PulseFromQ16(period, PWMCALC_PermilleToQ16(permille));
+}
+
+/**
+ * @brief Compute the compare value for a duty cycle in Q16
+ * @note  In PWM mode 1 the output is high while CNT < CCR, so a compare
+ *        value of ARR + 1 gives a constant high level (100 %)
+ * @param period: Auto-reload value (ARR)
+ * @param duty_q16: Duty cycle, 0..PWMCALC_DUTY_Q16_ONE (saturated)
+ * @retval uint32_t: Compare value for TIMx->CCRy
+ */
+uint32_t PWMCALC_PulseFromQ16(uint32_t period, uint32_t duty_q16)
+{
+    if (duty_q16 > PWMCALC_DUTY_Q16_ONE) {
+        duty_q16 = PWMCALC_DUTY_Q16_ONE;
+    }
+
+    uint64_t counts = (uint64_t)period + 1U;
+    uint64_t pulse = (counts * duty_q16 + PWMCALC_DUTY_Q16_ONE / 2U) >> 16;
+
+    // CCR is 32-bit on TIM2/TIM5: 100 % of a full 32-bit period cannot be encoded
+    return (pulse > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)pulse;
+}
+
+/**
+ * @brief Convert a per-mille duty cycle to Q16
+ * @param permille: Duty cycle, 0..1000 (values above 1000 saturate)
+ * @retval uint32_t: Duty cycle in Q16, rounded to nearest
+ */
+uint32_t PWMCALC_PermilleToQ16(uint16_t permille)
+{
+    if (permille > 1000U) {
+        permille = 1000U;
+    }
+
+    return ((uint32_t)permille * PWMCALC_DUTY_Q16_ONE + 500U) / 1000U;
+}
@@ -0,0 +1,184 @@
+#include "pwm_control.h"
+
+/**
+ * @brief Program PSC, ARR and CCR so they take effect together
+ * @note  ARR and CCR are preloaded (ARPE/OCxPE) and PSC always is; UDIS
+ *        blocks the update event while the three registers are written, so
+ *        the running period completes with the old values and the next
+ *        update event latches the complete new set: no truncated or skipped
+ *        cycle, no mix of old and new settings. A stopped counter has no
+ *        update event coming, so one is forced with UG; URS keeps it from
+ *        raising UIF, an interrupt or a DMA request
+ * @param pwm: Pointer to PWM_HandleTypeDef structure
+ * @param timing: New timer settings
+ * @param pulse: New compare value
+ */
+static void PWM_Apply(PWM_HandleTypeDef *pwm, const PWMCALC_TimingTypeDef *timing, uint32_t pulse)
+{
+    TIM_TypeDef *tim = pwm->htim->Instance;
+    uint32_t cr1 = tim->CR1;
+
+    SET_BIT(tim->CR1, TIM_CR1_UDIS);
+
+    tim->PSC = timing->prescaler;
+    tim->ARR = timing->period;
+    __HAL_TIM_SET_COMPARE(pwm->htim, pwm->channel, pulse);
+
+    if ((cr1 & TIM_CR1_CEN) == 0U) {
+        // Latch now: otherwise the first period still runs on the old shadow PSC/ARR
+        tim->CR1 = (cr1 & ~TIM_CR1_UDIS) | TIM_CR1_URS;
+        tim->EGR = TIM_EGR_UG;
+    }
+
+    tim->CR1 = cr1 & ~TIM_CR1_UDIS;
+
+    pwm->htim->Init.Prescaler = timing->prescaler;
+    pwm->htim->Init.Period = timing->period;
+    pwm->timing = *timing;
+}
+
+/**
+ * @brief Get the kernel clock of a timer
+ * @note  APB timers run at twice the bus clock when the APB prescaler is not 1
+ * @param htim: Pointer to timer handle
+ * @retval uint32_t: Timer clock in Hz
+ */
+uint32_t PWM_GetTimerClock(TIM_HandleTypeDef *htim)
+{
+    uint32_t pclk;
+    uint32_t apb_div1;
+
+    if (htim->Instance == TIM1 || htim->Instance == TIM9 ||
+        htim->Instance == TIM10 || htim->Instance == TIM11) {
+        pclk = HAL_RCC_GetPCLK2Freq();
+        apb_div1 = ((RCC->CFGR & RCC_CFGR_PPRE2) == RCC_CFGR_PPRE2_DIV1);
+    } else {
+        pclk = HAL_RCC_GetPCLK1Freq();
+        apb_div1 = ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1);
+    }
+
+    return apb_div1 ? pclk : 2U * pclk;
+}
+
+/**
+ * @brief Take control of a PWM channel initialized by MX_TIMx_Init
+ * @note  Enables ARR and CCR preload; the current PSC/ARR/CCR are kept
+ * @param pwm: Pointer to PWM_HandleTypeDef structure
+ * @param htim: Pointer to timer handle
+ * @param channel: TIM_CHANNEL_x
+ * @retval PWM_StatusTypeDef: Operation status
+ */
+PWM_StatusTypeDef PWM_Init(PWM_HandleTypeDef *pwm, TIM_HandleTypeDef *htim, uint32_t channel)
+{
+    if (pwm == NULL || htim == NULL) {
+        return PWM_ERROR;
+    }
+
+    pwm->htim = htim;
+    pwm->channel = channel;
+    pwm->timer_clk_hz = PWM_GetTimerClock(htim);
+    pwm->arr_max = IS_TIM_32B_COUNTER_INSTANCE(htim->Instance) ? PWMCALC_ARR_MAX_32B
+                                                               : PWMCALC_ARR_MAX_16B;
+
+    // Buffer ARR and CCRy writes until the next update event
+    htim->Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    SET_BIT(htim->Instance->CR1, TIM_CR1_ARPE);
+    switch (channel) {
+        case TIM_CHANNEL_1: SET_BIT(htim->Instance->CCMR1, TIM_CCMR1_OC1PE); break;
+        case TIM_CHANNEL_2: SET_BIT(htim->Instance->CCMR1, TIM_CCMR1_OC2PE); break;
+        case TIM_CHANNEL_3: SET_BIT(htim->Instance->CCMR2, TIM_CCMR2_OC3PE); break;
+        case TIM_CHANNEL_4: SET_BIT(htim->Instance->CCMR2, TIM_CCMR2_OC4PE); break;
+        default: return PWM_ERROR;
+    }
+
+    // Describe what MX_TIMx_Init programmed
+    uint32_t psc = htim->Instance->PSC;
+    uint32_t arr = htim->Instance->ARR;
+    uint64_t ticks = ((uint64_t)psc + 1U) * ((uint64_t)arr + 1U);
+    uint64_t counts = (uint64_t)arr + 1U;
+
+    pwm->timing.prescaler = psc;
+    pwm->timing.period = arr;
+    pwm->timing.actual_hz = (uint32_t)((pwm->timer_clk_hz + ticks / 2U) / ticks);
+    pwm->timing.error_ppm = 0;
+    pwm->freq_hz = pwm->timing.actual_hz;
+    pwm->duty_q16 = (uint32_t)(((uint64_t)__HAL_TIM_GET_COMPARE(htim, channel) << 16) / counts);
+
+    return PWM_OK;
+}
+
+/**
+ * @brief Set frequency and duty cycle in one glitch-free update
+ * @param pwm: Pointer to PWM_HandleTypeDef structure
+ * @param freq_hz: PWM frequency in Hz
+ * @param duty_q16: Duty cycle, 0..PWMCALC_DUTY_Q16_ONE
+ * @retval PWM_StatusTypeDef: Operation status
+ */
+PWM_StatusTypeDef PWM_Set(PWM_HandleTypeDef *pwm, uint32_t freq_hz, uint32_t duty_q16)
+{
+    if (pwm == NULL) {
+        return PWM_ERROR;
+    }
+
+    PWMCALC_TimingTypeDef timing;
+    PWMCALC_StatusTypeDef status = PWMCALC_Compute(pwm->timer_clk_hz, freq_hz, pwm->arr_max, &timing);
+
+    if (status == PWMCALC_ERROR) {
+        return PWM_ERROR;
+    }
+    if (status != PWMCALC_OK) {
+        return PWM_RANGE;
+    }
+
+    pwm->freq_hz = freq_hz;
+    pwm->duty_q16 = duty_q16;
+    PWM_Apply(pwm, &timing, PWMCALC_PulseFromQ16(timing.period, duty_q16));
+
+    return PWM_OK;
+}
+
+/**
+ * @brief Change the frequency, keeping the duty cycle ratio
+ * @param pwm: Pointer to PWM_HandleTypeDef structure
+ * @param freq_hz: PWM frequency in Hz
+ * @retval PWM_StatusTypeDef: Operation status
+ */
+PWM_StatusTypeDef PWM_SetFrequency(PWM_HandleTypeDef *pwm, uint32_t freq_hz)
+{
+    if (pwm == NULL) {
+        return PWM_ERROR;
+    }
+
+    return PWM_Set(pwm, freq_hz, pwm->duty_q16);
+}
+
+/**
+ * @brief Change the duty cycle (Q16), keeping the frequency
+ * @note  Only CCRy is written; it is latched at the next update event
+ * @param pwm: Pointer to PWM_HandleTypeDef structure
+ * @param duty_q16: Duty cycle, 0..PWMCALC_DUTY_Q16_ONE
+ * @retval PWM_StatusTypeDef: Operation status
+ */
+PWM_StatusTypeDef PWM_SetDutyQ16(PWM_HandleTypeDef *pwm, uint32_t duty_q16)
+{
+    if (pwm == NULL) {
+        return PWM_ERROR;
+    }
+
+    pwm->duty_q16 = duty_q16;
+    __HAL_TIM_SET_COMPARE(pwm->htim, pwm->channel,
+                          PWMCALC_PulseFromQ16(pwm->timing.period, duty_q16));
+
+    return PWM_OK;
+}
+
+/**
+ * @brief Change the duty cycle (per-mille), keeping the frequency
+ * @param pwm: Pointer to PWM_HandleTypeDef structure
+ * @param permille: Duty cycle, 0..1000
+ * @retval PWM_StatusTypeDef: Operation status
+ */
+PWM_StatusTypeDef PWM_SetDutyPermille(PWM_HandleTypeDef *pwm, uint16_t permille)
+{
+    return PWM_SetDutyQ16(pwm, PWMCALC_PermilleToQ16(permille));
+}
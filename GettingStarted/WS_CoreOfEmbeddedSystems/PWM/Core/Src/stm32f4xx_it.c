@@ -22,6 +22,8 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "wave_output.h"
+#include "motor_control.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,7 +59,8 @@
 /* External variables --------------------------------------------------------*/
 
 /* USER CODE BEGIN EV */
-
+extern WAVEOUT_HandleTypeDef wave_out;
+extern MOTOR_HandleTypeDef motor;
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -199,5 +202,19 @@ void SysTick_Handler(void)
 /******************************************************************************/
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles DMA1 stream5 global interrupt (TIM2_CH1 waveform).
+  */
+void DMA1_Stream5_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&wave_out.hdma);
+}
 
+/**
+  * @brief This function handles TIM1 update and TIM10 global interrupt (motor control loop).
+  */
+void TIM1_UP_TIM10_IRQHandler(void)
+{
+  MOTOR_IRQHandler(&motor);
+}
 /* USER CODE END 1 */
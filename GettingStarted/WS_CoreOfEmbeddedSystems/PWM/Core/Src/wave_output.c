@@ -0,0 +1,144 @@
+#include "wave_output.h"
+#include <string.h>
+
+/**
+ * @brief Refill one half of the DMA buffer, swapping in a queued generator
+ * @note  Runs in the DMA interrupt while the other half is being played
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ * @param half: Half to refill (0 = first, 1 = second)
+ */
+static void WAVEOUT_Refill(WAVEOUT_HandleTypeDef *wave, uint32_t half)
+{
+    if (wave->pending_valid) {
+        wave->active = wave->pending;
+        wave->pending_valid = 0;
+    }
+
+    WAVE_Fill(&wave->active, &wave->buffer[half * WAVEOUT_HALF_LEN], WAVEOUT_HALF_LEN, wave->period);
+}
+
+/**
+ * @brief Initialize the waveform output on TIM channel 1
+ * @note  The timer must already be configured for PWM (MX_TIMx_Init and,
+ *        if needed, PWM_Set to choose the carrier); the DMA stream for the
+ *        CC1 request is configured here in circular word mode
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ * @param htim: Pointer to timer handle
+ * @param timer_clk_hz: Timer kernel clock in Hz
+ * @retval WAVEOUT_StatusTypeDef: Operation status
+ */
+WAVEOUT_StatusTypeDef WAVEOUT_Init(WAVEOUT_HandleTypeDef *wave, TIM_HandleTypeDef *htim,
+                                   uint32_t timer_clk_hz)
+{
+    if (wave == NULL || htim == NULL) {
+        return WAVEOUT_ERROR;
+    }
+
+    memset(wave, 0, sizeof(*wave));
+    wave->htim = htim;
+    wave->period = htim->Instance->ARR;
+    wave->sample_rate_hz = WAVE_SampleRate(timer_clk_hz, htim->Instance->PSC, wave->period);
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    wave->hdma.Instance = WAVEOUT_DMA_STREAM;
+    wave->hdma.Init.Channel = WAVEOUT_DMA_CHANNEL;
+    wave->hdma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    wave->hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+    wave->hdma.Init.MemInc = DMA_MINC_ENABLE;
+    wave->hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    wave->hdma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    wave->hdma.Init.Mode = DMA_CIRCULAR;
+    wave->hdma.Init.Priority = DMA_PRIORITY_HIGH;
+    wave->hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&wave->hdma) != HAL_OK) {
+        return WAVEOUT_ERROR;
+    }
+
+    __HAL_LINKDMA(htim, hdma[TIM_DMA_ID_CC1], wave->hdma);
+
+    HAL_NVIC_SetPriority(WAVEOUT_DMA_IRQn, WAVEOUT_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(WAVEOUT_DMA_IRQn);
+
+    return WAVEOUT_OK;
+}
+
+/**
+ * @brief Start playing a waveform
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ * @param gen: Generator to play (copied)
+ * @retval WAVEOUT_StatusTypeDef: Operation status
+ */
+WAVEOUT_StatusTypeDef WAVEOUT_Start(WAVEOUT_HandleTypeDef *wave, const WAVE_GeneratorTypeDef *gen)
+{
+    if (wave == NULL || gen == NULL) {
+        return WAVEOUT_ERROR;
+    }
+
+    wave->active = *gen;
+    wave->pending_valid = 0;
+
+    // Prime both halves before the first DMA request
+    WAVE_Fill(&wave->active, wave->buffer, WAVEOUT_BUFFER_LEN, wave->period);
+
+    if (HAL_TIM_PWM_Start_DMA(wave->htim, TIM_CHANNEL_1, wave->buffer, WAVEOUT_BUFFER_LEN) != HAL_OK) {
+        return WAVEOUT_ERROR;
+    }
+
+    return WAVEOUT_OK;
+}
+
+/**
+ * @brief Stop the waveform output
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ * @retval WAVEOUT_StatusTypeDef: Operation status
+ */
+WAVEOUT_StatusTypeDef WAVEOUT_Stop(WAVEOUT_HandleTypeDef *wave)
+{
+    if (wave == NULL) {
+        return WAVEOUT_ERROR;
+    }
+
+    return (HAL_TIM_PWM_Stop_DMA(wave->htim, TIM_CHANNEL_1) == HAL_OK) ? WAVEOUT_OK : WAVEOUT_ERROR;
+}
+
+/**
+ * @brief Queue a new waveform without interrupting the output
+ * @note  The generator replaces the active one at the next half-buffer
+ *        refill, so the first new sample directly follows the last old one
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ * @param gen: Generator to play next (copied)
+ */
+void WAVEOUT_Queue(WAVEOUT_HandleTypeDef *wave, const WAVE_GeneratorTypeDef *gen)
+{
+    if (wave == NULL || gen == NULL) {
+        return;
+    }
+
+    // The DMA interrupt reads 'pending': keep the copy atomic
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    wave->pending = *gen;
+    wave->pending_valid = 1;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief DMA half-transfer hook: the first half has been played
+ * @note  Call from HAL_TIM_PWM_PulseFinishedHalfCpltCallback
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ */
+void WAVEOUT_HalfCpltHandler(WAVEOUT_HandleTypeDef *wave)
+{
+    WAVEOUT_Refill(wave, 0);
+}
+
+/**
+ * @brief DMA transfer-complete hook: the second half has been played
+ * @note  Call from HAL_TIM_PWM_PulseFinishedCallback
+ * @param wave: Pointer to WAVEOUT_HandleTypeDef structure
+ */
+void WAVEOUT_CpltHandler(WAVEOUT_HandleTypeDef *wave)
+{
+    WAVEOUT_Refill(wave, 1);
+}
@@ -0,0 +1,167 @@
+#include "wavegen.h"
+#include "wave_tables.h"
+#include "ram_func.h"
+#include <stddef.h>
+
+/**
+ * @brief Read a Q15 table with linear interpolation between entries
+ * @param table: Table of 2^bits entries (one period)
+ * @param bits: log2 of the table length
+ * @param phase: Phase (Q32 turns)
+ * @retval int32_t: Interpolated Q15 sample
+ */
+static inline int32_t WAVE_Interpolate(const int16_t *table, uint8_t bits, uint32_t phase)
+{
+    uint32_t mask = (1UL << bits) - 1U;
+    uint32_t idx = phase >> (32U - bits);
+    int32_t frac = (int32_t)((phase << bits) >> 16);   // 0..65535
+    int32_t a = table[idx];
+    int32_t b = table[(idx + 1U) & mask];
+
+    // b - a spans up to 65534: the product needs 64 bits (one SMULL)
+    return a + (int32_t)(((int64_t)(b - a) * frac) >> 16);
+}
+
+/**
+ * @brief Initialize a generator
+ * @param gen: Pointer to WAVE_GeneratorTypeDef structure
+ * @param shape: Waveform shape (use WAVE_SetCustomTable for WAVE_CUSTOM)
+ * @param sample_rate_hz: Output sample rate (PWM frequency)
+ * @param freq_hz: Waveform frequency
+ * @param amplitude: Q15 gain, 0..WAVE_AMPLITUDE_ONE
+ * @param phase: Start phase (Q32 turns, see WAVE_PHASE_DEG)
+ */
+void WAVE_Init(WAVE_GeneratorTypeDef *gen, WAVE_ShapeTypeDef shape, uint32_t sample_rate_hz,
+               uint32_t freq_hz, int32_t amplitude, uint32_t phase)
+{
+    if (gen == NULL) {
+        return;
+    }
+
+    gen->shape = shape;
+    gen->table = NULL;
+    gen->table_bits = 0;
+    gen->phase = phase;
+    gen->phase_step = WAVE_PhaseStep(sample_rate_hz, freq_hz);
+    gen->amplitude = amplitude;
+    gen->offset = 0;
+}
+
+/**
+ * @brief Attach a user table to a generator and select WAVE_CUSTOM
+ * @param gen: Pointer to WAVE_GeneratorTypeDef structure
+ * @param table: One period in Q15, 2^table_bits entries
+ * @param table_bits: log2 of the table length (1..16)
+ */
+void WAVE_SetCustomTable(WAVE_GeneratorTypeDef *gen, const int16_t *table, uint8_t table_bits)
+{
+    if (gen == NULL || table == NULL || table_bits == 0U || table_bits > 16U) {
+        return;
+    }
+
+    gen->shape = WAVE_CUSTOM;
+    gen->table = table;
+    gen->table_bits = table_bits;
+}
+
+/**
+ * @brief Get the DMA sample rate of a PWM output
+ * @note  One compare value is transferred per PWM period
+ * @param timer_clk_hz: Timer kernel clock in Hz
+ * @param prescaler: TIMx->PSC value
+ * @param period: TIMx->ARR value
+ * @retval uint32_t: Samples per second (rounded to nearest)
+ */
+uint32_t WAVE_SampleRate(uint32_t timer_clk_hz, uint32_t prescaler, uint32_t period)
+{
+    uint64_t ticks = ((uint64_t)prescaler + 1U) * ((uint64_t)period + 1U);
+    return (uint32_t)(((uint64_t)timer_clk_hz + ticks / 2U) / ticks);
+}
+
+/**
+ * @brief Compute the phase increment for a waveform frequency
+ * @param sample_rate_hz: Output sample rate
+ * @param freq_hz: Waveform frequency (below sample_rate_hz / 2)
+ * @retval uint32_t: Phase step (Q32 turns per sample), 0 if out of range
+ */
+uint32_t WAVE_PhaseStep(uint32_t sample_rate_hz, uint32_t freq_hz)
+{
+    if (sample_rate_hz == 0U || freq_hz >= sample_rate_hz) {
+        return 0;
+    }
+
+    return (uint32_t)((((uint64_t)freq_hz << 32) + sample_rate_hz / 2U) / sample_rate_hz);
+}
+
+/**
+ * @brief Get the frequency actually produced by a phase step
+ * @param sample_rate_hz: Output sample rate
+ * @param phase_step: Phase increment per sample
+ * @retval uint32_t: Frequency in mHz
+ */
+uint32_t WAVE_ActualMilliHz(uint32_t sample_rate_hz, uint32_t phase_step)
+{
+    // (step * rate * 1000) >> 32, split to stay inside 64 bits
+    uint64_t hz_q16 = ((uint64_t)phase_step * sample_rate_hz) >> 16;
+    return (uint32_t)((hz_q16 * 1000U + 0x8000U) >> 16);
+}
+
+/**
+ * @brief Evaluate the waveform at a phase, before gain and offset
+ * @param gen: Pointer to WAVE_GeneratorTypeDef structure
+ * @param phase: Phase (Q32 turns)
+ * @retval int32_t: Q15 sample in -32767..32767
+ */
+int32_t WAVE_Sample(const WAVE_GeneratorTypeDef *gen, uint32_t phase)
+{
+    int32_t ramp = (int32_t)(phase >> 16) - 32768;     // -32768..32767
+
+    switch (gen->shape) {
+        case WAVE_SINE:
+            return WAVE_Interpolate(WAVE_SineTable, WAVE_SINE_TABLE_BITS, phase);
+        case WAVE_TRIANGLE:
+            // Rises from -1 to +1 over the first half, falls back over the second
+            return (ramp < 0) ? 2 * ramp + 32769 : 32767 - 2 * ramp;
+        case WAVE_SAWTOOTH:
+            return (ramp < -32767) ? -32767 : ramp;
+        case WAVE_SQUARE:
+            return (phase < 0x80000000UL) ? 32767 : -32767;
+        case WAVE_CUSTOM:
+            if (gen->table != NULL) {
+                return WAVE_Interpolate(gen->table, gen->table_bits, phase);
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Produce compare values for a PWM channel and advance the phase
+ * @note  The Q15 output range -1..+1 maps to 0..period+1 (0 % .. 100 % duty)
+ *        Runs from SRAM (RAM_FUNC): it refills half a DMA buffer per interrupt
+ * @param gen: Pointer to WAVE_GeneratorTypeDef structure
+ * @param dst: Destination buffer (CCR values)
+ * @param count: Number of samples to produce
+ * @param period: TIMx->ARR value of the PWM carrier
+ */
+RAM_FUNC void WAVE_Fill(WAVE_GeneratorTypeDef *gen, uint32_t *dst, uint32_t count, uint32_t period)
+{
+    uint64_t span = (uint64_t)period + 1U;
+    uint32_t phase = gen->phase;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t y = ((WAVE_Sample(gen, phase) * gen->amplitude) >> 15) + gen->offset;
+
+        if (y > 32767) {
+            y = 32767;
+        } else if (y < -32768) {
+            y = -32768;
+        }
+
+        dst[i] = (uint32_t)(((uint64_t)(uint32_t)(y + 32768) * span + 0x8000U) >> 16);
+        phase += gen->phase_step;
+    }
+
+    gen->phase = phase;
+}
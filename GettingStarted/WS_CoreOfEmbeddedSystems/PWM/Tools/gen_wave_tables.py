@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+"""Generate the Q15 waveform tables used by the PWM waveform generator.
+
+Usage: python3 Tools/gen_wave_tables.py [output.c]
+
+Writes Core/Src/wave_tables.c by default. The file is committed so the
+project builds without Python; rerun the script (for instance as a
+CubeIDE pre-build step) after changing the table size below. The size
+must match WAVE_SINE_TABLE_BITS in Core/Inc/wave_tables.h.
+"""
+import math
+import os
+import sys
+
+SINE_TABLE_BITS = 8
+Q15_MAX = 32767
+
+
+def sine_table(bits):
+    size = 1 << bits
+    return [int(round(Q15_MAX * math.sin(2.0 * math.pi * i / size)))
+            for i in range(size)]
+
+
+def format_table(name, values, per_line=8):
+    lines = ["const int16_t %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join("%6d" % v for v in values[i:i + per_line])
+        lines.append("    %s," % chunk)
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    out = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "..", "Core", "Src", "wave_tables.c")
+
+    body = [
+        "/* Generated by Tools/gen_wave_tables.py - do not edit by hand */",
+        '#include "wave_tables.h"',
+        "",
+        "// One full sine period in Q15",
+        format_table("WAVE_SineTable", sine_table(SINE_TABLE_BITS)),
+        "",
+    ]
+
+    with open(out, "w", newline="\n") as f:
+        f.write("\n".join(body))
+
+
+if __name__ == "__main__":
+    main()
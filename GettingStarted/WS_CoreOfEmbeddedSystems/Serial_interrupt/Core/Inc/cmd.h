@@ -0,0 +1,67 @@
+#ifndef CMD_H
+#define CMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Configuration definitions
+#define CMD_MAX_ARGS        8                   // Command name included
+#define CMD_PRINTF_SIZE     96                  // Longest CMD_Printf output without reserve
+
+// Command states
+typedef enum {
+    CMD_OK = 0,         // Command executed
+    CMD_ERROR = 1,      // Command failed or bad argument value
+    CMD_UNKNOWN = 2,    // No such command
+    CMD_USAGE = 3,      // Wrong number of arguments
+    CMD_EMPTY = 4       // Blank line, nothing done
+} CMD_StatusTypeDef;
+
+// Output of the transport a command arrived on; write must not fail
+typedef void (*CMD_WriteTypeDef)(void *io, const char *data, size_t len);
+
+// Optional zero-copy output: reserve returns a transport buffer of *size
+// bytes (NULL drops the output), commit sends the first len bytes of it
+typedef char *(*CMD_ReserveTypeDef)(void *io, size_t *size);
+typedef void (*CMD_CommitTypeDef)(void *io, size_t len);
+
+typedef struct {
+    CMD_WriteTypeDef write;
+    void *io;                                   // Passed to write, reserve and commit
+    CMD_ReserveTypeDef reserve;                 // NULL: CMD_Printf formats on the stack
+    CMD_CommitTypeDef commit;
+} CMD_OutputTypeDef;
+
+// Command handler, argv[0] is the command name; argc is already checked
+typedef CMD_StatusTypeDef (*CMD_HandlerTypeDef)(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+
+// Command table entry; declare tables const so they stay in flash
+typedef struct {
+    const char *name;                           // Matched without regard to case
+    const char *usage;                          // Arguments, e.g. "<ms>"; "" if none
+    const char *help;                           // One line for "help"
+    CMD_HandlerTypeDef handler;
+    uint8_t min_args;                           // Arguments after the name
+    uint8_t max_args;
+} CMD_CommandTypeDef;
+
+typedef struct {
+    const CMD_CommandTypeDef *commands;
+    uint8_t count;
+} CMD_TableTypeDef;
+
+#define CMD_TABLE(commands) { (commands), (uint8_t)(sizeof(commands) / sizeof((commands)[0])) }
+
+// Function prototypes
+CMD_StatusTypeDef CMD_Execute(const CMD_TableTypeDef *table, char *line, const CMD_OutputTypeDef *out);
+int CMD_Tokenize(char *line, char *argv[], int max);
+uint8_t CMD_NameEquals(const char *a, const char *b);
+CMD_StatusTypeDef CMD_ParseInt(const char *arg, int32_t *value);
+CMD_StatusTypeDef CMD_ParseUint(const char *arg, uint32_t *value);
+CMD_StatusTypeDef CMD_ParseHex(const char *arg, uint32_t *value);
+CMD_StatusTypeDef CMD_ParseFloat(const char *arg, float *value);
+CMD_StatusTypeDef CMD_ParseEnum(const char *arg, const char *const names[], uint8_t count, uint8_t *index);
+void CMD_Print(const CMD_OutputTypeDef *out, const char *text);
+void CMD_Printf(const CMD_OutputTypeDef *out, const char *format, ...);
+
+#endif /* CMD_H */
@@ -0,0 +1,54 @@
+#ifndef LINE_RING_H
+#define LINE_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Configuration definitions
+#define LRING_SIZE          256                 // Bytes, power of two
+#define LRING_MASK          (LRING_SIZE - 1U)
+
+// Single-producer (UART interrupt) / single-consumer (main loop) byte ring.
+// The producer only writes head, lines and dropped; the consumer only
+// writes tail, lines_done and flushed, so neither side needs a lock or masking
+typedef struct {
+    volatile uint8_t buf[LRING_SIZE];
+    volatile uint32_t head;             // Bytes stored (free running, producer)
+    volatile uint32_t tail;             // Bytes consumed (free running, consumer)
+    volatile uint32_t lines;            // Line ends stored (producer)
+    uint32_t lines_done;                // Line ends consumed (consumer)
+    volatile uint32_t dropped;          // Bytes lost to a full ring (producer)
+    uint32_t flushed;                   // Bytes of over-long lines thrown away (consumer)
+} LRING_HandleTypeDef;
+
+/**
+ * @brief Store one received byte (interrupt side)
+ * @note  Constant time, no loop: one compare, one store, one or two counter
+ *        updates. CR and LF both end a line. A byte that does not fit is
+ *        dropped and counted; if it was a line end, that line joins the
+ *        next one
+ * @param ring: Pointer to LRING_HandleTypeDef structure
+ * @param byte: Received byte
+ */
+static inline void LRING_Put(LRING_HandleTypeDef *ring, uint8_t byte)
+{
+    uint32_t head = ring->head;
+
+    if (head - ring->tail == LRING_SIZE) {
+        ring->dropped++;
+        return;
+    }
+
+    ring->buf[head & LRING_MASK] = byte;
+    ring->head = head + 1U;             // Publish the byte before the line end
+    if (byte == '\r' || byte == '\n') {
+        ring->lines++;
+    }
+}
+
+// Function prototypes
+void LRING_Init(LRING_HandleTypeDef *ring);
+uint8_t LRING_HasLine(const LRING_HandleTypeDef *ring);
+int32_t LRING_GetLine(LRING_HandleTypeDef *ring, char *line, size_t size);
+
+#endif /* LINE_RING_H */
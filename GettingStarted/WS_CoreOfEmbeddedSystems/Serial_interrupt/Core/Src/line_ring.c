@@ -0,0 +1,74 @@
+#include "line_ring.h"
+#include <string.h>
+
+/**
+ * @brief Initialize an empty ring
+ * @note  Call before the producer interrupt is enabled
+ * @param ring: Pointer to LRING_HandleTypeDef structure
+ */
+void LRING_Init(LRING_HandleTypeDef *ring)
+{
+    memset((void *)ring, 0, sizeof(*ring));
+}
+
+/**
+ * @brief Check whether a complete line is waiting
+ * @param ring: Pointer to LRING_HandleTypeDef structure
+ * @retval uint8_t: 1 if LRING_GetLine will return a line
+ */
+uint8_t LRING_HasLine(const LRING_HandleTypeDef *ring)
+{
+    return ring->lines != ring->lines_done;
+}
+
+/**
+ * @brief Take the oldest complete line (main loop side)
+ * @note  The line end is consumed and not copied. Characters past
+ *        size - 1 are discarded; compare the result with size to detect
+ *        it. A full ring without any line end can never complete a line,
+ *        so it is emptied and counted in flushed (a scan, only in that case)
+ * @param ring: Pointer to LRING_HandleTypeDef structure
+ * @param line: Output, null-terminated
+ * @param size: Capacity of line, terminator included (at least 1)
+ * @retval int32_t: Length of the line as received, -1 if no line is complete
+ */
+int32_t LRING_GetLine(LRING_HandleTypeDef *ring, char *line, size_t size)
+{
+    uint32_t tail = ring->tail;
+    int32_t len = 0;
+
+    if (ring->lines == ring->lines_done) {
+        // A full ring is frozen (the producer only drops), so it can be
+        // scanned safely; a line end found there is still being counted
+        if (ring->head - tail == LRING_SIZE) {
+            for (uint32_t i = 0; i < LRING_SIZE; i++) {
+                if (ring->buf[i] == '\r' || ring->buf[i] == '\n') {
+                    return -1;
+                }
+            }
+            ring->flushed += LRING_SIZE;
+            ring->tail = tail + LRING_SIZE;
+        }
+        return -1;
+    }
+
+    // A line end is stored, so this stops before reaching head
+    while (1) {
+        uint8_t c = ring->buf[tail & LRING_MASK];
+
+        tail++;
+        if (c == '\r' || c == '\n') {
+            break;
+        }
+        if ((size_t)len + 1U < size) {
+            line[len] = (char)c;
+        }
+        len++;
+    }
+
+    line[((size_t)len < size) ? (size_t)len : size - 1U] = '\0';
+    ring->tail = tail;                  // Release the space only after reading it
+    ring->lines_done++;
+
+    return len;
+}
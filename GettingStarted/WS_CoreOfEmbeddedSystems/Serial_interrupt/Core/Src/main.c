@@ -21,6 +21,8 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "cmd.h"
+#include "line_ring.h"
 #include <string.h>
 /* USER CODE END Includes */
 
@@ -31,6 +33,8 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define CMD_LINE_SIZE     80        // Longest command line handled
+#define UART_IRQ_PRIORITY 1
 
 /* USER CODE END PD */
 
@@ -43,6 +47,7 @@
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+LRING_HandleTypeDef rx_ring;     // Filled by USART2_IRQHandler, drained by the main loop
 
 /* USER CODE END PV */
 
@@ -51,46 +56,27 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
+static void HandleLine(char *line);
+static void Reply(const char *text);
+static void ReplyWrite(void *io, const char *data, size_t len);
+static CMD_StatusTypeDef CmdOn(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdOff(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdToggle(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdStatus(const CMD_OutputTypeDef *out, int argc, char *argv[]);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-uint8_t rxChar;
-char rxBuf[4];       // buffer for up to 3 chars + '\0'
-uint8_t idx = 0;     // current index into rxBuf
+static const CMD_CommandTypeDef commands[] = {
+  { "ON",     "", "LED on",                       CmdOn,     0, 0 },
+  { "OFF",    "", "LED off",                      CmdOff,    0, 0 },
+  { "TOGGLE", "", "Toggle the LED",               CmdToggle, 0, 0 },
+  { "STATUS", "", "LED state and receive losses", CmdStatus, 0, 0 },
+};
+static const CMD_TableTypeDef command_table = CMD_TABLE(commands);
+static const CMD_OutputTypeDef reply_out = { ReplyWrite, NULL, NULL, NULL };
 
-/* This callback is called by HAL when a byte is received via interrupt */
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
-{
-    if (huart->Instance == USART2)
-    {
-        // 1) Filter out CR/LF and store valid chars
-        if (rxChar != '\r' && rxChar != '\n' && idx < (sizeof(rxBuf)-1))
-        {
-            rxBuf[idx++] = rxChar;
-        }
-        // 2) If we saw LF, treat as end-of-command
-        if (rxChar == '\n')
-        {
-            rxBuf[idx] = '\0';  // null-terminate
-            // 3) Compare and act
-            if (strcmp(rxBuf, "ON") == 0)
-            {
-                HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET);
-            }
-            else if (strcmp(rxBuf, "OFF") == 0)
-            {
-                HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_RESET);
-            }
-            // 4) Reset buffer for next command
-            idx = 0;
-            memset(rxBuf, 0, sizeof(rxBuf));
-        }
-        // 5) Re-arm the UART receive interrupt for next byte
-        HAL_UART_Receive_IT(&huart2, &rxChar, 1);
-    }
-}
 /* USER CODE END 0 */
 
 /**
@@ -124,14 +110,35 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
-  // Start reception of the first byte in interrupt mode
-      HAL_UART_Receive_IT(&huart2, &rxChar, 1);
+  // Receive interrupt only: USART2_IRQHandler stores bytes, nothing else
+  LRING_Init(&rx_ring);
+  __HAL_UART_ENABLE_IT(&huart2, UART_IT_RXNE);
+  HAL_NVIC_SetPriority(USART2_IRQn, UART_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(USART2_IRQn);
   /* USER CODE END 2 */
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   while (1)
   {
+    char line[CMD_LINE_SIZE];
+    int32_t len;
+
+    // Commands run here, in thread context, however long they take
+    while ((len = LRING_GetLine(&rx_ring, line, sizeof(line))) >= 0)
+    {
+      if (len >= (int32_t)sizeof(line))
+      {
+        Reply("ERR line too long\r\n");
+      }
+      else if (len > 0)
+      {
+        HandleLine(line);
+      }
+    }
+
+    // Wakes on the next received byte (or SysTick)
+    __WFI();
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -258,6 +265,87 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Send a reply (thread context only)
+  * @param  text: Null-terminated reply
+  * @retval None
+  */
+static void Reply(const char *text)
+{
+  HAL_UART_Transmit(&huart2, (const uint8_t*)text, strlen(text), HAL_MAX_DELAY);
+}
+
+/**
+  * @brief  Reply output for the command library (thread context only)
+  * @retval None
+  */
+static void ReplyWrite(void *io, const char *data, size_t len)
+{
+  HAL_UART_Transmit(&huart2, (const uint8_t*)data, len, HAL_MAX_DELAY);
+}
+
+/**
+  * @brief  Parse and execute one command line
+  * @note   Every non-empty line ends with an "OK" or "ERR" line, after any
+  *         output of the command itself
+  * @param  line: Null-terminated line without its line end
+  * @retval None
+  */
+static void HandleLine(char *line)
+{
+  CMD_StatusTypeDef status = CMD_Execute(&command_table, line, &reply_out);
+
+  if (status == CMD_OK)
+  {
+    Reply("OK\r\n");
+  }
+  else if (status != CMD_EMPTY)
+  {
+    Reply("ERR\r\n");
+  }
+}
+
+/**
+  * @brief  "ON": LED on
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdOn(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "OFF": LED off
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdOff(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_RESET);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "TOGGLE": invert the LED
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdToggle(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_5);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "STATUS": LED state and receive ring losses
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdStatus(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  CMD_Printf(out, "LED %s, dropped %lu, flushed %lu\r\n",
+             HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_5) == GPIO_PIN_SET ? "ON" : "OFF",
+             rx_ring.dropped, rx_ring.flushed);
+  return CMD_OK;
+}
 
 /* USER CODE END 4 */
 
@@ -22,6 +22,8 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "line_ring.h"
+#include "ram_func.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,6 +59,7 @@
 /* External variables --------------------------------------------------------*/
 
 /* USER CODE BEGIN EV */
+extern LRING_HandleTypeDef rx_ring;
 
 /* USER CODE END EV */
 
@@ -199,5 +202,20 @@ void SysTick_Handler(void)
 /******************************************************************************/
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles USART2 global interrupt (receive only).
+  * @note  Fixed work per byte: read DR, store it in rx_ring. Reading SR
+  *        then DR also clears overrun, noise and framing flags, so no
+  *        error path is needed; commands are parsed in the main loop.
+  *        Runs from SRAM (with the inlined LRING_Put) so its latency does
+  *        not depend on flash wait states or ART cache misses
+  */
+RAM_FUNC void USART2_IRQHandler(void)
+{
+  if ((USART2->SR & (USART_SR_RXNE | USART_SR_ORE)) != 0U)
+  {
+    LRING_Put(&rx_ring, (uint8_t)USART2->DR);
+  }
+}
 
 /* USER CODE END 1 */
@@ -0,0 +1,41 @@
+#ifndef SHELL_H
+#define SHELL_H
+
+#include "cmd.h"
+
+// Configuration definitions
+#define SHELL_LINE_SIZE     64                  // Longest line, terminator included
+#define SHELL_HISTORY       4                   // Lines recalled with the arrow keys
+#define SHELL_POLL_BYTES    16                  // Input bytes handled per SHELL_Poll
+#define SHELL_PROMPT        "> "
+
+// Transport input: must return at once with the bytes available now
+typedef size_t (*SHELL_ReadTypeDef)(void *io, uint8_t *data, size_t max);
+
+// Shell structure
+typedef struct {
+    const CMD_TableTypeDef *table;              // Commands ("help" is built in)
+    SHELL_ReadTypeDef read;
+    CMD_OutputTypeDef out;                      // Write side of the transport, may drop when full
+    char line[SHELL_LINE_SIZE];                 // Line being edited
+    uint8_t len;                                // Characters in line
+    uint8_t esc;                                // Escape sequence state
+    uint8_t last;                               // Previous input byte (CR LF pairs)
+    char history[SHELL_HISTORY][SHELL_LINE_SIZE];
+    uint8_t hist_count;                         // Lines stored
+    uint8_t hist_next;                          // Slot of the next stored line
+    uint8_t hist_pos;                           // Lines back while browsing, 0 = new line
+} SHELL_HandleTypeDef;
+
+// Shell states
+typedef enum {
+    SHELL_OK = 0,       // Operation successful
+    SHELL_ERROR = 1     // Operation failed
+} SHELL_StatusTypeDef;
+
+// Function prototypes
+SHELL_StatusTypeDef SHELL_Init(SHELL_HandleTypeDef *sh, const CMD_TableTypeDef *table,
+                               SHELL_ReadTypeDef read, CMD_WriteTypeDef write, void *io);
+uint32_t SHELL_Poll(SHELL_HandleTypeDef *sh);
+
+#endif /* SHELL_H */
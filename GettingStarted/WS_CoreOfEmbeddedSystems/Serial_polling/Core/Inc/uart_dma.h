@@ -0,0 +1,39 @@
+#ifndef UART_DMA_H
+#define UART_DMA_H
+
+#include "stm32f4xx_hal.h"
+
+// Configuration definitions
+#define UDMA_RX_SIZE        256                         // RX ring: 22 ms of input at 115200 baud
+#define UDMA_TX_SIZE        512                         // TX ring
+#define UDMA_RX_STREAM      DMA1_Stream5                // USART2_RX
+#define UDMA_TX_STREAM      DMA1_Stream6                // USART2_TX
+#define UDMA_DMA_CHANNEL    DMA_CHANNEL_4
+
+// DMA UART structure
+typedef struct {
+    UART_HandleTypeDef *huart;          // Initialized UART (USART2)
+    DMA_HandleTypeDef hdma_rx;          // Circular, peripheral to rx[]
+    DMA_HandleTypeDef hdma_tx;          // One chunk of tx[] at a time
+    uint8_t rx[UDMA_RX_SIZE];           // Written by the DMA
+    uint32_t rx_tail;                   // Next byte to read (index)
+    uint8_t tx[UDMA_TX_SIZE];
+    uint32_t tx_head;                   // Bytes queued (free running)
+    uint32_t tx_tail;                   // Bytes fully sent (free running)
+    uint32_t tx_chunk;                  // Length of the chunk being sent
+    uint32_t tx_dropped;                // Bytes lost to a full TX ring
+} UDMA_HandleTypeDef;
+
+// DMA UART states
+typedef enum {
+    UDMA_OK = 0,        // Operation successful
+    UDMA_ERROR = 1      // Operation failed
+} UDMA_StatusTypeDef;
+
+// Function prototypes
+UDMA_StatusTypeDef UDMA_Init(UDMA_HandleTypeDef *u, UART_HandleTypeDef *huart);
+size_t UDMA_Read(UDMA_HandleTypeDef *u, uint8_t *data, size_t max);
+size_t UDMA_Write(UDMA_HandleTypeDef *u, const uint8_t *data, size_t len);
+void UDMA_Poll(UDMA_HandleTypeDef *u);
+
+#endif /* UART_DMA_H */
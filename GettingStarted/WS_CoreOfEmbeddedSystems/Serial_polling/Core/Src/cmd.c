@@ -0,0 +1,387 @@
+#include "cmd.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// Powers of ten exactly representable in single precision
+static const float CMD_Pow10[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+/**
+ * @brief Lower-case an ASCII character
+ * @param c: Character
+ * @retval char: c, lower-cased if it is a capital letter
+ */
+static inline char CMD_Lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+/**
+ * @brief Write a string to the output
+ * @param out: Output of the transport
+ * @param text: Null-terminated string
+ */
+void CMD_Print(const CMD_OutputTypeDef *out, const char *text)
+{
+    out->write(out->io, text, strlen(text));
+}
+
+/**
+ * @brief Formatted write through a stack buffer, for outputs without reserve
+ * @note  Kept out of CMD_Printf() so the zero-copy path does not carry the
+ *        buffer in its frame
+ * @param out: Output of the transport
+ * @param format: printf format
+ * @param args: Format arguments
+ */
+static __attribute__((noinline)) void CMD_VPrintfBuffered(const CMD_OutputTypeDef *out, const char *format, va_list args)
+{
+    char buf[CMD_PRINTF_SIZE];
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+
+    if (len > 0) {
+        out->write(out->io, buf, ((size_t)len < sizeof(buf)) ? (size_t)len : sizeof(buf) - 1U);
+    }
+}
+
+/**
+ * @brief Formatted write to the output
+ * @note  With a reserve hook the text is formatted straight into the
+ *        transport's buffer and cut at its size - 1 characters; otherwise
+ *        it goes through a stack buffer and is cut at CMD_PRINTF_SIZE - 1
+ * @param out: Output of the transport
+ * @param format: printf format
+ */
+void CMD_Printf(const CMD_OutputTypeDef *out, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+
+    if (out->reserve != NULL) {
+        size_t size;
+        char *slot = out->reserve(out->io, &size);
+
+        if (slot != NULL && size > 0U) {
+            int len = vsnprintf(slot, size, format, args);
+
+            out->commit(out->io, (len <= 0) ? 0U : ((size_t)len < size) ? (size_t)len : size - 1U);
+        }
+    } else {
+        CMD_VPrintfBuffered(out, format, args);
+    }
+
+    va_end(args);
+}
+
+/**
+ * @brief Split a line into arguments, in place
+ * @note  No allocation and no copy: separators (spaces, tabs and other
+ *        control characters) become terminators and argv points into the
+ *        line. Double quotes group an argument containing spaces and are
+ *        removed; only a quoted argument has its characters moved
+ * @param line: Null-terminated line, modified
+ * @param argv: Output, pointers into line
+ * @param max: Capacity of argv
+ * @retval int: Number of arguments, -1 if there are more than max
+ */
+int CMD_Tokenize(char *line, char *argv[], int max)
+{
+    int argc = 0;
+    char *src = line;
+
+    while (1) {
+        while (*src != '\0' && (uint8_t)*src <= ' ') {
+            src++;
+        }
+        if (*src == '\0') {
+            return argc;
+        }
+        if (argc == max) {
+            return -1;
+        }
+        argv[argc++] = src;
+
+        // Plain word: one compare per character, nothing moves
+        while ((uint8_t)*src > ' ' && *src != '"') {
+            src++;
+        }
+
+        if (*src == '"') {
+            // Copy down over removed quotes; dst never passes src
+            char *dst = src;
+            uint8_t quoted = 0;
+
+            while (*src != '\0' && (quoted || (uint8_t)*src > ' ')) {
+                if (*src == '"') {
+                    quoted ^= 1U;
+                    src++;
+                    continue;
+                }
+                *dst++ = *src++;
+            }
+            if (*src != '\0') {
+                src++;
+            }
+            *dst = '\0';
+        } else if (*src != '\0') {
+            *src++ = '\0';
+        }
+    }
+}
+
+/**
+ * @brief Compare two words without regard to case
+ * @param a: Null-terminated word
+ * @param b: Null-terminated word
+ * @retval uint8_t: 1 if equal
+ */
+uint8_t CMD_NameEquals(const char *a, const char *b)
+{
+    // Same case is the common case; fold only when the bytes differ
+    while (*a == *b || CMD_Lower(*a) == CMD_Lower(*b)) {
+        if (*a == '\0') {
+            return 1;
+        }
+        a++;
+        b++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Tokenize a line and run the matching command
+ * @note  Replies for the failures it detects itself (unknown command,
+ *        argument count) and for the built-in "help", which lists the
+ *        table; the handler replies for everything else
+ * @param table: Command table
+ * @param line: Null-terminated line, modified in place
+ * @param out: Output of the transport the line came from
+ * @retval CMD_StatusTypeDef: Handler result, or why no handler ran
+ */
+CMD_StatusTypeDef CMD_Execute(const CMD_TableTypeDef *table, char *line, const CMD_OutputTypeDef *out)
+{
+    char *argv[CMD_MAX_ARGS];
+    int argc = CMD_Tokenize(line, argv, CMD_MAX_ARGS);
+
+    if (argc == 0) {
+        return CMD_EMPTY;
+    }
+    if (argc < 0) {
+        CMD_Print(out, "error: too many arguments\r\n");
+        return CMD_USAGE;
+    }
+
+    // First letter before the full compare: most entries are skipped in one test
+    char first = CMD_Lower(argv[0][0]);
+
+    for (uint8_t i = 0; i < table->count; i++) {
+        const CMD_CommandTypeDef *cmd = &table->commands[i];
+
+        if (CMD_Lower(cmd->name[0]) != first || !CMD_NameEquals(argv[0], cmd->name)) {
+            continue;
+        }
+        if (argc - 1 < cmd->min_args || argc - 1 > cmd->max_args) {
+            CMD_Printf(out, "usage: %s %s\r\n", cmd->name, cmd->usage);
+            return CMD_USAGE;
+        }
+        return cmd->handler(out, argc, argv);
+    }
+
+    if (CMD_NameEquals(argv[0], "help")) {
+        for (uint8_t i = 0; i < table->count; i++) {
+            const CMD_CommandTypeDef *cmd = &table->commands[i];
+
+            CMD_Printf(out, "%-8s %-8s %s\r\n", cmd->name, cmd->usage, cmd->help);
+        }
+        return CMD_OK;
+    }
+
+    CMD_Printf(out, "unknown command: %s (try help)\r\n", argv[0]);
+    return CMD_UNKNOWN;
+}
+
+/**
+ * @brief Parse an unsigned decimal argument
+ * @param arg: Argument
+ * @param value: Output, written only on success
+ * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR on a malformed or too large number
+ */
+CMD_StatusTypeDef CMD_ParseUint(const char *arg, uint32_t *value)
+{
+    uint32_t v = 0;
+
+    if (*arg == '\0') {
+        return CMD_ERROR;
+    }
+
+    for (; *arg != '\0'; arg++) {
+        uint32_t d = (uint32_t)(*arg - '0');
+
+        if (d > 9U || v > (UINT32_MAX - d) / 10U) {
+            return CMD_ERROR;
+        }
+        v = v * 10U + d;
+    }
+
+    *value = v;
+    return CMD_OK;
+}
+
+/**
+ * @brief Parse a signed decimal argument
+ * @param arg: Argument, optional leading '-' or '+'
+ * @param value: Output, written only on success
+ * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR on a malformed or out of range number
+ */
+CMD_StatusTypeDef CMD_ParseInt(const char *arg, int32_t *value)
+{
+    uint8_t negative = (*arg == '-');
+    uint32_t v;
+
+    if (*arg == '-' || *arg == '+') {
+        arg++;
+    }
+    if (CMD_ParseUint(arg, &v) != CMD_OK || v > (negative ? 0x80000000UL : 0x7FFFFFFFUL)) {
+        return CMD_ERROR;
+    }
+
+    *value = negative ? (int32_t)(0U - v) : (int32_t)v;
+    return CMD_OK;
+}
+
+/**
+ * @brief Parse a hexadecimal argument
+ * @param arg: Argument, optional "0x" prefix, 1 to 8 digits of either case
+ * @param value: Output, written only on success
+ * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR on a malformed number
+ */
+CMD_StatusTypeDef CMD_ParseHex(const char *arg, uint32_t *value)
+{
+    uint32_t v = 0;
+    uint32_t digits = 0;
+
+    if (arg[0] == '0' && (arg[1] == 'x' || arg[1] == 'X')) {
+        arg += 2;
+    }
+
+    for (; *arg != '\0'; arg++) {
+        char c = CMD_Lower(*arg);
+        uint32_t d;
+
+        if (c >= '0' && c <= '9') {
+            d = (uint32_t)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            d = (uint32_t)(c - 'a' + 10);
+        } else {
+            return CMD_ERROR;
+        }
+        if (++digits > 8U) {
+            return CMD_ERROR;
+        }
+        v = (v << 4) | d;
+    }
+
+    if (digits == 0U) {
+        return CMD_ERROR;
+    }
+
+    *value = v;
+    return CMD_OK;
+}
+
+/**
+ * @brief Parse a decimal fraction argument
+ * @note  Sign, digits, optional '.' and fraction, optional exponent
+ *        (e.g. "-1.25", "3e-3"). Single precision arithmetic only, so no
+ *        double-precision library code is pulled in; up to 9 significant
+ *        digits are used, the rest only scale the result.
+ *        Not always correctly rounded: with up to 7 significant digits
+ *        and a decimal scale within 10 the result equals strtof's;
+ *        otherwise the digits and the scaling round separately and the
+ *        result is within 1 ulp of strtof's (2 ulp past 1e+-10)
+ * @param arg: Argument
+ * @param value: Output, written only on success
+ * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR on a malformed number
+ */
+CMD_StatusTypeDef CMD_ParseFloat(const char *arg, float *value)
+{
+    uint8_t negative = (*arg == '-');
+    uint32_t mantissa = 0;
+    uint32_t digits = 0;
+    int32_t scale = 0;
+    float v;
+
+    if (*arg == '-' || *arg == '+') {
+        arg++;
+    }
+
+    for (; *arg >= '0' && *arg <= '9'; arg++, digits++) {
+        if (mantissa < 100000000UL) {
+            mantissa = mantissa * 10U + (uint32_t)(*arg - '0');
+        } else {
+            scale++;
+        }
+    }
+    if (*arg == '.') {
+        for (arg++; *arg >= '0' && *arg <= '9'; arg++, digits++) {
+            if (mantissa < 100000000UL) {
+                mantissa = mantissa * 10U + (uint32_t)(*arg - '0');
+                scale--;
+            }
+        }
+    }
+    if (digits == 0U) {
+        return CMD_ERROR;
+    }
+    if (*arg == 'e' || *arg == 'E') {
+        int32_t exponent;
+
+        if (CMD_ParseInt(arg + 1, &exponent) != CMD_OK || exponent > 38 || exponent < -45) {
+            return CMD_ERROR;
+        }
+        scale += exponent;
+    } else if (*arg != '\0') {
+        return CMD_ERROR;
+    }
+
+    // One rounding while the mantissa is below 2^24 and 1e10 covers the scale
+    v = (float)mantissa;
+    for (; scale > 10; scale -= 10) {
+        v *= 1e10f;
+    }
+    for (; scale < -10; scale += 10) {
+        v /= 1e10f;
+    }
+    if (scale > 0) {
+        v *= CMD_Pow10[scale];
+    } else if (scale < 0) {
+        v /= CMD_Pow10[-scale];
+    }
+
+    *value = negative ? -v : v;
+    return CMD_OK;
+}
+
+/**
+ * @brief Parse a keyword argument against a list of names
+ * @param arg: Argument, matched without regard to case
+ * @param names: Accepted keywords
+ * @param count: Number of names
+ * @param index: Output, position of the match in names
+ * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR if no name matches
+ */
+CMD_StatusTypeDef CMD_ParseEnum(const char *arg, const char *const names[], uint8_t count, uint8_t *index)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        if (CMD_NameEquals(arg, names[i])) {
+            *index = i;
+            return CMD_OK;
+        }
+    }
+
+    return CMD_ERROR;
+}
@@ -21,6 +21,8 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "shell.h"
+#include "uart_dma.h"
 #include <string.h>
 /* USER CODE END Includes */
 
@@ -31,6 +33,7 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define BANNER  "\r\nSerial_polling shell, type help\r\n"
 
 /* USER CODE END PD */
 
@@ -43,6 +46,14 @@
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+UDMA_HandleTypeDef uart;
+SHELL_HandleTypeDef shell;
+
+uint32_t blink_ms;              // LED blink half-period, 0 = steady
+uint32_t blink_last;            // Tick of the last blink toggle
+uint32_t loop_count;            // Main loop iterations since the last "stats"
+uint32_t loop_since;            // Tick of the last "stats"
+uint32_t poll_max;              // Longest SHELL_Poll in core cycles
 
 /* USER CODE END PV */
 
@@ -51,11 +62,26 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
+static size_t ShellRead(void *io, uint8_t *data, size_t max);
+static void ShellWrite(void *io, const char *data, size_t len);
+static CMD_StatusTypeDef CmdOn(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdOff(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdToggle(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdBlink(const CMD_OutputTypeDef *out, int argc, char *argv[]);
+static CMD_StatusTypeDef CmdStats(const CMD_OutputTypeDef *out, int argc, char *argv[]);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+static const CMD_CommandTypeDef commands[] = {
+  { "on",     "",     "LED on",                              CmdOn,     0, 0 },
+  { "off",    "",     "LED off",                             CmdOff,    0, 0 },
+  { "toggle", "",     "Toggle the LED",                      CmdToggle, 0, 0 },
+  { "blink",  "<ms>", "Blink the LED, 0 stops",              CmdBlink,  1, 1 },
+  { "stats",  "",     "Main loop rate and worst shell poll", CmdStats,  0, 0 },
+};
+static const CMD_TableTypeDef command_table = CMD_TABLE(commands);
 
 /* USER CODE END 0 */
 
@@ -67,8 +93,6 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-	const char prompt[] = "Send command: ON or OFF\r\n";
-	uint8_t rxBuf[4]; // spazio per "ON\0" o "OFF\0"
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -91,6 +115,17 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  if (UDMA_Init(&uart, &huart2) != UDMA_OK)
+  {
+    Error_Handler();
+  }
+  UDMA_Write(&uart, (const uint8_t*)BANNER, strlen(BANNER));
+  SHELL_Init(&shell, &command_table, ShellRead, ShellWrite, &uart);
+  loop_since = HAL_GetTick();
 
   /* USER CODE END 2 */
 
@@ -98,37 +133,24 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-	  // 1) Send prompt
-	  HAL_UART_Transmit(&huart2, (uint8_t*)prompt, strlen(prompt), HAL_MAX_DELAY);
-
-	  // 2) Receive command in polling (3 characters + terminator)
-	  //    Here we always wait for 3 bytes; you can adjust to read until '\n'
-	  uint8_t rxChar;
-	  uint8_t idx = 0;
-	  memset(rxBuf, 0, sizeof(rxBuf));
-
-	  do {
-	      HAL_UART_Receive(&huart2, &rxChar, 1, HAL_MAX_DELAY);
-
-	      if (rxChar != '\r' && rxChar != '\n' && idx < (sizeof(rxBuf) - 1)) {
-	          rxBuf[idx++] = rxChar;
-	      }
-
-	  } while (rxChar != '\n');
-
-	  rxBuf[3] = '\0'; // null-terminator
-
-
-	  // 3) Compare and act on the LED
-	  if (strcmp((char*)rxBuf, "ON") == 0)
-	  {
-		  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET);   // LED ON
-	  }
-	  else if (strcmp((char*)rxBuf, "OFF") == 0)
-	  {
-		  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_RESET); // LED OFF
-	  }
-	  // else: unrecognized command, repeat prompt
+    // Nothing here waits: the shell takes a bounded slice of input, the
+    // UART moves bytes by DMA, and the blink runs off the tick
+    uint32_t start = DWT->CYCCNT;
+    SHELL_Poll(&shell);
+    uint32_t spent = DWT->CYCCNT - start;
+    if (spent > poll_max)
+    {
+      poll_max = spent;
+    }
+
+    UDMA_Poll(&uart);
+
+    if (blink_ms != 0U && HAL_GetTick() - blink_last >= blink_ms)
+    {
+      blink_last += blink_ms;
+      HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_5);
+    }
+    loop_count++;
 	  /* USER CODE END WHILE */
 
 	  /* USER CODE BEGIN 3 */
@@ -255,6 +277,90 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Shell input: bytes received by the UART DMA so far
+  * @retval size_t: Bytes copied
+  */
+static size_t ShellRead(void *io, uint8_t *data, size_t max)
+{
+  return UDMA_Read((UDMA_HandleTypeDef*)io, data, max);
+}
+
+/**
+  * @brief  Shell output: queued for the UART DMA, never waits
+  * @retval None
+  */
+static void ShellWrite(void *io, const char *data, size_t len)
+{
+  UDMA_Write((UDMA_HandleTypeDef*)io, (const uint8_t*)data, len);
+}
+
+/**
+  * @brief  "on": LED on, stops blinking
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdOn(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  blink_ms = 0;
+  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_SET);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "off": LED off, stops blinking
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdOff(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  blink_ms = 0;
+  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, GPIO_PIN_RESET);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "toggle": invert the LED
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdToggle(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_5);
+  return CMD_OK;
+}
+
+/**
+  * @brief  "blink <ms>": toggle the LED every ms milliseconds from the main loop
+  * @retval CMD_StatusTypeDef: CMD_OK, or CMD_ERROR on an invalid argument
+  */
+static CMD_StatusTypeDef CmdBlink(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  uint32_t ms;
+
+  if (CMD_ParseUint(argv[1], &ms) != CMD_OK)
+  {
+    return CMD_ERROR;
+  }
+
+  blink_ms = ms;
+  blink_last = HAL_GetTick();
+  return CMD_OK;
+}
+
+/**
+  * @brief  "stats": main loop rate and the longest SHELL_Poll since the last call
+  * @retval CMD_StatusTypeDef: CMD_OK
+  */
+static CMD_StatusTypeDef CmdStats(const CMD_OutputTypeDef *out, int argc, char *argv[])
+{
+  uint32_t now = HAL_GetTick();
+  uint32_t ms = (now - loop_since) ? (now - loop_since) : 1U;
+
+  CMD_Printf(out, "loop: %lu/s, poll max: %lu cycles, tx dropped: %lu\r\n",
+             (uint32_t)((uint64_t)loop_count * 1000U / ms), poll_max, uart.tx_dropped);
+  loop_count = 0;
+  loop_since = now;
+  poll_max = 0;
+  return CMD_OK;
+}
 
 /* USER CODE END 4 */
 
@@ -0,0 +1,207 @@
+#include "shell.h"
+#include <string.h>
+
+// Control characters handled by the line editor
+#define SHELL_CTRL_C        0x03
+#define SHELL_BS            0x08
+#define SHELL_CTRL_U        0x15
+#define SHELL_ESC           0x1B
+#define SHELL_DEL           0x7F
+
+// Escape sequence states (only ESC [ A and ESC [ B are acted on)
+#define SHELL_ESC_NONE      0
+#define SHELL_ESC_START     1                   // ESC received
+#define SHELL_ESC_CSI       2                   // ESC [ received
+
+/**
+ * @brief Redraw the prompt and the line being edited
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ */
+static void SHELL_Redraw(SHELL_HandleTypeDef *sh)
+{
+    CMD_Print(&sh->out, "\r\x1B[K" SHELL_PROMPT);
+    sh->out.write(sh->out.io, sh->line, sh->len);
+}
+
+/**
+ * @brief Replace the line with a history entry (or an empty line)
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ * @param pos: Lines back, 0 = empty new line
+ */
+static void SHELL_Recall(SHELL_HandleTypeDef *sh, uint8_t pos)
+{
+    sh->hist_pos = pos;
+    if (pos == 0U) {
+        sh->len = 0;
+    } else {
+        uint8_t slot = (uint8_t)((sh->hist_next + SHELL_HISTORY - pos) % SHELL_HISTORY);
+
+        sh->len = (uint8_t)strlen(sh->history[slot]);
+        memcpy(sh->line, sh->history[slot], sh->len);
+    }
+    SHELL_Redraw(sh);
+}
+
+/**
+ * @brief Store the current line in the history unless it repeats the last one
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ */
+static void SHELL_Remember(SHELL_HandleTypeDef *sh)
+{
+    uint8_t prev = (uint8_t)((sh->hist_next + SHELL_HISTORY - 1U) % SHELL_HISTORY);
+
+    if (sh->hist_count > 0U && strcmp(sh->history[prev], sh->line) == 0) {
+        return;
+    }
+
+    memcpy(sh->history[sh->hist_next], sh->line, (size_t)sh->len + 1U);
+    sh->hist_next = (uint8_t)((sh->hist_next + 1U) % SHELL_HISTORY);
+    if (sh->hist_count < SHELL_HISTORY) {
+        sh->hist_count++;
+    }
+}
+
+/**
+ * @brief Run the completed line and start a new one
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ */
+static void SHELL_Execute(SHELL_HandleTypeDef *sh)
+{
+    CMD_Print(&sh->out, "\r\n");
+    sh->line[sh->len] = '\0';
+    if (sh->len > 0U) {
+        SHELL_Remember(sh);
+    }
+
+    if (CMD_Execute(sh->table, sh->line, &sh->out) == CMD_ERROR) {
+        CMD_Print(&sh->out, "error\r\n");
+    }
+
+    sh->len = 0;
+    sh->hist_pos = 0;
+    CMD_Print(&sh->out, SHELL_PROMPT);
+}
+
+/**
+ * @brief Feed one input byte to the line editor
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ * @param c: Input byte
+ * @retval uint8_t: 1 when the byte completes a line
+ */
+static uint8_t SHELL_Feed(SHELL_HandleTypeDef *sh, uint8_t c)
+{
+    uint8_t last = sh->last;
+
+    sh->last = c;
+
+    if (sh->esc == SHELL_ESC_START) {
+        sh->esc = (c == '[') ? SHELL_ESC_CSI : SHELL_ESC_NONE;
+        return 0;
+    }
+    if (sh->esc == SHELL_ESC_CSI) {
+        if (c >= 0x40U && c <= 0x7EU) {
+            sh->esc = SHELL_ESC_NONE;
+            if (c == 'A' && sh->hist_pos < sh->hist_count) {
+                SHELL_Recall(sh, sh->hist_pos + 1U);
+            } else if (c == 'B' && sh->hist_pos > 0U) {
+                SHELL_Recall(sh, sh->hist_pos - 1U);
+            }
+        }
+        return 0;
+    }
+
+    switch (c) {
+    case '\r':
+        return 1;
+
+    case '\n':
+        return last != '\r';            // CR LF is one line end
+
+    case SHELL_BS:
+    case SHELL_DEL:
+        if (sh->len > 0U) {
+            sh->len--;
+            CMD_Print(&sh->out, "\b \b");
+        }
+        return 0;
+
+    case SHELL_CTRL_C:
+        sh->len = 0;
+        sh->hist_pos = 0;
+        CMD_Print(&sh->out, "^C\r\n" SHELL_PROMPT);
+        return 0;
+
+    case SHELL_CTRL_U:
+        sh->len = 0;
+        SHELL_Redraw(sh);
+        return 0;
+
+    case SHELL_ESC:
+        sh->esc = SHELL_ESC_START;
+        return 0;
+
+    default:
+        // Printable characters only; the rest is dropped, as is anything
+        // typed past the end of the line
+        if (c >= 0x20U && c < 0x7FU && sh->len < SHELL_LINE_SIZE - 1U) {
+            sh->line[sh->len++] = (char)c;
+            sh->out.write(sh->out.io, (const char *)&c, 1);
+        }
+        return 0;
+    }
+}
+
+/**
+ * @brief Initialize the shell and print the first prompt
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ * @param table: Command table ("help" is built in)
+ * @param read: Non-blocking input
+ * @param write: Non-blocking output
+ * @param io: Passed to read and write
+ * @retval SHELL_StatusTypeDef: Operation status
+ */
+SHELL_StatusTypeDef SHELL_Init(SHELL_HandleTypeDef *sh, const CMD_TableTypeDef *table,
+                               SHELL_ReadTypeDef read, CMD_WriteTypeDef write, void *io)
+{
+    if (sh == NULL || table == NULL || read == NULL || write == NULL) {
+        return SHELL_ERROR;
+    }
+
+    memset(sh, 0, sizeof(*sh));
+    sh->table = table;
+    sh->read = read;
+    sh->out.write = write;
+    sh->out.io = io;
+
+    CMD_Print(&sh->out, SHELL_PROMPT);
+
+    return SHELL_OK;
+}
+
+/**
+ * @brief Process pending input; call from the main loop
+ * @note  Bounded work per call: at most SHELL_POLL_BYTES input bytes and
+ *        at most one command. Input beyond that waits in the transport
+ *        for the next call, so a fast typist or a pasted script only
+ *        spreads over more calls and never lengthens one
+ * @param sh: Pointer to SHELL_HandleTypeDef structure
+ * @retval uint32_t: Input bytes consumed
+ */
+uint32_t SHELL_Poll(SHELL_HandleTypeDef *sh)
+{
+    uint32_t n;
+    uint8_t c;
+
+    for (n = 0; n < SHELL_POLL_BYTES; n++) {
+        if (sh->read(sh->out.io, &c, 1) == 0U) {
+            break;
+        }
+        if (SHELL_Feed(sh, c)) {
+            SHELL_Execute(sh);
+            n++;
+            break;
+        }
+    }
+
+    return n;
+}
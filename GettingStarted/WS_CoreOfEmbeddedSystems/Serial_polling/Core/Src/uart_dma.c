@@ -0,0 +1,162 @@
+#include "uart_dma.h"
+#include <string.h>
+
+/**
+ * @brief Configure one DMA stream of the UART
+ * @param hdma: DMA handle to fill in
+ * @param stream: DMA stream
+ * @param direction: DMA_PERIPH_TO_MEMORY or DMA_MEMORY_TO_PERIPH
+ * @param mode: DMA_CIRCULAR or DMA_NORMAL
+ * @retval HAL_StatusTypeDef: HAL_DMA_Init result
+ */
+static HAL_StatusTypeDef UDMA_InitStream(DMA_HandleTypeDef *hdma, DMA_Stream_TypeDef *stream,
+                                         uint32_t direction, uint32_t mode)
+{
+    hdma->Instance = stream;
+    hdma->Init.Channel = UDMA_DMA_CHANNEL;
+    hdma->Init.Direction = direction;
+    hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma->Init.MemInc = DMA_MINC_ENABLE;
+    hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma->Init.Mode = mode;
+    hdma->Init.Priority = DMA_PRIORITY_LOW;
+    hdma->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+    return HAL_DMA_Init(hdma);
+}
+
+/**
+ * @brief Start DMA reception and transmission on an initialized UART
+ * @note  No interrupt is used: the RX stream runs circularly forever and
+ *        the TX stream is restarted from UDMA_Write and UDMA_Poll. Input
+ *        is lost only if more than UDMA_RX_SIZE bytes arrive between two
+ *        reads
+ * @param u: Pointer to UDMA_HandleTypeDef structure
+ * @param huart: UART initialized by MX_USARTx_UART_Init (USART2)
+ * @retval UDMA_StatusTypeDef: Operation status
+ */
+UDMA_StatusTypeDef UDMA_Init(UDMA_HandleTypeDef *u, UART_HandleTypeDef *huart)
+{
+    if (u == NULL || huart == NULL) {
+        return UDMA_ERROR;
+    }
+
+    memset(u, 0, sizeof(*u));
+    u->huart = huart;
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    if (UDMA_InitStream(&u->hdma_rx, UDMA_RX_STREAM, DMA_PERIPH_TO_MEMORY, DMA_CIRCULAR) != HAL_OK ||
+        UDMA_InitStream(&u->hdma_tx, UDMA_TX_STREAM, DMA_MEMORY_TO_PERIPH, DMA_NORMAL) != HAL_OK) {
+        return UDMA_ERROR;
+    }
+
+    if (HAL_DMA_Start(&u->hdma_rx, (uint32_t)&huart->Instance->DR, (uint32_t)u->rx, UDMA_RX_SIZE) != HAL_OK) {
+        return UDMA_ERROR;
+    }
+
+    // The TX stream always writes DR; only address and length change per chunk
+    UDMA_TX_STREAM->PAR = (uint32_t)&huart->Instance->DR;
+
+    __HAL_UART_CLEAR_OREFLAG(huart);
+    SET_BIT(huart->Instance->CR3, USART_CR3_DMAR | USART_CR3_DMAT);
+
+    return UDMA_OK;
+}
+
+/**
+ * @brief Copy out the bytes received so far
+ * @param u: Pointer to UDMA_HandleTypeDef structure
+ * @param data: Destination
+ * @param max: Capacity of data
+ * @retval size_t: Bytes copied, 0 if nothing is pending
+ */
+size_t UDMA_Read(UDMA_HandleTypeDef *u, uint8_t *data, size_t max)
+{
+    // NDTR counts down from UDMA_RX_SIZE and reloads: the DMA write index
+    uint32_t head = UDMA_RX_SIZE - UDMA_RX_STREAM->NDTR;
+    size_t n = 0;
+
+    if (head == UDMA_RX_SIZE) {
+        head = 0;
+    }
+
+    while (u->rx_tail != head && n < max) {
+        data[n++] = u->rx[u->rx_tail];
+        u->rx_tail = (u->rx_tail + 1U) % UDMA_RX_SIZE;
+    }
+
+    return n;
+}
+
+/**
+ * @brief Hand the next contiguous part of the TX ring to the DMA
+ * @note  Does nothing while a chunk is still being sent
+ * @param u: Pointer to UDMA_HandleTypeDef structure
+ */
+static void UDMA_TxKick(UDMA_HandleTypeDef *u)
+{
+    uint32_t start;
+    uint32_t len;
+
+    if ((UDMA_TX_STREAM->CR & DMA_SxCR_EN) != 0U) {
+        return;
+    }
+
+    u->tx_tail += u->tx_chunk;
+    u->tx_chunk = 0;
+    if (u->tx_head == u->tx_tail) {
+        return;
+    }
+
+    start = u->tx_tail % UDMA_TX_SIZE;
+    len = u->tx_head - u->tx_tail;
+    if (len > UDMA_TX_SIZE - start) {
+        len = UDMA_TX_SIZE - start;     // Up to the end of the ring, the rest next time
+    }
+
+    __HAL_DMA_CLEAR_FLAG(&u->hdma_tx, __HAL_DMA_GET_TC_FLAG_INDEX(&u->hdma_tx) |
+                                      __HAL_DMA_GET_HT_FLAG_INDEX(&u->hdma_tx) |
+                                      __HAL_DMA_GET_TE_FLAG_INDEX(&u->hdma_tx) |
+                                      __HAL_DMA_GET_DME_FLAG_INDEX(&u->hdma_tx) |
+                                      __HAL_DMA_GET_FE_FLAG_INDEX(&u->hdma_tx));
+    UDMA_TX_STREAM->M0AR = (uint32_t)&u->tx[start];
+    UDMA_TX_STREAM->NDTR = len;
+    u->tx_chunk = len;
+    UDMA_TX_STREAM->CR |= DMA_SxCR_EN;
+}
+
+/**
+ * @brief Queue bytes for transmission
+ * @note  Never waits: what does not fit in the TX ring is dropped and
+ *        counted in tx_dropped
+ * @param u: Pointer to UDMA_HandleTypeDef structure
+ * @param data: Bytes to send
+ * @param len: Number of bytes
+ * @retval size_t: Bytes queued
+ */
+size_t UDMA_Write(UDMA_HandleTypeDef *u, const uint8_t *data, size_t len)
+{
+    uint32_t space = UDMA_TX_SIZE - (u->tx_head - u->tx_tail);
+    size_t n = (len < space) ? len : space;
+
+    for (size_t i = 0; i < n; i++) {
+        u->tx[(u->tx_head + i) % UDMA_TX_SIZE] = data[i];
+    }
+    u->tx_head += n;
+    u->tx_dropped += len - n;
+
+    UDMA_TxKick(u);
+
+    return n;
+}
+
+/**
+ * @brief Keep transmission going; call from the main loop
+ * @param u: Pointer to UDMA_HandleTypeDef structure
+ */
+void UDMA_Poll(UDMA_HandleTypeDef *u)
+{
+    UDMA_TxKick(u);
+}
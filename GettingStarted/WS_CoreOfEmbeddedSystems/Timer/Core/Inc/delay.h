@@ -0,0 +1,24 @@
+#ifndef DELAY_H
+#define DELAY_H
+
+#include <stdint.h>
+
+// Configuration definitions
+// DELAY_HOST (build flag) keeps only the portable cycle and tick math, for host checks
+#define DELAY_US_PER_S          1000000UL
+#define DELAY_SLEEP_MIN_US      2000        // Adaptive waits shorter than this only spin
+
+// Function prototypes
+uint64_t DELAY_FactorQ32(uint32_t hz);
+uint64_t DELAY_UsToCycles(uint32_t us, uint64_t factor_q32);
+uint64_t DELAY_TickSpan(uint32_t tick0, uint32_t val0, uint32_t tick1, uint32_t val1,
+                        uint32_t load, uint32_t tick_freq);
+
+#if !defined(DELAY_HOST)
+void DELAY_Init(void);
+void DELAY_Cycles(uint32_t cycles);
+void DELAY_Us(uint32_t us);
+void DELAY_UsAdaptive(uint32_t us);
+#endif
+
+#endif /* DELAY_H */
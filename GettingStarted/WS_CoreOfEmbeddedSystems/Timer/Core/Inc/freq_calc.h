@@ -0,0 +1,43 @@
+#ifndef FREQ_CALC_H
+#define FREQ_CALC_H
+
+#include <stdint.h>
+
+// Edge accumulator for one measurement batch
+// Raw captures come from a free-running counter of 'mask + 1' ticks; every
+// single period must be shorter than half that range
+typedef struct {
+    uint32_t mask;          // Counter range - 1 (0xFFFF or 0xFFFFFFFF)
+    uint32_t prev_rise;     // Raw capture of the last rising edge
+    uint32_t timestamp;     // Last rising edge, extended to 32 bits
+    uint8_t primed;         // prev_rise holds a real capture
+    uint32_t cycles;        // Periods accumulated in this batch
+    uint64_t period_sum;    // Sum of the periods (ticks)
+    uint64_t high_sum;      // Sum of the high times (ticks)
+    uint32_t period_min;    // Shortest period of the batch (ticks)
+    uint32_t period_max;    // Longest period of the batch (ticks)
+    uint32_t errors;        // Cycles rejected (high time not inside the period)
+} FCALC_AccumTypeDef;
+
+// Measurement result of a batch
+typedef struct {
+    uint32_t freq_mhz;      // Mean frequency in millihertz (0 = no signal)
+    uint32_t period_ns;     // Mean period in nanoseconds
+    uint32_t duty_ppm;      // Mean duty cycle in parts per million
+    uint32_t jitter_ns;     // Longest minus shortest period in nanoseconds
+    uint32_t cycles;        // Periods averaged
+    uint32_t errors;        // Cycles rejected
+} FCALC_ResultTypeDef;
+
+// Function prototypes
+void FCALC_Init(FCALC_AccumTypeDef *acc, uint8_t counter_bits);
+void FCALC_Restart(FCALC_AccumTypeDef *acc);
+void FCALC_ClearBatch(FCALC_AccumTypeDef *acc);
+uint32_t FCALC_Extend(FCALC_AccumTypeDef *acc, uint32_t raw);
+uint8_t FCALC_FallOffset(uint32_t mask, uint32_t rise0, uint32_t rise1, uint32_t fall0);
+void FCALC_AddCycle(FCALC_AccumTypeDef *acc, uint32_t fall, uint32_t rise);
+uint32_t FCALC_AddRing(FCALC_AccumTypeDef *acc, const uint32_t *rise, const uint32_t *fall,
+                       uint32_t len, uint32_t start, uint32_t end, uint8_t fall_offset);
+void FCALC_GetResult(const FCALC_AccumTypeDef *acc, uint32_t tick_hz, FCALC_ResultTypeDef *result);
+
+#endif /* FREQ_CALC_H */
@@ -0,0 +1,53 @@
+#ifndef FREQ_METER_H
+#define FREQ_METER_H
+
+#include "stm32f4xx_hal.h"
+#include "freq_calc.h"
+
+// Configuration definitions
+#define FREQ_TIM              TIM3                // 16-bit, free running, captures extended in software
+#define FREQ_COUNTER_BITS     16
+#define FREQ_INPUT_PORT       GPIOA               // PA6 = TIM3_CH1 (Arduino D12)
+#define FREQ_INPUT_PIN        GPIO_PIN_6
+#define FREQ_INPUT_AF         GPIO_AF2_TIM3
+#define FREQ_INPUT_FILTER     3                   // fCK_INT, N=8: ignores glitches < ~95 ns
+#define FREQ_RISE_DMA_STREAM  DMA1_Stream4        // TIM3_CH1 request (RM0368 DMA1 mapping)
+#define FREQ_RISE_DMA_CHANNEL DMA_CHANNEL_5
+#define FREQ_RISE_DMA_IRQn    DMA1_Stream4_IRQn
+#define FREQ_FALL_DMA_STREAM  DMA1_Stream5        // TIM3_CH2 request, no interrupt needed
+#define FREQ_FALL_DMA_CHANNEL DMA_CHANNEL_5
+#define FREQ_IRQ_PRIORITY     2
+#define FREQ_BUFFER_LEN       256                 // Captures per edge ring (two halves)
+
+// Frequency meter structure
+typedef struct {
+    TIM_HandleTypeDef htim;             // Capture timer
+    DMA_HandleTypeDef hdma_rise;        // CCR1 -> rise[] (rising edges, TI1 direct)
+    DMA_HandleTypeDef hdma_fall;        // CCR2 -> fall[] (falling edges, TI1 indirect)
+    uint32_t rise[FREQ_BUFFER_LEN];     // Rising-edge captures
+    uint32_t fall[FREQ_BUFFER_LEN];     // Falling-edge captures
+    FCALC_AccumTypeDef acc;             // Current batch
+    FCALC_ResultTypeDef result;         // Last reported batch
+    uint32_t tick_hz;                   // Counter tick rate
+    uint32_t next_rise;                 // Next rising index to consume
+    uint32_t captured;                  // Rising captures seen before alignment
+    uint8_t fall_offset;                // See FCALC_FallOffset
+    uint8_t aligned;                    // fall_offset is known
+    uint32_t report_ms;                 // Batch length
+    uint32_t last_report;               // HAL tick of the last report
+} FREQ_HandleTypeDef;
+
+// Frequency meter states
+typedef enum {
+    FREQ_OK = 0,        // Operation successful
+    FREQ_ERROR = 1      // Operation failed
+} FREQ_StatusTypeDef;
+
+// Function prototypes
+FREQ_StatusTypeDef FREQ_Init(FREQ_HandleTypeDef *meter, uint16_t prescaler, uint32_t report_ms);
+FREQ_StatusTypeDef FREQ_Start(FREQ_HandleTypeDef *meter);
+FREQ_StatusTypeDef FREQ_Stop(FREQ_HandleTypeDef *meter);
+uint8_t FREQ_Poll(FREQ_HandleTypeDef *meter);
+const FCALC_ResultTypeDef *FREQ_GetResult(const FREQ_HandleTypeDef *meter);
+
+#endif /* FREQ_METER_H */
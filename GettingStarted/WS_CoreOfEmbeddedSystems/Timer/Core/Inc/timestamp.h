@@ -0,0 +1,24 @@
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include <stdint.h>
+
+// Configuration definitions
+// Backend selection (build flags):
+//   default      DWT->CYCCNT, core clock resolution; stops while the core sleeps
+//   TS_USE_TIM5  TIM5 free running at the APB1 timer clock; keeps counting in sleep
+//   TS_HOST      clock_gettime(CLOCK_MONOTONIC), 1 ns ticks, for host builds
+#define TS_NS_PER_S     1000000000ULL
+
+// Function prototypes
+void TS_Init(void);
+void TS_Update(void);
+uint32_t TS_GetHz(void);
+uint32_t TS_NowCycles32(void);
+uint64_t TS_NowCycles(void);
+uint64_t TS_NowNs(void);
+uint64_t TS_NowUs(void);
+uint64_t TS_CyclesToNs(uint64_t cycles);
+uint64_t TS_NsToCycles(uint64_t ns);
+
+#endif /* TIMESTAMP_H */
@@ -0,0 +1,189 @@
+#include "delay.h"
+
+#if !defined(DELAY_HOST)
+#include "stm32f4xx_hal.h"
+
+static uint32_t delay_hz;               // SystemCoreClock the factor was computed for
+static uint64_t delay_factor_q32;       // Core cycles per microsecond (Q32)
+#endif
+
+/**
+ * @brief Compute the cycles-per-microsecond factor of a clock
+ * @note  Rounded up, so conversions never come out short. Uses a 64-bit
+ *        division: call it on clock changes, not per delay
+ * @param hz: Clock frequency
+ * @retval uint64_t: Cycles per microsecond (Q32)
+ */
+uint64_t DELAY_FactorQ32(uint32_t hz)
+{
+    return (((uint64_t)hz << 32) + DELAY_US_PER_S - 1U) / DELAY_US_PER_S;
+}
+
+/**
+ * @brief Convert microseconds to cycles, rounding up
+ * @note  Two 32x32 multiplies, no division. The result is the exact
+ *        ceil(us * hz / 1e6), or one more when the factor rounding adds up
+ * @param us: Microseconds
+ * @param factor_q32: Result of DELAY_FactorQ32
+ * @retval uint64_t: Cycles
+ */
+uint64_t DELAY_UsToCycles(uint32_t us, uint64_t factor_q32)
+{
+    uint64_t whole = (uint64_t)us * (uint32_t)(factor_q32 >> 32);
+    uint64_t frac = (uint64_t)us * (uint32_t)factor_q32;
+
+    return whole + ((frac + 0xFFFFFFFFULL) >> 32);
+}
+
+/**
+ * @brief Count the SysTick clocks between two tick snapshots
+ * @note  Works on the tick difference, so the 32-bit HAL tick may wrap
+ *        between the snapshots (or before the first one) without effect
+ * @param tick0: HAL tick of the first snapshot
+ * @param val0: SysTick->VAL read within tick0
+ * @param tick1: HAL tick of the second snapshot
+ * @param val1: SysTick->VAL read within tick1
+ * @param load: SysTick->LOAD
+ * @param tick_freq: HAL tick increment per interrupt (HAL_GetTickFreq())
+ * @retval uint64_t: SysTick clocks elapsed
+ */
+uint64_t DELAY_TickSpan(uint32_t tick0, uint32_t val0, uint32_t tick1, uint32_t val1,
+                        uint32_t load, uint32_t tick_freq)
+{
+    uint32_t reloads = (tick1 - tick0) / tick_freq;
+
+    return (uint64_t)reloads * (load + 1U) + val0 - val1;
+}
+
+#if !defined(DELAY_HOST)
+/**
+ * @brief Get the factor for the current core clock
+ * @note  SystemCoreClock is compared on every call, so delays stay right
+ *        after HAL_RCC_ClockConfig or SystemCoreClockUpdate without any
+ *        explicit re-initialization. The factor is stored before the clock
+ *        it belongs to, so an interrupting caller never pairs a new clock
+ *        with an old factor
+ * @retval uint64_t: Cycles per microsecond (Q32)
+ */
+static uint64_t DELAY_Factor(void)
+{
+    uint32_t hz = SystemCoreClock;
+
+    if (hz != delay_hz) {
+        delay_factor_q32 = DELAY_FactorQ32(hz);
+        delay_hz = hz;
+    }
+
+    return delay_factor_q32;
+}
+
+/**
+ * @brief Spin for a 64-bit number of core cycles
+ * @note  Elapsed time is accumulated across counter wraps, so the wait has
+ *        no length limit and no per-chunk error
+ * @param cycles: Core cycles to wait
+ */
+static void DELAY_Spin(uint64_t cycles)
+{
+    uint32_t last = DWT->CYCCNT;
+    uint64_t elapsed = 0;
+
+    while (elapsed < cycles) {
+        uint32_t now = DWT->CYCCNT;
+        elapsed += now - last;
+        last = now;
+    }
+}
+
+/**
+ * @brief Take a snapshot of the HAL tick and the SysTick down-counter
+ * @note  DWT->CYCCNT stops while the core sleeps, SysTick does not. The
+ *        tick is read twice so a reload between the two reads is detected.
+ *        Needs the SysTick interrupt to be able to run, i.e. thread context
+ *        with interrupts enabled
+ * @param tick: HAL tick
+ * @param val: SysTick->VAL read within that tick
+ */
+static void DELAY_SysTickRead(uint32_t *tick, uint32_t *val)
+{
+    do {
+        *tick = HAL_GetTick();
+        *val = SysTick->VAL;
+    } while (*tick != HAL_GetTick());
+}
+
+/**
+ * @brief Enable the cycle counter
+ * @note  Safe to call more than once; the counter is never reset
+ */
+void DELAY_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    (void)DELAY_Factor();
+}
+
+/**
+ * @brief Busy-wait at least a number of core cycles
+ * @note  Overshoot is the call overhead plus one loop pass (~10 cycles)
+ * @param cycles: Core cycles to wait
+ */
+void DELAY_Cycles(uint32_t cycles)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    while (DWT->CYCCNT - start < cycles) {
+    }
+}
+
+/**
+ * @brief Busy-wait at least a number of microseconds
+ * @note  Unlike HAL_Delay no tick is added: the wait ends as soon as the
+ *        time is up. Interrupts taken meanwhile count towards the wait
+ * @param us: Microseconds to wait
+ */
+void DELAY_Us(uint32_t us)
+{
+    DELAY_Spin(DELAY_UsToCycles(us, DELAY_Factor()));
+}
+
+/**
+ * @brief Wait at least a number of microseconds, sleeping when worthwhile
+ * @note  Waits of DELAY_SLEEP_MIN_US or more sleep (WFI) while a full tick
+ *        period remains, then spin on the cycle counter for the rest; the
+ *        SysTick interrupt bounds every sleep, so the deadline is never
+ *        overslept. Shorter waits, or calls without a running SysTick
+ *        interrupt, only spin. Thread context only. A debugger may lose
+ *        the core in sleep unless DBGMCU sleep debugging is enabled
+ * @param us: Microseconds to wait
+ */
+void DELAY_UsAdaptive(uint32_t us)
+{
+    const uint32_t running = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+
+    if (us < DELAY_SLEEP_MIN_US || (SysTick->CTRL & running) != running || __get_PRIMASK() != 0U) {
+        DELAY_Us(us);
+        return;
+    }
+
+    uint32_t shift = (SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) ? 0U : 3U;
+    uint32_t load = SysTick->LOAD;
+    uint32_t freq = HAL_GetTickFreq();
+    int64_t period = (int64_t)(load + 1U) << shift;
+    uint64_t cycles = DELAY_UsToCycles(us, DELAY_Factor());
+    uint32_t tick0, val0, tick, val;
+
+    DELAY_SysTickRead(&tick0, &val0);
+    int64_t left = (int64_t)cycles;
+
+    while (left > period) {
+        __WFI();
+        DELAY_SysTickRead(&tick, &val);
+        left = (int64_t)(cycles - (DELAY_TickSpan(tick0, val0, tick, val, load, freq) << shift));
+    }
+
+    if (left > 0) {
+        DELAY_Spin((uint64_t)left);
+    }
+}
+#endif
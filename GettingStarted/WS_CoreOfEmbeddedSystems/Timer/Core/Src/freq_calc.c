@@ -0,0 +1,185 @@
+#include "freq_calc.h"
+#include <stddef.h>
+
+/**
+ * @brief Initialize an edge accumulator
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ * @param counter_bits: Width of the capture counter (16 or 32)
+ */
+void FCALC_Init(FCALC_AccumTypeDef *acc, uint8_t counter_bits)
+{
+    if (acc == NULL) {
+        return;
+    }
+
+    acc->mask = (counter_bits >= 32U) ? 0xFFFFFFFFUL : ((1UL << counter_bits) - 1U);
+    acc->timestamp = 0;
+    acc->primed = 0;
+    FCALC_ClearBatch(acc);
+}
+
+/**
+ * @brief Forget the last edge, e.g. after captures were lost
+ * @note  The next rising edge only re-primes the accumulator; the batch
+ *        totals and the extended timestamp are kept
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ */
+void FCALC_Restart(FCALC_AccumTypeDef *acc)
+{
+    if (acc == NULL) {
+        return;
+    }
+
+    acc->primed = 0;
+}
+
+/**
+ * @brief Start a new batch, keeping the edge history
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ */
+void FCALC_ClearBatch(FCALC_AccumTypeDef *acc)
+{
+    if (acc == NULL) {
+        return;
+    }
+
+    acc->cycles = 0;
+    acc->period_sum = 0;
+    acc->high_sum = 0;
+    acc->period_min = UINT32_MAX;
+    acc->period_max = 0;
+    acc->errors = 0;
+}
+
+/**
+ * @brief Extend a raw capture taken after the last rising edge to 32 bits
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ * @param raw: Raw counter capture
+ * @retval uint32_t: Capture on the 32-bit extended time base
+ */
+uint32_t FCALC_Extend(FCALC_AccumTypeDef *acc, uint32_t raw)
+{
+    return acc->timestamp + ((raw - acc->prev_rise) & acc->mask);
+}
+
+/**
+ * @brief Find which falling capture belongs to the first rising period
+ * @note  Rising and falling edges are captured by two channels started at
+ *        the same time, so the first capture may be of either polarity
+ * @param mask: Counter range - 1
+ * @param rise0: First rising capture
+ * @param rise1: Second rising capture
+ * @param fall0: First falling capture
+ * @retval uint8_t: 0 if fall0 lies between rise0 and rise1, 1 if it precedes rise0
+ */
+uint8_t FCALC_FallOffset(uint32_t mask, uint32_t rise0, uint32_t rise1, uint32_t fall0)
+{
+    uint32_t period = (rise1 - rise0) & mask;
+    uint32_t high = (fall0 - rise0) & mask;
+
+    return (high < period) ? 0U : 1U;
+}
+
+/**
+ * @brief Account for one signal period
+ * @note  The period starts at the previous rising edge, 'fall' is the
+ *        falling edge inside it and 'rise' ends it. The first call only
+ *        primes the accumulator
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ * @param fall: Raw falling-edge capture
+ * @param rise: Raw rising-edge capture ending the period
+ */
+void FCALC_AddCycle(FCALC_AccumTypeDef *acc, uint32_t fall, uint32_t rise)
+{
+    if (!acc->primed) {
+        acc->prev_rise = rise;
+        acc->primed = 1;
+        return;
+    }
+
+    uint32_t period = (rise - acc->prev_rise) & acc->mask;
+    uint32_t high = (fall - acc->prev_rise) & acc->mask;
+
+    acc->timestamp += period;
+    acc->prev_rise = rise;
+
+    if (period == 0U || high == 0U || high >= period) {
+        acc->errors++;
+        return;
+    }
+
+    acc->cycles++;
+    acc->period_sum += period;
+    acc->high_sum += high;
+    if (period < acc->period_min) {
+        acc->period_min = period;
+    }
+    if (period > acc->period_max) {
+        acc->period_max = period;
+    }
+}
+
+/**
+ * @brief Account for the periods ending at rise[start..end) of capture rings
+ * @note  Period i starts at rise[i - 1], contains fall[i - 1 + fall_offset]
+ *        and ends at rise[i]; all indices wrap at 'len'
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ * @param rise: Ring of raw rising-edge captures
+ * @param fall: Ring of raw falling-edge captures
+ * @param len: Ring length
+ * @param start: First rising index to consume
+ * @param end: Rising index to stop at (exclusive)
+ * @param fall_offset: Result of FCALC_FallOffset
+ * @retval uint32_t: Next rising index to consume (== end)
+ */
+uint32_t FCALC_AddRing(FCALC_AccumTypeDef *acc, const uint32_t *rise, const uint32_t *fall,
+                       uint32_t len, uint32_t start, uint32_t end, uint8_t fall_offset)
+{
+    uint32_t i = start;
+
+    while (i != end) {
+        uint32_t f = i + fall_offset + len - 1U;
+        if (f >= len) {
+            f -= len;
+        }
+        FCALC_AddCycle(acc, fall[f], rise[i]);
+        if (++i >= len) {
+            i = 0;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * @brief Compute the averages of the current batch
+ * @param acc: Pointer to FCALC_AccumTypeDef structure
+ * @param tick_hz: Counter tick rate (timer clock / (PSC + 1))
+ * @param result: Pointer to the result to fill
+ */
+void FCALC_GetResult(const FCALC_AccumTypeDef *acc, uint32_t tick_hz, FCALC_ResultTypeDef *result)
+{
+    if (acc == NULL || result == NULL) {
+        return;
+    }
+
+    result->cycles = acc->cycles;
+    result->errors = acc->errors;
+
+    if (acc->cycles == 0U || acc->period_sum == 0U || tick_hz == 0U) {
+        result->freq_mhz = 0;
+        result->period_ns = 0;
+        result->duty_ppm = 0;
+        result->jitter_ns = 0;
+        return;
+    }
+
+    uint64_t freq = ((uint64_t)tick_hz * 1000U * acc->cycles + acc->period_sum / 2U) / acc->period_sum;
+    uint64_t mean_milli_ticks = (acc->period_sum * 1000U) / acc->cycles;
+    uint64_t period = (mean_milli_ticks * 1000000U + tick_hz / 2U) / tick_hz;
+
+    result->freq_mhz = (freq > UINT32_MAX) ? UINT32_MAX : (uint32_t)freq;
+    result->period_ns = (period > UINT32_MAX) ? UINT32_MAX : (uint32_t)period;
+    result->duty_ppm = (uint32_t)((acc->high_sum * 1000000U + acc->period_sum / 2U) / acc->period_sum);
+    result->jitter_ns = (uint32_t)(((uint64_t)(acc->period_max - acc->period_min) * 1000000000U) / tick_hz);
+}
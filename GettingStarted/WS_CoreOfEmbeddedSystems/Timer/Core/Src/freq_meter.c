@@ -0,0 +1,271 @@
+#include "freq_meter.h"
+#include <string.h>
+
+/**
+ * @brief Get the tick rate of the capture counter
+ * @note  APB1 timers run at twice the bus clock when the APB prescaler is not 1
+ * @param prescaler: Counter prescaler (PSC)
+ * @retval uint32_t: Counter ticks per second
+ */
+static uint32_t FREQ_TickRate(uint16_t prescaler)
+{
+    uint32_t clk = HAL_RCC_GetPCLK1Freq();
+
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        clk *= 2U;
+    }
+
+    return clk / ((uint32_t)prescaler + 1U);
+}
+
+/**
+ * @brief Consume every rising capture written by the DMA so far
+ * @note  Runs in the rising-edge DMA interrupt, or from thread context with
+ *        that interrupt masked
+ * @param meter: Pointer to FREQ_HandleTypeDef structure
+ */
+static void FREQ_Process(FREQ_HandleTypeDef *meter)
+{
+    uint32_t write = FREQ_BUFFER_LEN - __HAL_DMA_GET_COUNTER(&meter->hdma_rise);
+
+    if (write >= FREQ_BUFFER_LEN) {
+        write = 0;
+    }
+
+    if (!meter->aligned) {
+        // Both rings fill from index 0; two rising edges decide the pairing
+        if (write < 2U) {
+            return;
+        }
+        meter->fall_offset = FCALC_FallOffset(meter->acc.mask, meter->rise[0],
+                                              meter->rise[1], meter->fall[0]);
+        meter->aligned = 1;
+        meter->next_rise = 0;
+    }
+
+    meter->next_rise = FCALC_AddRing(&meter->acc, meter->rise, meter->fall, FREQ_BUFFER_LEN,
+                                     meter->next_rise, write, meter->fall_offset);
+}
+
+/**
+ * @brief DMA half-transfer callback of the rising-edge stream
+ * @param hdma: DMA handle (Parent points to the meter)
+ */
+static void FREQ_DmaHalfCplt(DMA_HandleTypeDef *hdma)
+{
+    FREQ_Process((FREQ_HandleTypeDef *)hdma->Parent);
+}
+
+/**
+ * @brief DMA transfer-complete callback of the rising-edge stream
+ * @param hdma: DMA handle (Parent points to the meter)
+ */
+static void FREQ_DmaCplt(DMA_HandleTypeDef *hdma)
+{
+    FREQ_Process((FREQ_HandleTypeDef *)hdma->Parent);
+}
+
+/**
+ * @brief Configure one capture DMA stream (CCRx -> ring, circular, words)
+ * @param hdma: DMA handle to configure
+ * @param stream: DMA stream instance
+ * @param channel: DMA channel selection
+ * @retval FREQ_StatusTypeDef: Operation status
+ */
+static FREQ_StatusTypeDef FREQ_DmaInit(DMA_HandleTypeDef *hdma, DMA_Stream_TypeDef *stream,
+                                       uint32_t channel)
+{
+    hdma->Instance = stream;
+    hdma->Init.Channel = channel;
+    hdma->Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma->Init.MemInc = DMA_MINC_ENABLE;
+    hdma->Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    hdma->Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    hdma->Init.Mode = DMA_CIRCULAR;
+    hdma->Init.Priority = DMA_PRIORITY_HIGH;
+    hdma->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+    return (HAL_DMA_Init(hdma) == HAL_OK) ? FREQ_OK : FREQ_ERROR;
+}
+
+/**
+ * @brief Initialize the frequency meter on TIM3 channel 1 (PA6)
+ * @note  Channel 1 captures rising edges and channel 2 falling edges of the
+ *        same input (TI1); each channel has its own DMA ring. Every signal
+ *        period must be shorter than half the counter range: 390 us with
+ *        prescaler 0 at 84 MHz, raise the prescaler for slower signals
+ * @param meter: Pointer to FREQ_HandleTypeDef structure
+ * @param prescaler: Counter prescaler (tick = timer clock / (prescaler + 1))
+ * @param report_ms: Batch length, one result per batch
+ * @retval FREQ_StatusTypeDef: Operation status
+ */
+FREQ_StatusTypeDef FREQ_Init(FREQ_HandleTypeDef *meter, uint16_t prescaler, uint32_t report_ms)
+{
+    GPIO_InitTypeDef gpio = {0};
+    TIM_IC_InitTypeDef ic = {0};
+
+    if (meter == NULL || report_ms == 0U) {
+        return FREQ_ERROR;
+    }
+
+    memset(meter, 0, sizeof(*meter));
+    meter->tick_hz = FREQ_TickRate(prescaler);
+    meter->report_ms = report_ms;
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    __HAL_RCC_TIM3_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    gpio.Pin = FREQ_INPUT_PIN;
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    gpio.Alternate = FREQ_INPUT_AF;
+    HAL_GPIO_Init(FREQ_INPUT_PORT, &gpio);
+
+    meter->htim.Instance = FREQ_TIM;
+    meter->htim.Init.Prescaler = prescaler;
+    meter->htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+    meter->htim.Init.Period = (FREQ_COUNTER_BITS >= 32) ? 0xFFFFFFFFUL
+                                                        : (1UL << FREQ_COUNTER_BITS) - 1U;
+    meter->htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    meter->htim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_IC_Init(&meter->htim) != HAL_OK) {
+        return FREQ_ERROR;
+    }
+
+    ic.ICPrescaler = TIM_ICPSC_DIV1;
+    ic.ICFilter = FREQ_INPUT_FILTER;
+    ic.ICPolarity = TIM_INPUTCHANNELPOLARITY_RISING;
+    ic.ICSelection = TIM_ICSELECTION_DIRECTTI;
+    if (HAL_TIM_IC_ConfigChannel(&meter->htim, &ic, TIM_CHANNEL_1) != HAL_OK) {
+        return FREQ_ERROR;
+    }
+    ic.ICPolarity = TIM_INPUTCHANNELPOLARITY_FALLING;
+    ic.ICSelection = TIM_ICSELECTION_INDIRECTTI;
+    if (HAL_TIM_IC_ConfigChannel(&meter->htim, &ic, TIM_CHANNEL_2) != HAL_OK) {
+        return FREQ_ERROR;
+    }
+
+    if (FREQ_DmaInit(&meter->hdma_rise, FREQ_RISE_DMA_STREAM, FREQ_RISE_DMA_CHANNEL) != FREQ_OK ||
+        FREQ_DmaInit(&meter->hdma_fall, FREQ_FALL_DMA_STREAM, FREQ_FALL_DMA_CHANNEL) != FREQ_OK) {
+        return FREQ_ERROR;
+    }
+    meter->hdma_rise.Parent = meter;
+    meter->hdma_rise.XferHalfCpltCallback = FREQ_DmaHalfCplt;
+    meter->hdma_rise.XferCpltCallback = FREQ_DmaCplt;
+
+    HAL_NVIC_SetPriority(FREQ_RISE_DMA_IRQn, FREQ_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(FREQ_RISE_DMA_IRQn);
+
+    return FREQ_OK;
+}
+
+/**
+ * @brief Start capturing
+ * @note  The DMA streams are armed first and both capture channels are
+ *        enabled by a single register write, so the two rings hold the same
+ *        edges; the HAL IC start functions would enable them one at a time
+ * @param meter: Pointer to FREQ_HandleTypeDef structure
+ * @retval FREQ_StatusTypeDef: Operation status
+ */
+FREQ_StatusTypeDef FREQ_Start(FREQ_HandleTypeDef *meter)
+{
+    if (meter == NULL) {
+        return FREQ_ERROR;
+    }
+
+    TIM_TypeDef *tim = meter->htim.Instance;
+
+    FCALC_Init(&meter->acc, FREQ_COUNTER_BITS);
+    meter->aligned = 0;
+    meter->next_rise = 0;
+    meter->last_report = HAL_GetTick();
+
+    if (HAL_DMA_Start_IT(&meter->hdma_rise, (uint32_t)&tim->CCR1, (uint32_t)meter->rise,
+                         FREQ_BUFFER_LEN) != HAL_OK ||
+        HAL_DMA_Start(&meter->hdma_fall, (uint32_t)&tim->CCR2, (uint32_t)meter->fall,
+                      FREQ_BUFFER_LEN) != HAL_OK) {
+        return FREQ_ERROR;
+    }
+
+    tim->CNT = 0;
+    tim->SR = 0;
+    SET_BIT(tim->DIER, TIM_DIER_CC1DE | TIM_DIER_CC2DE);
+    SET_BIT(tim->CCER, TIM_CCER_CC1E | TIM_CCER_CC2E);
+    SET_BIT(tim->CR1, TIM_CR1_CEN);
+
+    return FREQ_OK;
+}
+
+/**
+ * @brief Stop capturing
+ * @param meter: Pointer to FREQ_HandleTypeDef structure
+ * @retval FREQ_StatusTypeDef: Operation status
+ */
+FREQ_StatusTypeDef FREQ_Stop(FREQ_HandleTypeDef *meter)
+{
+    if (meter == NULL) {
+        return FREQ_ERROR;
+    }
+
+    TIM_TypeDef *tim = meter->htim.Instance;
+
+    CLEAR_BIT(tim->CR1, TIM_CR1_CEN);
+    CLEAR_BIT(tim->CCER, TIM_CCER_CC1E | TIM_CCER_CC2E);
+    CLEAR_BIT(tim->DIER, TIM_DIER_CC1DE | TIM_DIER_CC2DE);
+
+    if (HAL_DMA_Abort(&meter->hdma_rise) != HAL_OK || HAL_DMA_Abort(&meter->hdma_fall) != HAL_OK) {
+        return FREQ_ERROR;
+    }
+
+    return FREQ_OK;
+}
+
+/**
+ * @brief Close the current batch when report_ms has elapsed
+ * @note  Call from the main loop. A batch without any edge re-primes the
+ *        edge history (a long gap is ambiguous on a wrapping counter); a
+ *        batch with more rejected than good cycles restarts the capture,
+ *        since the two rings are no longer in step
+ * @param meter: Pointer to FREQ_HandleTypeDef structure
+ * @retval uint8_t: 1 if a new result is available, 0 otherwise
+ */
+uint8_t FREQ_Poll(FREQ_HandleTypeDef *meter)
+{
+    if (meter == NULL || HAL_GetTick() - meter->last_report < meter->report_ms) {
+        return 0;
+    }
+    meter->last_report += meter->report_ms;
+
+    FCALC_AccumTypeDef batch;
+
+    HAL_NVIC_DisableIRQ(FREQ_RISE_DMA_IRQn);
+    FREQ_Process(meter);
+    batch = meter->acc;
+    FCALC_ClearBatch(&meter->acc);
+    if (batch.cycles == 0U && batch.errors == 0U) {
+        FCALC_Restart(&meter->acc);
+    }
+    HAL_NVIC_EnableIRQ(FREQ_RISE_DMA_IRQn);
+
+    FCALC_GetResult(&batch, meter->tick_hz, &meter->result);
+
+    if (batch.errors > batch.cycles) {
+        FREQ_Stop(meter);
+        FREQ_Start(meter);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Get the result of the last completed batch
+ * @param meter: Pointer to FREQ_HandleTypeDef structure
+ * @retval const FCALC_ResultTypeDef*: Last result
+ */
+const FCALC_ResultTypeDef *FREQ_GetResult(const FREQ_HandleTypeDef *meter)
+{
+    return &meter->result;
+}
@@ -22,6 +22,9 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
+#include "freq_meter.h"
+#include "timestamp.h"
+#include "delay.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -31,7 +34,8 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-
+#define FREQ_PRESCALER  0       // 84 MHz ticks: periods up to 390 us (> 2.6 kHz)
+#define FREQ_REPORT_MS  500     // One averaged result per batch
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -45,7 +49,7 @@ TIM_HandleTypeDef htim11;
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
-
+FREQ_HandleTypeDef freq_meter;  // Signal input on PA6 (TIM3_CH1)
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -54,7 +58,8 @@ static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_TIM11_Init(void);
 /* USER CODE BEGIN PFP */
-
+static void ReportFrequency(void);
+static void ReportDelays(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -72,7 +77,6 @@ int main(void)
   /* USER CODE BEGIN 1 */
 	char uart_buf[50];
 	int uart_buff_len;
-	uint16_t timer_val;
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -88,7 +92,8 @@ int main(void)
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
-
+  TS_Init();
+  DELAY_Init();
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
@@ -99,8 +104,12 @@ int main(void)
   // SPLASH MESSAGE
   uart_buff_len = sprintf(uart_buf, "Timer\r\n");
   HAL_UART_Transmit(&huart2, (uint8_t *)uart_buf, uart_buff_len, HAL_MAX_DELAY);
-  // Starting the timer
-  HAL_TIM_Base_Start(&htim11);
+  ReportDelays();
+  // Starting the input-capture meter
+  if (FREQ_Init(&freq_meter, FREQ_PRESCALER, FREQ_REPORT_MS) != FREQ_OK ||
+      FREQ_Start(&freq_meter) != FREQ_OK) {
+    Error_Handler();
+  }
 
   /* USER CODE END 2 */
 
@@ -108,14 +117,10 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-	  timer_val = __HAL_TIM_GET_COUNTER(&htim11);
-	  HAL_Delay(50); //ms
-	  timer_val = __HAL_TIM_GET_COUNTER(&htim11) - timer_val;
-
-	  uart_buff_len = sprintf(uart_buf, "%u us\r\n", timer_val);
-	  HAL_UART_Transmit(&huart2, (uint8_t *)uart_buf, uart_buff_len, HAL_MAX_DELAY);
-
-	  HAL_Delay(1000); //ms
+	  // Edges are collected by DMA; the loop only closes finished batches
+	  if (FREQ_Poll(&freq_meter)) {
+		  ReportFrequency();
+	  }
 	  /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -273,6 +278,55 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Time HAL_Delay against the microsecond delays and print the result
+  * @note   Measured with the DWT time base, which stops in sleep, so the
+  *         adaptive delay is not measured here
+  * @retval None
+  */
+static void ReportDelays(void)
+{
+  char msg[96];
+  int len;
+  uint64_t t0 = TS_NowCycles();
+  HAL_Delay(50);
+  uint64_t t1 = TS_NowCycles();
+  DELAY_Us(50000);
+  uint64_t t2 = TS_NowCycles();
+  DELAY_Us(10);
+  uint64_t t3 = TS_NowCycles();
+
+  len = snprintf(msg, sizeof(msg), "HAL_Delay(50)=%lu us DELAY_Us(50000)=%lu us DELAY_Us(10)=%lu ns\r\n",
+                 (uint32_t)(TS_CyclesToNs(t1 - t0) / 1000U), (uint32_t)(TS_CyclesToNs(t2 - t1) / 1000U),
+                 (uint32_t)TS_CyclesToNs(t3 - t2));
+  HAL_UART_Transmit(&huart2, (uint8_t *)msg, len, HAL_MAX_DELAY);
+}
+
+/**
+  * @brief  Print the last frequency meter batch over USART2
+  * @retval None
+  */
+static void ReportFrequency(void)
+{
+  char msg[128];
+  int len;
+  const FCALC_ResultTypeDef *res = FREQ_GetResult(&freq_meter);
+  uint64_t now_us = TS_NowUs();
+  uint32_t sec = (uint32_t)(now_us / 1000000U);
+  uint32_t usec = (uint32_t)(now_us % 1000000U);
+
+  len = snprintf(msg, sizeof(msg), "[%lu.%06lu] ", sec, usec);
+  if (res->cycles == 0U) {
+    len += snprintf(msg + len, sizeof(msg) - len, "no signal (errors=%lu)\r\n", res->errors);
+  } else {
+    len += snprintf(msg + len, sizeof(msg) - len, "f=%lu.%03lu Hz T=%lu ns duty=%lu.%02lu %% jitter=%lu ns n=%lu err=%lu\r\n",
+                    res->freq_mhz / 1000U, res->freq_mhz % 1000U, res->period_ns,
+                    res->duty_ppm / 10000U, (res->duty_ppm / 100U) % 100U,
+                    res->jitter_ns, res->cycles, res->errors);
+  }
+  HAL_UART_Transmit(&huart2, (uint8_t *)msg, len, HAL_MAX_DELAY);
+}
+
 
 /* USER CODE END 4 */
 
@@ -0,0 +1,184 @@
+#include "timestamp.h"
+
+#if defined(TS_HOST)
+#include <time.h>
+#else
+#include "stm32f4xx_hal.h"
+#endif
+
+static uint32_t ts_hz;                  // Counter ticks per second
+static uint64_t ts_ns_per_cycle_q32;    // 1e9 / hz in Q32
+static uint64_t ts_cycles_per_ns_q32;   // hz / 1e9 in Q32
+
+#if !defined(TS_HOST)
+// Bits 62..31 of the 64-bit count at the last refresh. One bit overlaps the
+// 32-bit hardware counter, which is enough to detect a wrap as long as the
+// word is refreshed at least once per half counter range (~25 s at 84 MHz)
+static volatile uint32_t ts_epoch;
+#endif
+
+/**
+ * @brief Multiply by a Q32 factor: (x * m) >> 32 without 128-bit arithmetic
+ * @param x: Value to scale
+ * @param m: Q32 factor
+ * @retval uint64_t: Scaled value
+ */
+static uint64_t TS_MulQ32(uint64_t x, uint64_t m)
+{
+    uint64_t xl = (uint32_t)x;
+    uint64_t xh = x >> 32;
+    uint64_t ml = (uint32_t)m;
+    uint64_t mh = m >> 32;
+
+    return xh * m + xl * mh + ((xl * ml) >> 32);
+}
+
+/**
+ * @brief Read the raw 32-bit hardware counter
+ * @retval uint32_t: Counter value
+ */
+static inline uint32_t TS_ReadCounter(void)
+{
+#if defined(TS_HOST)
+    return (uint32_t)TS_NowCycles();
+#elif defined(TS_USE_TIM5)
+    return TIM5->CNT;
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/**
+ * @brief Start the counter and compute the conversion factors
+ * @note  Call once after SystemClock_Config, and again after any clock
+ *        change (stamps taken before the change keep the old scale)
+ */
+void TS_Init(void)
+{
+#if defined(TS_HOST)
+    ts_hz = 1000000000UL;
+#elif defined(TS_USE_TIM5)
+    uint32_t clk = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        clk *= 2U;
+    }
+    ts_hz = clk;
+
+    __HAL_RCC_TIM5_CLK_ENABLE();
+    if ((TIM5->CR1 & TIM_CR1_CEN) == 0U) {
+        TIM5->PSC = 0;
+        TIM5->ARR = 0xFFFFFFFFUL;
+        TIM5->EGR = TIM_EGR_UG;
+        TIM5->CR1 = TIM_CR1_CEN;
+    }
+#else
+    ts_hz = HAL_RCC_GetHCLKFreq();
+
+    // The counter may already run (debugger, earlier init): never reset it
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    ts_ns_per_cycle_q32 = ((TS_NS_PER_S << 32) + ts_hz / 2U) / ts_hz;
+    ts_cycles_per_ns_q32 = (((uint64_t)ts_hz << 32) + TS_NS_PER_S / 2U) / TS_NS_PER_S;
+
+#if !defined(TS_HOST)
+    ts_epoch = TS_ReadCounter() >> 31;
+#endif
+}
+
+/**
+ * @brief Refresh the overflow extension
+ * @note  Must run at least once per half counter range; calling it from
+ *        SysTick_Handler is plenty. Any TS_Now* call refreshes it as well
+ */
+void TS_Update(void)
+{
+    (void)TS_NowCycles();
+}
+
+/**
+ * @brief Get the counter rate
+ * @retval uint32_t: Ticks per second
+ */
+uint32_t TS_GetHz(void)
+{
+    return ts_hz;
+}
+
+/**
+ * @brief Read the raw counter, for short intervals (wraps after 2^32 ticks)
+ * @retval uint32_t: Counter value
+ */
+uint32_t TS_NowCycles32(void)
+{
+    return TS_ReadCounter();
+}
+
+/**
+ * @brief Read the 64-bit monotonic tick count
+ * @note  Lock-free and safe from any context: the epoch is read before the
+ *        counter and both are single 32-bit accesses. The epoch bit that
+ *        overlaps counter bit 31 tells whether the counter crossed a half
+ *        range since the refresh. Concurrent refreshes may store an older
+ *        epoch, which stays valid until the next refresh
+ * @retval uint64_t: Ticks since the counter started
+ */
+uint64_t TS_NowCycles(void)
+{
+#if defined(TS_HOST)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * TS_NS_PER_S + (uint64_t)ts.tv_nsec;
+#else
+    uint32_t epoch = ts_epoch;
+    uint32_t lo = TS_ReadCounter();
+
+    if ((epoch ^ (lo >> 31)) & 1U) {
+        epoch++;
+    }
+    ts_epoch = epoch;
+
+    return ((uint64_t)epoch << 31) | (lo & 0x7FFFFFFFUL);
+#endif
+}
+
+/**
+ * @brief Read the monotonic time in nanoseconds
+ * @retval uint64_t: Nanoseconds since the counter started
+ */
+uint64_t TS_NowNs(void)
+{
+    return TS_CyclesToNs(TS_NowCycles());
+}
+
+/**
+ * @brief Read the monotonic time in microseconds
+ * @retval uint64_t: Microseconds since the counter started
+ */
+uint64_t TS_NowUs(void)
+{
+    return TS_CyclesToNs(TS_NowCycles()) / 1000U;
+}
+
+/**
+ * @brief Convert ticks to nanoseconds
+ * @note  Multiply-shift by a precomputed factor, no 64-bit division
+ * @param cycles: Tick count or interval
+ * @retval uint64_t: Nanoseconds
+ */
+uint64_t TS_CyclesToNs(uint64_t cycles)
+{
+    return TS_MulQ32(cycles, ts_ns_per_cycle_q32);
+}
+
+/**
+ * @brief Convert nanoseconds to ticks
+ * @param ns: Time or interval in nanoseconds
+ * @retval uint64_t: Ticks
+ */
+uint64_t TS_NsToCycles(uint64_t ns)
+{
+    return TS_MulQ32(ns, ts_cycles_per_ns_q32);
+}
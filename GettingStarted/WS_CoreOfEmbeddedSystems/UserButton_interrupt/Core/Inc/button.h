@@ -0,0 +1,34 @@
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include "stm32f4xx_hal.h"
+#include "debounce.h"
+#include "exti_router.h"
+
+// Configuration definitions
+#define BTN_TIM             TIM11                       // One-pulse settle/timeout timer
+#define BTN_TIM_IRQn        TIM1_TRG_COM_TIM11_IRQn
+#define BTN_TIM_TICK_HZ     10000                       // 0.1 ms ticks: timeouts up to 6.5 s
+#define BTN_IRQ_PRIORITY    EXTIR_IRQ_PRIORITY          // Same as the EXTI line: the two never nest
+
+// Button structure
+typedef struct {
+    GPIO_TypeDef *port;         // Input port
+    uint16_t pin;               // Input pin (also the EXTI line mask)
+    GPIO_PinState active;       // Level of a pressed button
+    DEB_InputTypeDef input;     // Debounce state machine
+    DEB_QueueTypeDef queue;     // Events for the main loop
+} BTN_HandleTypeDef;
+
+// Button states
+typedef enum {
+    BTN_OK = 0,         // Operation successful
+    BTN_ERROR = 1       // Operation failed
+} BTN_StatusTypeDef;
+
+// Function prototypes
+BTN_StatusTypeDef BTN_Init(BTN_HandleTypeDef *btn, GPIO_TypeDef *port, uint16_t pin, GPIO_PinState active);
+void BTN_TimerHandler(BTN_HandleTypeDef *btn);
+uint8_t BTN_GetEvent(BTN_HandleTypeDef *btn, DEB_EventTypeDef *event);
+
+#endif /* BUTTON_H */
@@ -0,0 +1,64 @@
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define DEB_SETTLE_MS       20      // Quiet time that confirms a level
+#define DEB_LONG_MS         800     // Hold time of a long press
+#define DEB_DOUBLE_MS       300     // Max release-to-press gap of a double click
+#define DEB_QUEUE_SIZE      16      // Event queue depth (power of two)
+
+// Input events
+typedef enum {
+    DEB_EVT_PRESS = 0,      // Press confirmed
+    DEB_EVT_RELEASE = 1,    // Release confirmed
+    DEB_EVT_LONG = 2,       // Held for DEB_LONG_MS (reported once per press)
+    DEB_EVT_CLICK = 3,      // Short press not followed by a second one
+    DEB_EVT_DOUBLE = 4      // Second press within DEB_DOUBLE_MS of a short click
+} DEB_EventIdTypeDef;
+
+// Event record
+typedef struct {
+    uint8_t id;             // DEB_EventIdTypeDef
+    uint8_t input;          // Input number given to DEB_Init
+    uint32_t time;          // Time of the edge (or timeout) that caused it
+} DEB_EventTypeDef;
+
+// Single-producer single-consumer event queue
+typedef struct {
+    DEB_EventTypeDef events[DEB_QUEUE_SIZE];
+    volatile uint32_t head;     // Written by the producer (interrupt) only
+    volatile uint32_t tail;     // Written by the consumer (thread) only
+    volatile uint32_t dropped;  // Events lost to a full queue
+} DEB_QueueTypeDef;
+
+// Debounced input state machine
+typedef struct {
+    DEB_QueueTypeDef *queue;    // Where events go
+    uint8_t input;              // Input number copied into events
+    uint8_t settling;           // An edge was seen and the level is not confirmed yet
+    uint8_t pressed;            // Confirmed level
+    uint8_t long_sent;          // DEB_EVT_LONG already reported for this press
+    uint8_t click_pending;      // Short click waiting for a possible second press
+    uint8_t second_press;       // Current press completed a double click
+    uint32_t edge_time;         // First edge of the current bounce burst
+    uint32_t press_time;        // Confirmed press
+    uint32_t release_time;      // Confirmed release
+} DEB_InputTypeDef;
+
+// Debounce states
+typedef enum {
+    DEB_OK = 0,         // Operation successful
+    DEB_ERROR = 1       // Operation failed
+} DEB_StatusTypeDef;
+
+// Function prototypes
+DEB_StatusTypeDef DEB_Init(DEB_InputTypeDef *in, DEB_QueueTypeDef *queue, uint8_t input, uint8_t pressed);
+uint32_t DEB_OnEdge(DEB_InputTypeDef *in, uint32_t now);
+uint32_t DEB_OnTimer(DEB_InputTypeDef *in, uint8_t pressed, uint8_t bounced, uint32_t now);
+void DEB_QueueInit(DEB_QueueTypeDef *queue);
+uint8_t DEB_QueuePush(DEB_QueueTypeDef *queue, const DEB_EventTypeDef *event);
+uint8_t DEB_QueuePop(DEB_QueueTypeDef *queue, DEB_EventTypeDef *event);
+
+#endif /* DEBOUNCE_H */
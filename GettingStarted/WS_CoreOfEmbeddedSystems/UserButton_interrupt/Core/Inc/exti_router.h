@@ -0,0 +1,27 @@
+#ifndef EXTI_ROUTER_H
+#define EXTI_ROUTER_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define EXTIR_LINES             16                  // GPIO lines 0..15
+#define EXTIR_GROUP_9_5         0x000003E0UL        // Lines sharing EXTI9_5_IRQn
+#define EXTIR_GROUP_15_10       0x0000FC00UL        // Lines sharing EXTI15_10_IRQn
+#define EXTIR_IRQ_PRIORITY      2                   // Priority of every EXTI interrupt
+
+// Line handler, called in interrupt context with the line number (0..15)
+typedef void (*EXTIR_HandlerTypeDef)(uint32_t line, void *ctx);
+
+// Router states
+typedef enum {
+    EXTIR_OK = 0,       // Operation successful
+    EXTIR_ERROR = 1     // Operation failed
+} EXTIR_StatusTypeDef;
+
+// Function prototypes
+EXTIR_StatusTypeDef EXTIR_Register(uint32_t line, EXTIR_HandlerTypeDef handler, void *ctx);
+EXTIR_StatusTypeDef EXTIR_Unregister(uint32_t line);
+void EXTIR_DispatchPending(uint32_t pending);
+void EXTIR_Dispatch(uint32_t lines);
+
+#endif /* EXTI_ROUTER_H */
@@ -0,0 +1,148 @@
+#include "button.h"
+#include <string.h>
+
+/**
+ * @brief Arm the one-pulse timer
+ * @param delay_ms: Delay before the timer interrupt (clamped to the 16-bit range)
+ */
+static void BTN_Arm(uint32_t delay_ms)
+{
+    uint32_t ticks = delay_ms * (BTN_TIM_TICK_HZ / 1000U);
+
+    if (ticks > 0x10000UL) {
+        ticks = 0x10000UL;
+    }
+
+    // Stop first and drop an expiry not yet serviced: it belongs to the old delay
+    BTN_TIM->CR1 = TIM_CR1_OPM | TIM_CR1_URS;
+    BTN_TIM->SR = ~TIM_SR_UIF & 0xFFFFU;
+    BTN_TIM->CNT = 0;
+    BTN_TIM->ARR = ticks - 1U;
+    BTN_TIM->CR1 = TIM_CR1_OPM | TIM_CR1_URS | TIM_CR1_CEN;
+}
+
+/**
+ * @brief Read the pressed state of the button
+ * @param btn: Pointer to BTN_HandleTypeDef structure
+ * @retval uint8_t: 1 if pressed
+ */
+static inline uint8_t BTN_IsPressed(const BTN_HandleTypeDef *btn)
+{
+    return (((btn->port->IDR & btn->pin) != 0U) == (btn->active == GPIO_PIN_SET)) ? 1U : 0U;
+}
+
+/**
+ * @brief Edge interrupt: stamp, mask the line and arm the settle timer
+ * @note  Routed by EXTIR_Dispatch, which has already cleared the pending
+ *        bit. A few register accesses per edge
+ * @param line: EXTI line of the button
+ * @param ctx: Pointer to BTN_HandleTypeDef structure
+ */
+static void BTN_EdgeHandler(uint32_t line, void *ctx)
+{
+    BTN_HandleTypeDef *btn = ctx;
+
+    EXTI->IMR &= ~(1UL << line);
+
+    uint32_t delay = DEB_OnEdge(&btn->input, HAL_GetTick());
+    if (delay != 0U) {
+        BTN_Arm(delay);
+    }
+}
+
+/**
+ * @brief Initialize a debounced button on an EXTI pin
+ * @note  The pin must already be configured as an EXTI input (MX_GPIO_Init);
+ *        the line is switched to both edges and routed to the button here.
+ *        One button per timer
+ * @param btn: Pointer to BTN_HandleTypeDef structure
+ * @param port: Input port
+ * @param pin: Input pin
+ * @param active: Level of a pressed button (GPIO_PIN_RESET with a pull-up)
+ * @retval BTN_StatusTypeDef: Operation status
+ */
+BTN_StatusTypeDef BTN_Init(BTN_HandleTypeDef *btn, GPIO_TypeDef *port, uint16_t pin, GPIO_PinState active)
+{
+    uint32_t clk;
+
+    if (btn == NULL || port == NULL || pin == 0U || (pin & (pin - 1U)) != 0U) {
+        return BTN_ERROR;
+    }
+
+    memset(btn, 0, sizeof(*btn));
+    btn->port = port;
+    btn->pin = pin;
+    btn->active = active;
+    DEB_QueueInit(&btn->queue);
+    DEB_Init(&btn->input, &btn->queue, 0, BTN_IsPressed(btn));
+
+    // APB2 timers run at twice the bus clock when the APB prescaler is not 1
+    clk = HAL_RCC_GetPCLK2Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE2) != RCC_CFGR_PPRE2_DIV1) {
+        clk *= 2U;
+    }
+
+    __HAL_RCC_TIM11_CLK_ENABLE();
+    BTN_TIM->CR1 = TIM_CR1_OPM | TIM_CR1_URS;
+    BTN_TIM->PSC = clk / BTN_TIM_TICK_HZ - 1U;
+    BTN_TIM->EGR = TIM_EGR_UG;          // Load PSC; URS keeps UIF clear
+    BTN_TIM->SR = 0;
+    BTN_TIM->DIER = TIM_DIER_UIE;
+
+    HAL_NVIC_SetPriority(BTN_TIM_IRQn, BTN_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(BTN_TIM_IRQn);
+
+    if (EXTIR_Register(31U - __CLZ(pin), BTN_EdgeHandler, btn) != EXTIR_OK) {
+        return BTN_ERROR;
+    }
+
+    EXTI->RTSR |= pin;
+    EXTI->FTSR |= pin;
+    EXTI->PR = pin;
+    EXTI->IMR |= pin;
+
+    return BTN_OK;
+}
+
+/**
+ * @brief Timer interrupt: run the debounce state machine
+ * @note  Edges latched in EXTI->PR while the line was masked mean the
+ *        input is still bouncing. The pending bit is cleared before the
+ *        level is sampled, so an edge after the sample fires the EXTI
+ *        interrupt as soon as the line is unmasked
+ * @param btn: Pointer to BTN_HandleTypeDef structure
+ */
+void BTN_TimerHandler(BTN_HandleTypeDef *btn)
+{
+    if ((BTN_TIM->SR & TIM_SR_UIF) == 0U) {
+        return;
+    }
+    BTN_TIM->SR = ~TIM_SR_UIF & 0xFFFFU;
+
+    uint8_t bounced = ((EXTI->PR & btn->pin) != 0U) ? 1U : 0U;
+    EXTI->PR = btn->pin;
+
+    uint32_t delay = DEB_OnTimer(&btn->input, BTN_IsPressed(btn), bounced, HAL_GetTick());
+
+    if (!btn->input.settling) {
+        EXTI->IMR |= btn->pin;
+    }
+    if (delay != 0U) {
+        BTN_Arm(delay);
+    }
+}
+
+/**
+ * @brief Take the next input event
+ * @param btn: Pointer to BTN_HandleTypeDef structure
+ * @param event: Where to copy the event
+ * @retval uint8_t: 1 if an event was returned, 0 if none is pending
+ */
+uint8_t BTN_GetEvent(BTN_HandleTypeDef *btn, DEB_EventTypeDef *event)
+{
+    if (btn == NULL || event == NULL) {
+        return 0;
+    }
+
+    return DEB_QueuePop(&btn->queue, event);
+}
@@ -0,0 +1,234 @@
+#include "debounce.h"
+#include <stddef.h>
+
+#define DEB_QUEUE_MASK      (DEB_QUEUE_SIZE - 1U)
+
+// Keeps the compiler from moving the record copy past the index update;
+// one core and in-order stores make a hardware barrier unnecessary
+#define DEB_BARRIER()       __asm__ volatile ("" ::: "memory")
+
+/**
+ * @brief Queue one event of an input
+ * @param in: Pointer to DEB_InputTypeDef structure
+ * @param id: Event identifier
+ * @param time: Event time
+ */
+static void DEB_Emit(DEB_InputTypeDef *in, DEB_EventIdTypeDef id, uint32_t time)
+{
+    DEB_EventTypeDef event;
+
+    event.id = (uint8_t)id;
+    event.input = in->input;
+    event.time = time;
+    (void)DEB_QueuePush(in->queue, &event);
+}
+
+/**
+ * @brief Handle a confirmed press
+ * @param in: Pointer to DEB_InputTypeDef structure
+ * @param time: Time of the first edge of the press
+ */
+static void DEB_Pressed(DEB_InputTypeDef *in, uint32_t time)
+{
+    uint8_t second = 0;
+
+    if (in->click_pending) {
+        in->click_pending = 0;
+        if (time - in->release_time <= DEB_DOUBLE_MS) {
+            second = 1;
+        } else {
+            // The window closed while this edge was settling
+            DEB_Emit(in, DEB_EVT_CLICK, in->release_time + DEB_DOUBLE_MS);
+        }
+    }
+
+    in->press_time = time;
+    in->long_sent = 0;
+    in->second_press = second;
+    DEB_Emit(in, DEB_EVT_PRESS, time);
+    if (second) {
+        DEB_Emit(in, DEB_EVT_DOUBLE, time);
+    }
+}
+
+/**
+ * @brief Handle a confirmed release
+ * @param in: Pointer to DEB_InputTypeDef structure
+ * @param time: Time of the first edge of the release
+ */
+static void DEB_Released(DEB_InputTypeDef *in, uint32_t time)
+{
+    in->release_time = time;
+    DEB_Emit(in, DEB_EVT_RELEASE, time);
+
+    // Only a short first press can start a click or a double click
+    in->click_pending = (!in->long_sent && !in->second_press) ? 1U : 0U;
+    in->second_press = 0;
+}
+
+/**
+ * @brief Initialize an input
+ * @param in: Pointer to DEB_InputTypeDef structure
+ * @param queue: Event queue (may be shared by inputs served at one interrupt priority)
+ * @param input: Number copied into the events of this input
+ * @param pressed: Current level, taken as confirmed
+ * @retval DEB_StatusTypeDef: Operation status
+ */
+DEB_StatusTypeDef DEB_Init(DEB_InputTypeDef *in, DEB_QueueTypeDef *queue, uint8_t input, uint8_t pressed)
+{
+    if (in == NULL || queue == NULL) {
+        return DEB_ERROR;
+    }
+
+    in->queue = queue;
+    in->input = input;
+    in->settling = 0;
+    in->pressed = pressed ? 1U : 0U;
+    in->long_sent = pressed ? 1U : 0U;     // A button held at boot is not a long press
+    in->click_pending = 0;
+    in->second_press = 0;
+    in->edge_time = 0;
+    in->press_time = 0;
+    in->release_time = 0;
+
+    return DEB_OK;
+}
+
+/**
+ * @brief Record an edge; call from the edge interrupt
+ * @note  Only stamps the first edge of a burst. The caller then masks the
+ *        edge interrupt and arms its timer with the returned delay; edges
+ *        arriving while masked are reported to DEB_OnTimer as 'bounced'
+ * @param in: Pointer to DEB_InputTypeDef structure
+ * @param now: Current time (ms)
+ * @retval uint32_t: Timer delay to arm (ms), 0 if a settle is already running
+ */
+uint32_t DEB_OnEdge(DEB_InputTypeDef *in, uint32_t now)
+{
+    if (in->settling) {
+        return 0;
+    }
+
+    in->settling = 1;
+    in->edge_time = now;
+
+    return DEB_SETTLE_MS;
+}
+
+/**
+ * @brief Run the state machine when the timer expires
+ * @note  While settling, any edge seen during the wait restarts it; a quiet
+ *        wait confirms the sampled level, dated by the first edge of the
+ *        burst. Outside a settle this handles the long-press and
+ *        double-click timeouts. When 'settling' is clear on return, the
+ *        caller unmasks the edge interrupt
+ * @param in: Pointer to DEB_InputTypeDef structure
+ * @param pressed: Sampled level (1 = pressed)
+ * @param bounced: 1 if an edge arrived since the timer was armed
+ * @param now: Current time (ms)
+ * @retval uint32_t: Timer delay to arm next (ms), 0 = no timer needed
+ */
+uint32_t DEB_OnTimer(DEB_InputTypeDef *in, uint8_t pressed, uint8_t bounced, uint32_t now)
+{
+    pressed = pressed ? 1U : 0U;
+
+    if (in->settling) {
+        if (bounced) {
+            return DEB_SETTLE_MS;
+        }
+        in->settling = 0;
+        if (pressed != in->pressed) {
+            in->pressed = pressed;
+            if (pressed) {
+                DEB_Pressed(in, in->edge_time);
+            } else {
+                DEB_Released(in, in->edge_time);
+            }
+        }
+    } else if (pressed != in->pressed || bounced) {
+        // An edge the interrupt did not report: confirm it the same way
+        in->settling = 1;
+        in->edge_time = now;
+        return DEB_SETTLE_MS;
+    }
+
+    if (in->pressed && !in->long_sent) {
+        uint32_t held = now - in->press_time;
+        if (held < DEB_LONG_MS) {
+            return DEB_LONG_MS - held;
+        }
+        in->long_sent = 1;
+        DEB_Emit(in, DEB_EVT_LONG, in->press_time + DEB_LONG_MS);
+    }
+
+    if (!in->pressed && in->click_pending) {
+        uint32_t gap = now - in->release_time;
+        if (gap <= DEB_DOUBLE_MS) {
+            return DEB_DOUBLE_MS - gap + 1U;
+        }
+        in->click_pending = 0;
+        DEB_Emit(in, DEB_EVT_CLICK, in->release_time + DEB_DOUBLE_MS);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Initialize an event queue, empty
+ * @param queue: Pointer to DEB_QueueTypeDef structure
+ */
+void DEB_QueueInit(DEB_QueueTypeDef *queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+
+    queue->head = 0;
+    queue->tail = 0;
+    queue->dropped = 0;
+}
+
+/**
+ * @brief Add an event (producer side, interrupt context)
+ * @param queue: Pointer to DEB_QueueTypeDef structure
+ * @param event: Event to copy in
+ * @retval uint8_t: 1 if queued, 0 if the queue was full (event dropped)
+ */
+uint8_t DEB_QueuePush(DEB_QueueTypeDef *queue, const DEB_EventTypeDef *event)
+{
+    uint32_t head = queue->head;
+
+    if (head - queue->tail >= DEB_QUEUE_SIZE) {
+        queue->dropped++;
+        return 0;
+    }
+
+    queue->events[head & DEB_QUEUE_MASK] = *event;
+    DEB_BARRIER();
+    queue->head = head + 1U;
+
+    return 1;
+}
+
+/**
+ * @brief Take the oldest event (consumer side, thread context)
+ * @note  Lock-free against DEB_QueuePush: each index has a single writer
+ * @param queue: Pointer to DEB_QueueTypeDef structure
+ * @param event: Where to copy the event
+ * @retval uint8_t: 1 if an event was returned, 0 if the queue was empty
+ */
+uint8_t DEB_QueuePop(DEB_QueueTypeDef *queue, DEB_EventTypeDef *event)
+{
+    uint32_t tail = queue->tail;
+
+    if (tail == queue->head) {
+        return 0;
+    }
+
+    DEB_BARRIER();
+    *event = queue->events[tail & DEB_QUEUE_MASK];
+    DEB_BARRIER();
+    queue->tail = tail + 1U;
+
+    return 1;
+}
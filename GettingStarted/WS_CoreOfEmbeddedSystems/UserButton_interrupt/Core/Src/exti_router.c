@@ -0,0 +1,108 @@
+#include "exti_router.h"
+#include "stm32f4xx_hal.h"
+#include <stddef.h>
+
+// Handler table entry
+typedef struct {
+    volatile EXTIR_HandlerTypeDef handler;  // NULL = line not routed
+    void *volatile ctx;                     // Passed to the handler
+} EXTIR_EntryTypeDef;
+
+static EXTIR_EntryTypeDef extir_table[EXTIR_LINES];
+
+/**
+ * @brief Get the interrupt serving a line
+ * @param line: EXTI line (0..15)
+ * @retval IRQn_Type: EXTI0..4, EXTI9_5 or EXTI15_10
+ */
+static IRQn_Type EXTIR_GetIRQn(uint32_t line)
+{
+    if (line <= 4U) {
+        return (IRQn_Type)(EXTI0_IRQn + (int32_t)line);
+    }
+
+    return (line <= 9U) ? EXTI9_5_IRQn : EXTI15_10_IRQn;
+}
+
+/**
+ * @brief Route a line to a handler
+ * @note  Replaces any previous handler of the line. The pin and its edge
+ *        selection are configured separately (MX_GPIO_Init or the driver);
+ *        this enables the interrupt serving the line
+ * @param line: EXTI line (0..15), i.e. the GPIO pin number
+ * @param handler: Called for every pending edge of the line
+ * @param ctx: Passed to the handler
+ * @retval EXTIR_StatusTypeDef: Operation status
+ */
+EXTIR_StatusTypeDef EXTIR_Register(uint32_t line, EXTIR_HandlerTypeDef handler, void *ctx)
+{
+    if (line >= EXTIR_LINES || handler == NULL) {
+        return EXTIR_ERROR;
+    }
+
+    // Context first: a dispatch in between sees the old handler or the
+    // complete new entry, never a new handler with a stale context
+    extir_table[line].handler = NULL;
+    extir_table[line].ctx = ctx;
+    extir_table[line].handler = handler;
+
+    HAL_NVIC_SetPriority(EXTIR_GetIRQn(line), EXTIR_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(EXTIR_GetIRQn(line));
+
+    return EXTIR_OK;
+}
+
+/**
+ * @brief Stop routing a line; its edges are then cleared and ignored
+ * @param line: EXTI line (0..15)
+ * @retval EXTIR_StatusTypeDef: Operation status
+ */
+EXTIR_StatusTypeDef EXTIR_Unregister(uint32_t line)
+{
+    if (line >= EXTIR_LINES) {
+        return EXTIR_ERROR;
+    }
+
+    extir_table[line].handler = NULL;
+    extir_table[line].ctx = NULL;
+
+    return EXTIR_OK;
+}
+
+/**
+ * @brief Call the handlers of a set of pending lines
+ * @note  One CLZ and one table lookup per pending line, highest line
+ *        first; the cost does not depend on how many lines are routed
+ * @param pending: Pending lines (bit n = line n), already cleared in hardware
+ */
+void EXTIR_DispatchPending(uint32_t pending)
+{
+    pending &= (1UL << EXTIR_LINES) - 1U;
+
+    while (pending != 0U) {
+        uint32_t line = 31U - __CLZ(pending);
+        EXTIR_HandlerTypeDef handler = extir_table[line].handler;
+
+        pending &= ~(1UL << line);
+        if (handler != NULL) {
+            handler(line, extir_table[line].ctx);
+        }
+    }
+}
+
+/**
+ * @brief Acknowledge and dispatch the pending lines of one EXTI interrupt
+ * @note  Call first in EXTIx_IRQHandler with the lines that interrupt
+ *        serves. Masked lines are left alone: their pending bits keep
+ *        latching edges for drivers that poll them (see button.c). Bits
+ *        are cleared before the handlers run, so an edge during a handler
+ *        raises the interrupt again
+ * @param lines: Lines served by the calling interrupt
+ */
+void EXTIR_Dispatch(uint32_t lines)
+{
+    uint32_t pending = EXTI->PR & EXTI->IMR & lines;
+
+    EXTI->PR = pending;
+    EXTIR_DispatchPending(pending);
+}
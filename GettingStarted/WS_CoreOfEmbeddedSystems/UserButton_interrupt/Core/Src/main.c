@@ -21,6 +21,9 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <stdio.h>
+#include <string.h>
+#include "button.h"
 
 /* USER CODE END Includes */
 
@@ -43,6 +46,7 @@
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+BTN_HandleTypeDef user_btn;    // USER_BTN (PC13), pressed = low
 
 /* USER CODE END PV */
 
@@ -51,17 +55,12 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
+static void HandleButtonEvent(const DEB_EventTypeDef *event);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin){
-	if(GPIO_Pin == GPIO_PIN_13){
-		// It changes the GREEN led status
-		HAL_GPIO_TogglePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin);
-	}
-}
 
 /* USER CODE END 0 */
 
@@ -96,6 +95,9 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  if (BTN_Init(&user_btn, USER_BTN_GPIO_Port, USER_BTN_Pin, GPIO_PIN_RESET) != BTN_OK) {
+    Error_Handler();
+  }
 
   /* USER CODE END 2 */
 
@@ -103,6 +105,11 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
+    // Edges are debounced in the EXTI and TIM11 interrupts; only events reach the loop
+    DEB_EventTypeDef event;
+    while (BTN_GetEvent(&user_btn, &event)) {
+      HandleButtonEvent(&event);
+    }
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -233,7 +240,26 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Act on a debounced button event and report it over USART2
+  * @param  event: Event taken from the button queue
+  * @retval None
+  */
+static void HandleButtonEvent(const DEB_EventTypeDef *event)
+{
+  static const char *const names[] = { "press", "release", "long", "click", "double" };
+  char msg[48];
+  int len;
 
+  if (event->id == DEB_EVT_PRESS) {
+    // It changes the GREEN led status, once per physical press
+    HAL_GPIO_TogglePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin);
+  }
+
+  len = snprintf(msg, sizeof(msg), "%lu ms: %s\r\n", event->time,
+                 (event->id <= DEB_EVT_DOUBLE) ? names[event->id] : "?");
+  HAL_UART_Transmit(&huart2, (uint8_t *)msg, len, HAL_MAX_DELAY);
+}
 /* USER CODE END 4 */
 
 /**
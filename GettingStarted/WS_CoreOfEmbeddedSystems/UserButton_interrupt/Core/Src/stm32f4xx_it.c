@@ -22,6 +22,8 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "button.h"
+#include "exti_router.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,7 +59,7 @@
 /* External variables --------------------------------------------------------*/
 
 /* USER CODE BEGIN EV */
-
+extern BTN_HandleTypeDef user_btn;
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -204,14 +206,67 @@ void SysTick_Handler(void)
 void EXTI15_10_IRQHandler(void)
 {
   /* USER CODE BEGIN EXTI15_10_IRQn 0 */
-
+  EXTIR_Dispatch(EXTIR_GROUP_15_10);
   /* USER CODE END EXTI15_10_IRQn 0 */
-  HAL_GPIO_EXTI_IRQHandler(USER_BTN_Pin);
   /* USER CODE BEGIN EXTI15_10_IRQn 1 */
 
   /* USER CODE END EXTI15_10_IRQn 1 */
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles EXTI line0 interrupt.
+  */
+void EXTI0_IRQHandler(void)
+{
+  EXTIR_Dispatch(EXTI_IMR_MR0);
+}
+
+/**
+  * @brief This function handles EXTI line1 interrupt.
+  */
+void EXTI1_IRQHandler(void)
+{
+  EXTIR_Dispatch(EXTI_IMR_MR1);
+}
 
+/**
+  * @brief This function handles EXTI line2 interrupt.
+  */
+void EXTI2_IRQHandler(void)
+{
+  EXTIR_Dispatch(EXTI_IMR_MR2);
+}
+
+/**
+  * @brief This function handles EXTI line3 interrupt.
+  */
+void EXTI3_IRQHandler(void)
+{
+  EXTIR_Dispatch(EXTI_IMR_MR3);
+}
+
+/**
+  * @brief This function handles EXTI line4 interrupt.
+  */
+void EXTI4_IRQHandler(void)
+{
+  EXTIR_Dispatch(EXTI_IMR_MR4);
+}
+
+/**
+  * @brief This function handles EXTI line[9:5] interrupts.
+  */
+void EXTI9_5_IRQHandler(void)
+{
+  EXTIR_Dispatch(EXTIR_GROUP_9_5);
+}
+
+/**
+  * @brief This function handles TIM1 trigger and commutation and TIM11 global interrupt (button debounce).
+  */
+void TIM1_TRG_COM_TIM11_IRQHandler(void)
+{
+  BTN_TimerHandler(&user_btn);
+}
 /* USER CODE END 1 */
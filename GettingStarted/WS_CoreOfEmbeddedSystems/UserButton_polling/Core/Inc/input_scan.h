@@ -0,0 +1,49 @@
+#ifndef INPUT_SCAN_H
+#define INPUT_SCAN_H
+
+#include "stm32f4xx_hal.h"
+#include "vdebounce.h"
+
+// Configuration definitions
+#define SCAN_TIM            TIM10                   // Sampling timer (APB2, 16-bit)
+#define SCAN_TIM_TICK_HZ    1000000                 // Counter tick after the prescaler
+#define SCAN_TIM_IRQn       TIM1_UP_TIM10_IRQn
+#define SCAN_RATE_HZ        1000                    // Samples per second: 7 ms debounce
+#define SCAN_IRQ_PRIORITY   3
+#define SCAN_MAX_PINS       VDEB_LINES
+
+// Scanned pin
+typedef struct {
+    GPIO_TypeDef *port;     // Input port
+    uint16_t pin;           // Input pin
+    uint32_t pull;          // GPIO_NOPULL, GPIO_PULLUP or GPIO_PULLDOWN
+    GPIO_PinState active;   // Level of an active (pressed) input
+} SCAN_PinTypeDef;
+
+// Input scanner structure
+typedef struct {
+    const SCAN_PinTypeDef *pins;        // Pin n is line n
+    uint8_t count;                      // Number of pins
+    uint32_t invert;                    // Lines that are active low
+    VDEB_TypeDef db;                    // Debouncer, interrupt context only
+    volatile uint32_t pressed;          // Lines that became active, not yet fetched
+    volatile uint32_t released;         // Lines that became inactive, not yet fetched
+    volatile uint32_t busy_cycles;      // Core cycles spent in the sampling interrupt
+} SCAN_HandleTypeDef;
+
+// Input scanner states
+typedef enum {
+    SCAN_OK = 0,        // Operation successful
+    SCAN_ERROR = 1      // Operation failed
+} SCAN_StatusTypeDef;
+
+// Function prototypes
+SCAN_StatusTypeDef SCAN_Init(SCAN_HandleTypeDef *scan, const SCAN_PinTypeDef *pins, uint8_t count);
+SCAN_StatusTypeDef SCAN_Start(SCAN_HandleTypeDef *scan);
+SCAN_StatusTypeDef SCAN_Stop(SCAN_HandleTypeDef *scan);
+void SCAN_IRQHandler(SCAN_HandleTypeDef *scan);
+uint8_t SCAN_GetEvents(SCAN_HandleTypeDef *scan, uint32_t *pressed, uint32_t *released);
+uint32_t SCAN_GetState(const SCAN_HandleTypeDef *scan);
+uint32_t SCAN_TakeBusyCycles(SCAN_HandleTypeDef *scan);
+
+#endif /* INPUT_SCAN_H */
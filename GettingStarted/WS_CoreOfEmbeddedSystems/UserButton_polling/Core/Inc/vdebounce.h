@@ -0,0 +1,22 @@
+#ifndef VDEBOUNCE_H
+#define VDEBOUNCE_H
+
+#include <stdint.h>
+
+// Configuration definitions
+#define VDEB_LINES          32      // One bit per input line
+#define VDEB_STABLE_SAMPLES 7       // Consecutive differing samples that flip a line (3-bit counter)
+
+// Vertical-counter debouncer: bit n of c0/c1/c2 is the counter of line n
+typedef struct {
+    uint32_t state;         // Debounced levels (1 = active)
+    uint32_t c0;            // Counter bit 0 of every line
+    uint32_t c1;            // Counter bit 1
+    uint32_t c2;            // Counter bit 2
+} VDEB_TypeDef;
+
+// Function prototypes
+void VDEB_Init(VDEB_TypeDef *db, uint32_t initial);
+uint32_t VDEB_Update(VDEB_TypeDef *db, uint32_t sample);
+
+#endif /* VDEBOUNCE_H */
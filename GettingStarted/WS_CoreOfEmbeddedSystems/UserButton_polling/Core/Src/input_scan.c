@@ -0,0 +1,203 @@
+#include "input_scan.h"
+#include <string.h>
+
+/**
+ * @brief Get the clock of the sampling timer
+ * @note  APB2 timers run at twice the bus clock when the APB prescaler is not 1
+ * @retval uint32_t: Timer input clock in Hz
+ */
+static uint32_t SCAN_TimerClock(void)
+{
+    uint32_t clk = HAL_RCC_GetPCLK2Freq();
+
+    if ((RCC->CFGR & RCC_CFGR_PPRE2) != RCC_CFGR_PPRE2_DIV1) {
+        clk *= 2U;
+    }
+
+    return clk;
+}
+
+/**
+ * @brief Read the raw level of every scanned pin
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @retval uint32_t: Bit n set when pin n is active
+ */
+static inline uint32_t SCAN_Sample(const SCAN_HandleTypeDef *scan)
+{
+    uint32_t bits = 0;
+
+    for (uint32_t i = 0; i < scan->count; i++) {
+        if ((scan->pins[i].port->IDR & scan->pins[i].pin) != 0U) {
+            bits |= 1UL << i;
+        }
+    }
+
+    return bits ^ scan->invert;
+}
+
+/**
+ * @brief Initialize the input scanner
+ * @note  Configures every pin as a plain input and the sampling timer.
+ *        HAL_GPIO_Init leaves the EXTI registers alone in input mode, so
+ *        each pin is reset first: an EXTI line routed to it by
+ *        MX_GPIO_Init (PC13 falling edge) is masked and its edge
+ *        triggers cleared. Port clocks must already be enabled
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @param pins: Pin table, must stay valid while scanning
+ * @param count: Number of pins (1..SCAN_MAX_PINS)
+ * @retval SCAN_StatusTypeDef: Operation status
+ */
+SCAN_StatusTypeDef SCAN_Init(SCAN_HandleTypeDef *scan, const SCAN_PinTypeDef *pins, uint8_t count)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    if (scan == NULL || pins == NULL || count == 0U || count > SCAN_MAX_PINS) {
+        return SCAN_ERROR;
+    }
+
+    memset(scan, 0, sizeof(*scan));
+    scan->pins = pins;
+    scan->count = count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        HAL_GPIO_DeInit(pins[i].port, pins[i].pin);
+
+        gpio.Pin = pins[i].pin;
+        gpio.Mode = GPIO_MODE_INPUT;
+        gpio.Pull = pins[i].pull;
+        gpio.Speed = GPIO_SPEED_FREQ_LOW;
+        HAL_GPIO_Init(pins[i].port, &gpio);
+
+        if (pins[i].active == GPIO_PIN_RESET) {
+            scan->invert |= 1UL << i;
+        }
+    }
+
+    // Pull-ups need a moment before the first sample is meaningful
+    HAL_Delay(1);
+    VDEB_Init(&scan->db, SCAN_Sample(scan));
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // Registers only: the TIM HAL module is not part of this project
+    __HAL_RCC_TIM10_CLK_ENABLE();
+    SCAN_TIM->CR1 = TIM_CR1_URS | TIM_CR1_ARPE;
+    SCAN_TIM->PSC = SCAN_TimerClock() / SCAN_TIM_TICK_HZ - 1U;
+    SCAN_TIM->ARR = SCAN_TIM_TICK_HZ / SCAN_RATE_HZ - 1U;
+    SCAN_TIM->EGR = TIM_EGR_UG;         // Load PSC and ARR; URS keeps UIF clear
+    SCAN_TIM->SR = 0;
+    SCAN_TIM->DIER = TIM_DIER_UIE;
+
+    HAL_NVIC_SetPriority(SCAN_TIM_IRQn, SCAN_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(SCAN_TIM_IRQn);
+
+    return SCAN_OK;
+}
+
+/**
+ * @brief Start sampling
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @retval SCAN_StatusTypeDef: Operation status
+ */
+SCAN_StatusTypeDef SCAN_Start(SCAN_HandleTypeDef *scan)
+{
+    if (scan == NULL) {
+        return SCAN_ERROR;
+    }
+
+    SCAN_TIM->CNT = 0;
+    SCAN_TIM->CR1 |= TIM_CR1_CEN;
+
+    return SCAN_OK;
+}
+
+/**
+ * @brief Stop sampling
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @retval SCAN_StatusTypeDef: Operation status
+ */
+SCAN_StatusTypeDef SCAN_Stop(SCAN_HandleTypeDef *scan)
+{
+    if (scan == NULL) {
+        return SCAN_ERROR;
+    }
+
+    SCAN_TIM->CR1 &= ~TIM_CR1_CEN;
+
+    return SCAN_OK;
+}
+
+/**
+ * @brief Sampling interrupt: debounce all pins at once and latch the edges
+ * @note  Call from TIM1_UP_TIM10_IRQHandler. The time spent here is added
+ *        to busy_cycles for load measurements
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ */
+void SCAN_IRQHandler(SCAN_HandleTypeDef *scan)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    if ((SCAN_TIM->SR & TIM_SR_UIF) == 0U) {
+        return;
+    }
+    SCAN_TIM->SR = ~TIM_SR_UIF & 0xFFFFU;
+
+    uint32_t flipped = VDEB_Update(&scan->db, SCAN_Sample(scan));
+
+    if (flipped != 0U) {
+        scan->pressed |= flipped & scan->db.state;
+        scan->released |= flipped & ~scan->db.state;
+    }
+
+    scan->busy_cycles += DWT->CYCCNT - start;
+}
+
+/**
+ * @brief Fetch and clear the edges latched since the last call
+ * @note  A line pressed and released between two calls shows in both masks
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @param pressed: Lines that became active
+ * @param released: Lines that became inactive
+ * @retval uint8_t: 1 if any edge was returned
+ */
+uint8_t SCAN_GetEvents(SCAN_HandleTypeDef *scan, uint32_t *pressed, uint32_t *released)
+{
+    if (scan == NULL || pressed == NULL || released == NULL) {
+        return 0;
+    }
+
+    HAL_NVIC_DisableIRQ(SCAN_TIM_IRQn);
+    *pressed = scan->pressed;
+    *released = scan->released;
+    scan->pressed = 0;
+    scan->released = 0;
+    HAL_NVIC_EnableIRQ(SCAN_TIM_IRQn);
+
+    return (*pressed | *released) != 0U;
+}
+
+/**
+ * @brief Get the debounced level of every line
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @retval uint32_t: Bit n set while pin n is active
+ */
+uint32_t SCAN_GetState(const SCAN_HandleTypeDef *scan)
+{
+    return scan->db.state;
+}
+
+/**
+ * @brief Fetch and clear the cycles spent in the sampling interrupt
+ * @param scan: Pointer to SCAN_HandleTypeDef structure
+ * @retval uint32_t: Core cycles since the last call
+ */
+uint32_t SCAN_TakeBusyCycles(SCAN_HandleTypeDef *scan)
+{
+    HAL_NVIC_DisableIRQ(SCAN_TIM_IRQn);
+    uint32_t cycles = scan->busy_cycles;
+    scan->busy_cycles = 0;
+    HAL_NVIC_EnableIRQ(SCAN_TIM_IRQn);
+
+    return cycles;
+}
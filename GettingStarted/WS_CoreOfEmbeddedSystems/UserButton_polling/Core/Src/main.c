@@ -21,6 +21,9 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <stdio.h>
+#include <string.h>
+#include "input_scan.h"
 
 /* USER CODE END Includes */
 
@@ -31,6 +34,7 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define LOAD_REPORT_MS  1000    // Period of the CPU load report
 
 /* USER CODE END PD */
 
@@ -43,6 +47,14 @@
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
+// Scanned inputs, line n = entry n (D2/D4 are Arduino header pins to ground)
+static const SCAN_PinTypeDef scan_pins[] = {
+  { USER_BTN_GPIO_Port, USER_BTN_Pin, GPIO_PULLUP, GPIO_PIN_RESET },
+  { GPIOA,              GPIO_PIN_10,  GPIO_PULLUP, GPIO_PIN_RESET },  // D2
+  { GPIOB,              GPIO_PIN_5,   GPIO_PULLUP, GPIO_PIN_RESET },  // D4
+};
+static const char *const scan_names[] = { "USER_BTN", "D2", "D4" };
+SCAN_HandleTypeDef scanner;
 
 /* USER CODE END PV */
 
@@ -51,6 +63,8 @@ void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
 static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
+static void ReportEdges(uint32_t pressed, uint32_t released);
+static void ReportLoad(uint32_t elapsed_ms);
 
 /* USER CODE END PFP */
 
@@ -90,6 +104,13 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  uint32_t last_report;
+
+  if (SCAN_Init(&scanner, scan_pins, sizeof(scan_pins) / sizeof(scan_pins[0])) != SCAN_OK ||
+      SCAN_Start(&scanner) != SCAN_OK) {
+    Error_Handler();
+  }
+  last_report = HAL_GetTick();
 
   /* USER CODE END 2 */
 
@@ -97,10 +118,24 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-    if(HAL_GPIO_ReadPin(USER_BTN_GPIO_Port, USER_BTN_Pin) == GPIO_PIN_RESET){
-    	HAL_GPIO_TogglePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin);
+    uint32_t pressed;
+    uint32_t released;
+
+    // Pins are sampled and debounced in the TIM10 interrupt; the loop only handles edges
+    if (SCAN_GetEvents(&scanner, &pressed, &released)) {
+      if (pressed & (1UL << 0)) {
+        HAL_GPIO_TogglePin(GREEN_LED_GPIO_Port, GREEN_LED_Pin);
+      }
+      ReportEdges(pressed, released);
+    }
+
+    if (HAL_GetTick() - last_report >= LOAD_REPORT_MS) {
+      ReportLoad(HAL_GetTick() - last_report);
+      last_report = HAL_GetTick();
     }
-    HAL_Delay(100);
+
+    // Nothing to do until the next interrupt (SysTick or scanner)
+    __WFI();
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -227,7 +262,42 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Print the debounced edges of the scanned pins over USART2
+  * @param  pressed: Lines that became active
+  * @param  released: Lines that became inactive
+  * @retval None
+  */
+static void ReportEdges(uint32_t pressed, uint32_t released)
+{
+  char msg[48];
+  int len;
+
+  for (uint32_t i = 0; i < sizeof(scan_pins) / sizeof(scan_pins[0]); i++) {
+    if ((pressed | released) & (1UL << i)) {
+      len = snprintf(msg, sizeof(msg), "%s %s%s\r\n", scan_names[i],
+                     (pressed & (1UL << i)) ? "pressed" : "",
+                     (released & (1UL << i)) ? ((pressed & (1UL << i)) ? "+released" : "released") : "");
+      HAL_UART_Transmit(&huart2, (uint8_t *)msg, len, HAL_MAX_DELAY);
+    }
+  }
+}
 
+/**
+  * @brief  Print the share of CPU time spent sampling the inputs
+  * @param  elapsed_ms: Time covered by the measurement
+  * @retval None
+  */
+static void ReportLoad(uint32_t elapsed_ms)
+{
+  char msg[48];
+  int len;
+  uint64_t total = (uint64_t)elapsed_ms * (HAL_RCC_GetHCLKFreq() / 1000U);
+  uint32_t ppm = (uint32_t)(((uint64_t)SCAN_TakeBusyCycles(&scanner) * 1000000U) / total);
+
+  len = snprintf(msg, sizeof(msg), "scan load: %lu.%04lu %%\r\n", ppm / 10000U, ppm % 10000U);
+  HAL_UART_Transmit(&huart2, (uint8_t *)msg, len, HAL_MAX_DELAY);
+}
 /* USER CODE END 4 */
 
 /**
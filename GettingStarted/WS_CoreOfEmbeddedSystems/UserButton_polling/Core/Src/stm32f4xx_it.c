@@ -22,6 +22,7 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "input_scan.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,7 +58,7 @@
 /* External variables --------------------------------------------------------*/
 
 /* USER CODE BEGIN EV */
-
+extern SCAN_HandleTypeDef scanner;
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -199,5 +200,11 @@ void SysTick_Handler(void)
 /******************************************************************************/
 
 /* USER CODE BEGIN 1 */
-
+/**
+  * @brief This function handles TIM1 update and TIM10 global interrupt (input scanner).
+  */
+void TIM1_UP_TIM10_IRQHandler(void)
+{
+  SCAN_IRQHandler(&scanner);
+}
 /* USER CODE END 1 */
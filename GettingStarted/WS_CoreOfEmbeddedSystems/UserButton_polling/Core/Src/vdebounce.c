@@ -0,0 +1,52 @@
+#include "vdebounce.h"
+#include <stddef.h>
+
+/**
+ * @brief Initialize a debouncer
+ * @param db: Pointer to VDEB_TypeDef structure
+ * @param initial: Levels taken as already debounced
+ */
+void VDEB_Init(VDEB_TypeDef *db, uint32_t initial)
+{
+    if (db == NULL) {
+        return;
+    }
+
+    db->state = initial;
+    db->c0 = 0;
+    db->c1 = 0;
+    db->c2 = 0;
+}
+
+/**
+ * @brief Feed one sample of all lines
+ * @note  Each line has a 3-bit counter spread over c0..c2, so all 32 lines
+ *        are counted with a few logic operations and no loop. A line's
+ *        counter runs while its sample differs from the debounced level
+ *        and is cleared by any agreeing sample; the level flips after
+ *        VDEB_STABLE_SAMPLES differing samples in a row
+ * @param db: Pointer to VDEB_TypeDef structure
+ * @param sample: Raw levels (1 = active)
+ * @retval uint32_t: Lines whose debounced level flipped on this sample
+ */
+uint32_t VDEB_Update(VDEB_TypeDef *db, uint32_t sample)
+{
+    uint32_t differ = sample ^ db->state;
+    uint32_t c0 = db->c0;
+    uint32_t c1 = db->c1;
+    uint32_t c2 = db->c2;
+
+    // Increment where differing, clear elsewhere
+    c2 = (c2 ^ (c1 & c0)) & differ;
+    c1 = (c1 ^ c0) & differ;
+    c0 = ~c0 & differ;
+
+    uint32_t flipped = c2 & c1 & c0;
+
+    db->state ^= flipped;
+    db->c0 = c0 & ~flipped;
+    db->c1 = c1 & ~flipped;
+    db->c2 = c2 & ~flipped;
+
+    return flipped;
+}